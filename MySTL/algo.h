@@ -5,6 +5,8 @@
 
 #include "iterator_base.h"
 #include "iterator.h"
+#include "algobase.h"
+#include "memory.h"
 #include "mystl_pair.h"
 #include "functional.h"
 #include "heap_algo.h"
@@ -126,10 +128,33 @@ RandomAccessIterator __find(RandomAccessIterator first, RandomAccessIterator las
 }
 
 template<class InputIterator, class T>
-InputIterator find(InputIterator first, InputIterator last, const T& value) {
+InputIterator __find_dispatch(InputIterator first, InputIterator last, const T& value, false_type) {
 	return mystl::__find(first, last, value, mystl::iterator_category(first));
 }
 
+// ֶεβ, ÿһζԭָ
+template<class SegmentedIterator, class T>
+SegmentedIterator __find_dispatch(SegmentedIterator first, SegmentedIterator last, const T& value, true_type) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first);
+	auto slast = traits::segment(last);
+	auto cur = traits::local(first);
+	while (true) {
+		auto seg_last = sfirst == slast ? traits::local(last) : traits::end(sfirst);
+		auto pos = mystl::__find(cur, seg_last, value, mystl::random_iterator_tag());
+		if (pos != seg_last)
+			return traits::compose(sfirst, pos);
+		if (sfirst == slast)
+			return last;
+		cur = traits::begin(++sfirst);
+	}
+}
+
+template<class InputIterator, class T>
+InputIterator find(InputIterator first, InputIterator last, const T& value) {
+	return mystl::__find_dispatch(first, last, value, mystl::is_segmented(first));
+}
+
 /*****************************************************************************************/
 // find_if
 // [first, last)ҵһһԪ unary_pred Ϊ true ԪزָԪصĵ
@@ -178,10 +203,32 @@ RandomAccessIterator __find_if(RandomAccessIterator first, RandomAccessIterator
 }
 
 template<class InputIterator, class UnaryPredicate>
-InputIterator find_if(InputIterator first, InputIterator last, UnaryPredicate unary_pred) {
+InputIterator __find_if_dispatch(InputIterator first, InputIterator last, UnaryPredicate unary_pred, false_type) {
 	return __find_if(first, last, unary_pred, mystl::iterator_category(first));
 }
 
+template<class SegmentedIterator, class UnaryPredicate>
+SegmentedIterator __find_if_dispatch(SegmentedIterator first, SegmentedIterator last, UnaryPredicate unary_pred, true_type) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first);
+	auto slast = traits::segment(last);
+	auto cur = traits::local(first);
+	while (true) {
+		auto seg_last = sfirst == slast ? traits::local(last) : traits::end(sfirst);
+		auto pos = __find_if(cur, seg_last, unary_pred, random_iterator_tag());
+		if (pos != seg_last)
+			return traits::compose(sfirst, pos);
+		if (sfirst == slast)
+			return last;
+		cur = traits::begin(++sfirst);
+	}
+}
+
+template<class InputIterator, class UnaryPredicate>
+InputIterator find_if(InputIterator first, InputIterator last, UnaryPredicate unary_pred) {
+	return __find_if_dispatch(first, last, unary_pred, mystl::is_segmented(first));
+}
+
 /*****************************************************************************************/
 // find_if_not
 // [first, last)ҵһһԪ unary_pred Ϊ false ԪزָԪصĵ
@@ -483,12 +530,33 @@ InputIterator find_first_of(InputIterator first1, InputIterator last1,
 // f() ɷһֵֵᱻ
 /*****************************************************************************************/
 template<class InputIterator, class Function>
-Function for_each(InputIterator first, InputIterator last, Function f) {
+Function __for_each_dispatch(InputIterator first, InputIterator last, Function f, false_type) {
 	for (; first != last; ++first)
 		f(*first);
 	return f;
 }
 
+template<class SegmentedIterator, class Function>
+Function __for_each_dispatch(SegmentedIterator first, SegmentedIterator last, Function f, true_type) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first);
+	auto slast = traits::segment(last);
+	auto cur = traits::local(first);
+	while (true) {
+		auto seg_last = sfirst == slast ? traits::local(last) : traits::end(sfirst);
+		for (; cur != seg_last; ++cur)
+			f(*cur);
+		if (sfirst == slast)
+			return f;
+		cur = traits::begin(++sfirst);
+	}
+}
+
+template<class InputIterator, class Function>
+Function for_each(InputIterator first, InputIterator last, Function f) {
+	return __for_each_dispatch(first, last, f, mystl::is_segmented(first));
+}
+
 /*****************************************************************************************/
 // adjacent_find
 // ҳһƥԪأȱʡʹ operator== ȽϣҵһָԪصĵһԪ
@@ -620,13 +688,13 @@ ForwardIterator lower_bound(ForwardIterator first, ForwardIterator last, const T
 /*****************************************************************************************/
 template<class ForwardIterator, class T>
 ForwardIterator __upper_bound(ForwardIterator first, ForwardIterator last, const T& value, forward_iterator_tag) {
-	auto len = distance(first, last);
+	auto len = mystl::distance(first, last);
 	ForwardIterator middle = first;
 	auto half = len;
 	while (len > 0) {
 		middle = first;
 		half = len >> 1;
-		advance(middle, half);
+		mystl::advance(middle, half);
 		if (value < *middle)
 			len = half;
 		else {
@@ -1062,7 +1130,7 @@ ForwardIterator min_element(ForwardIterator first, ForwardIterator last, BinaryP
 template<class ForwardIterator1, class ForwardIterator2>
 ForwardIterator2 swap_ranges(ForwardIterator1 first1, ForwardIterator1 last1, ForwardIterator2 first2) {
 	for (; first1 != last1; ++first1, ++first2) {
-		iter_swap(first1, first2);
+		mystl::iter_swap(first1, first2);
 	}
 	return first2;
 }
@@ -1308,7 +1376,7 @@ RandomAccessIterator __rotate(RandomAccessIterator first, RandomAccessIterator m
 	auto r = n - l;
 	RandomAccessIterator result = first + (last - middle);
 	if (l == r) {
-		swap_ranges(first, middle, middle);
+		mystl::swap_ranges(first, middle, middle);
 		return result;
 	}
 	auto cycle_times = __gcd(l, n);
@@ -1545,34 +1613,34 @@ template<class InputIterator1, class InputIterator2, class OutputIterator>
 OutputIterator merge(InputIterator1 first1, InputIterator1 last1, 
 	InputIterator2 first2, InputIterator2 last2, OutputIterator result) {
 	while (first1 != last1 && first2 != last2) {
-		if (*first1 < *first2) {
-			*result = *first1;
-			++first1;
-		}
-		else {
+		if (*first2 < *first1) {
 			*result = *first2;
 			++first2;
 		}
+		else {
+			*result = *first1;
+			++first1;
+		}
 		++result;
 	}
-	return copy(first2, last2, copy(first1, last1, result));
+	return mystl::copy(first2, last2, mystl::copy(first1, last1, result));
 }
 
 template<class InputIterator1, class InputIterator2, class OutputIterator, class BinaryPredicate>
 OutputIterator merge(InputIterator1 first1, InputIterator1 last1, 
 	InputIterator2 first2, InputIterator2 last2, OutputIterator result, BinaryPredicate binary_pred) {
 	while (first1 != last1 && first2 != last2) {
-		if (binary_pred(*first1, *first2)) {
-			*result = *first1;
-			++first1;
-		}
-		else {
+		if (binary_pred(*first2, *first1)) {
 			*result = *first2;
 			++first2;
 		}
+		else {
+			*result = *first1;
+			++first1;
+		}
 		++result;
 	}
-	return copy(first2, last2, copy(first1, last1, result));
+	return mystl::copy(first2, last2, mystl::copy(first1, last1, result));
 }
 
 /*****************************************************************************************/
@@ -1584,39 +1652,39 @@ BidirectionalIterator1 rotate_adaptive(BidirectionalIterator1 first, Bidirection
 	BidirectionalIterator1 last, Distance len1, Distance len2, BidirectionalIterator2 buffer, Distance buffer_size) {
 	BidirectionalIterator2 buffer_end;
 	if (len1 > len2 && len2 <= buffer_size) {
-		buffer_end = copy(middle, last, buffer);
-		copy_backward(first, middle, last);
-		return copy(buffer, buffer_end, first);
+		buffer_end = mystl::copy(middle, last, buffer);
+		mystl::copy_backward(first, middle, last);
+		return mystl::copy(buffer, buffer_end, first);
 	}
 	else if (len1 <= buffer_size) {
-		buffer_end = copy(first, middle, buffer);
-		copy(middle, last, first);
-		return copy_backward(buffer, buffer_end, last);
+		buffer_end = mystl::copy(first, middle, buffer);
+		mystl::copy(middle, last, first);
+		return mystl::copy_backward(buffer, buffer_end, last);
 	}
 	else
-		return rotate(first, middle, last);
+		return mystl::rotate(first, middle, last);
 }
 
 template<class BidirectionalIterator1, class BidirectionalIterator2, class BidirectionalIterator3>
 BidirectionalIterator3 merge_backward(BidirectionalIterator1 first1, BidirectionalIterator1 last1,
 	BidirectionalIterator2 first2, BidirectionalIterator2 last2, BidirectionalIterator3 result) {
 	if (first1 == last1)
-		return copy_backward(first2, last2, result);
+		return mystl::copy_backward(first2, last2, result);
 	if (first2 == last2)
-		return copy_backward(first1, last1, result);
+		return mystl::copy_backward(first1, last1, result);
 	--last1;
 	--last2;
 	while (true) {
 		if (*last2 < *last1) {
 			*--result = *last1;
 			if (first1 == last1)
-				return copy_backward(first2, ++last2, result);
+				return mystl::copy_backward(first2, ++last2, result);
 			--last1;
 		}
 		else {
 			*--result = *last2;
 			if (first2 == last2)
-				return copy_backward(first1, ++last1, result);
+				return mystl::copy_backward(first1, ++last1, result);
 			--last2;
 		}
 	}
@@ -1626,11 +1694,11 @@ template<class BidirectionalIterator, class Distance, class Pointer>
 void merge_adaptive(BidirectionalIterator first, BidirectionalIterator middle, BidirectionalIterator last,
 	Distance len1, Distance len2, Pointer buffer, Distance buffer_size) {
 	if (len1 <= len2 && len1 <= buffer_size) {
-		Pointer buffer_end = copy(first, middle, buffer);
-		merge(buffer, buffer_end, middle, last, first);
+		Pointer buffer_end = mystl::copy(first, middle, buffer);
+		mystl::merge(buffer, buffer_end, middle, last, first);
 	}
 	else if (len2 <= buffer_size) {
-		Pointer buffer_end = copy(middle, last, buffer);
+		Pointer buffer_end = mystl::copy(middle, last, buffer);
 		merge_backward(first, middle, buffer, buffer_end, last);
 	}
 	else {
@@ -1640,15 +1708,15 @@ void merge_adaptive(BidirectionalIterator first, BidirectionalIterator middle, B
 		Distance len22 = 0;
 		if (len1 > len2) {
 			len11 = len1 >> 1;
-			advance(first_cut, len11);
-			second_cut = lower_bound(middle, last, *first_cut);
-			len22 = distance(middle, second_cut);
+			mystl::advance(first_cut, len11);
+			second_cut = mystl::lower_bound(middle, last, *first_cut);
+			len22 = mystl::distance(middle, second_cut);
 		}
 		else {
 			len22 = len2 >> 1;
-			advance(second_cut, len22);
-			first_cut = upper_bound(first, middle, *second_cut);
-			len11 = distance(first, first_cut);
+			mystl::advance(second_cut, len22);
+			first_cut = mystl::upper_bound(first, middle, *second_cut);
+			len11 = mystl::distance(first, first_cut);
 		}
 		BidirectionalIterator new_middle = rotate_adaptive(first_cut, middle, second_cut, len1 - len11, len22, buffer, buffer_size);
 		merge_adaptive(first, first_cut, new_middle, len11, len22, buffer, buffer_size);
@@ -1663,7 +1731,7 @@ void merge_without_buffer(BidirectionalIterator first, BidirectionalIterator mid
 		return;
 	if (2 == len1 + len2) {
 		if (*middle < *first)
-			iter_swap(first, middle);
+			mystl::iter_swap(first, middle);
 		return;
 	}
 	BidirectionalIterator first_cut = first;
@@ -1672,17 +1740,17 @@ void merge_without_buffer(BidirectionalIterator first, BidirectionalIterator mid
 	Distance len22 = 0;
 	if (len1 > len2) {
 		len11 = len1 >> 1;
-		advance(first_cut, len11);
-		second_cut = lower_bound(middle, last, *first_cut);
-		len22 = distance(middle, second_cut);
+		mystl::advance(first_cut, len11);
+		second_cut = mystl::lower_bound(middle, last, *first_cut);
+		len22 = mystl::distance(middle, second_cut);
 	}
 	else {
 		len22 = len2 >> 1;
-		advance(second_cut, len22);
-		first_cut = upper_bound(first, middle, *second_cut);
-		len11 = distance(first, first_cut);
+		mystl::advance(second_cut, len22);
+		first_cut = mystl::upper_bound(first, middle, *second_cut);
+		len11 = mystl::distance(first, first_cut);
 	}
-	BidirectionalIterator new_middle = rotate(first_cut, middle, second_cut);
+	BidirectionalIterator new_middle = mystl::rotate(first_cut, middle, second_cut);
 	merge_without_buffer(first, first_cut, new_middle, len11, len22);
 	merge_without_buffer(new_middle, second_cut, last, len1 - len11, len2 - len22);
 }
@@ -1690,8 +1758,8 @@ void merge_without_buffer(BidirectionalIterator first, BidirectionalIterator mid
 template<class BidirectionalIterator, class T>
 void inplace_merge_aux(BidirectionalIterator first, BidirectionalIterator middle,
 	BidirectionalIterator last, T*) {
-	auto len1 = distance(first, middle);
-	auto len2 = distance(middle, last);
+	auto len1 = mystl::distance(first, middle);
+	auto len2 = mystl::distance(middle, last);
 	temporary_buffer<BidirectionalIterator, T> buf(first, last);
 	if (nullptr == buf.begin()) {
 		merge_without_buffer(first, middle, last, len1, len2);
@@ -1712,22 +1780,22 @@ template<class BidirectionalIterator1, class BidirectionalIterator2, class Bidir
 BidirectionalIterator3 merge_backward(BidirectionalIterator1 first1, BidirectionalIterator1 last1,
 	BidirectionalIterator2 first2, BidirectionalIterator2 last2, BidirectionalIterator3 result, BinaryPredicate binary_pred) {
 	if (first1 == last1)
-		return copy_backward(first2, last2, result);
+		return mystl::copy_backward(first2, last2, result);
 	if (first2 == last2)
-		return copy_backward(first1, last1, result);
+		return mystl::copy_backward(first1, last1, result);
 	--last1;
 	--last2;
 	while (true) {
 		if (binary_pred(*last2, *last1)) {
 			*--result = *last1;
 			if (first1 == last1)
-				return copy_backward(first2, ++last2, result);
+				return mystl::copy_backward(first2, ++last2, result);
 			--last1;
 		}
 		else {
 			*--result = *last2;
 			if (first2 == last2)
-				return copy_backward(first1, ++last1, result);
+				return mystl::copy_backward(first1, ++last1, result);
 			--last2;
 		}
 	}
@@ -1737,11 +1805,11 @@ template<class BidirectionalIterator, class Distance, class Pointer, class Binar
 void merge_adaptive(BidirectionalIterator first, BidirectionalIterator middle, BidirectionalIterator last,
 	Distance len1, Distance len2, Pointer buffer, Distance buffer_size, BinaryPredicate binary_pred) {
 	if (len1 <= len2 && len1 <= buffer_size) {
-		Pointer buffer_end = copy(first, middle, buffer);
+		Pointer buffer_end = mystl::copy(first, middle, buffer);
 		mystl::merge(buffer, buffer_end, middle, last, first, binary_pred);
 	}
 	else if (len2 <= buffer_size) {
-		Pointer buffer_end = copy(middle, last, buffer);
+		Pointer buffer_end = mystl::copy(middle, last, buffer);
 		merge_backward(first, middle, buffer, buffer_end, last, binary_pred);
 	}
 	else {
@@ -1751,15 +1819,15 @@ void merge_adaptive(BidirectionalIterator first, BidirectionalIterator middle, B
 		Distance len22 = 0;
 		if (len1 > len2) {
 			len11 = len1 >> 1;
-			advance(first_cut, len11);
+			mystl::advance(first_cut, len11);
 			second_cut = mystl::lower_bound(middle, last, *first_cut, binary_pred);
-			len22 = distance(middle, second_cut);
+			len22 = mystl::distance(middle, second_cut);
 		}
 		else {
 			len22 = len2 >> 1;
-			advance(second_cut, len22);
+			mystl::advance(second_cut, len22);
 			first_cut = mystl::upper_bound(first, middle, *second_cut, binary_pred);
-			len11 = distance(first, first_cut);
+			len11 = mystl::distance(first, first_cut);
 		}
 		BidirectionalIterator new_middle = rotate_adaptive(first_cut, middle, second_cut, len1 - len11, len22, buffer, buffer_size);
 		merge_adaptive(first, first_cut, new_middle, len11, len22, buffer, buffer_size, binary_pred);
@@ -1774,7 +1842,7 @@ void merge_without_buffer(BidirectionalIterator first, BidirectionalIterator mid
 		return;
 	if (2 == len1 + len2) {
 		if (binary_pred(*middle, *first))
-			iter_swap(first, middle);
+			mystl::iter_swap(first, middle);
 		return;
 	}
 	BidirectionalIterator first_cut = first;
@@ -1783,17 +1851,17 @@ void merge_without_buffer(BidirectionalIterator first, BidirectionalIterator mid
 	Distance len22 = 0;
 	if (len1 > len2) {
 		len11 = len1 >> 1;
-		advance(first_cut, len11);
+		mystl::advance(first_cut, len11);
 		second_cut = mystl::lower_bound(middle, last, *first_cut, binary_pred);
-		len22 = distance(middle, second_cut);
+		len22 = mystl::distance(middle, second_cut);
 	}
 	else {
 		len22 = len2 >> 1;
-		advance(second_cut, len22);
+		mystl::advance(second_cut, len22);
 		first_cut = mystl::upper_bound(first, middle, *second_cut, binary_pred);
-		len11 = distance(first, first_cut);
+		len11 = mystl::distance(first, first_cut);
 	}
-	BidirectionalIterator new_middle = rotate(first_cut, middle, second_cut);
+	BidirectionalIterator new_middle = mystl::rotate(first_cut, middle, second_cut);
 	merge_without_buffer(first, first_cut, new_middle, len11, len22, binary_pred);
 	merge_without_buffer(new_middle, second_cut, last, len1 - len11, len2 - len22, binary_pred);
 }
@@ -1801,8 +1869,8 @@ void merge_without_buffer(BidirectionalIterator first, BidirectionalIterator mid
 template<class BidirectionalIterator, class T, class BinaryPredicate>
 void inplace_merge_aux(BidirectionalIterator first, BidirectionalIterator middle,
 	BidirectionalIterator last, T*, BinaryPredicate binary_pred) {
-	auto len1 = distance(first, middle);
-	auto len2 = distance(middle, last);
+	auto len1 = mystl::distance(first, middle);
+	auto len2 = mystl::distance(middle, last);
 	temporary_buffer<BidirectionalIterator, T> buf(first, last);
 	if (!buf.begin()) {
 		merge_without_buffer(first, middle, last, len1, len2, binary_pred);
@@ -1826,7 +1894,7 @@ void inplace_merge(BidirectionalIterator first, BidirectionalIterator middle,
 /*****************************************************************************************/
 template<class RandomAccessIterator>
 void partial_sort(RandomAccessIterator first, RandomAccessIterator middle, RandomAccessIterator last) {
-	make_heap(first, middle);
+	mystl::make_heap(first, middle);
 	for (RandomAccessIterator i = middle; i != last; ++i) {
 		if (*i < *first)
 			__pop_heap(first, middle, i, *i, distance_type(first));
@@ -2069,7 +2137,7 @@ template<class RandomAccessIterator>
 void linear_insert(RandomAccessIterator first, RandomAccessIterator last) {
 	auto value = *last;
 	if (value < *first) {
-		copy_backward(first, last, last + 1);
+		mystl::copy_backward(first, last, last + 1);
 		*first = value;
 	}
 	else
@@ -2105,7 +2173,7 @@ RandomAccessIterator unguarded_partition(RandomAccessIterator first, RandomAcces
 			--last;
 		if (!(first < last))
 			return first;
-		iter_swap(first, last);
+		mystl::iter_swap(first, last);
 		++first;
 	}
 }
@@ -2122,7 +2190,7 @@ template<class RandomAccessIterator, class Size>
 void introsort_loop(RandomAccessIterator first, RandomAccessIterator last, Size depth_limit) {
 	while (static_cast<size_t>(last - first) > stl_threshold) {
 		if (0 == depth_limit) {
-			partial_sort(first, last, last);
+			mystl::partial_sort(first, last, last);
 			return;
 		}
 		--depth_limit;
@@ -2134,13 +2202,51 @@ void introsort_loop(RandomAccessIterator first, RandomAccessIterator last, Size
 }
 
 template<class RandomAccessIterator>
-void sort(RandomAccessIterator first, RandomAccessIterator last) {
+void __sort(RandomAccessIterator first, RandomAccessIterator last, false_type) {
 	if (first != last) {
 		introsort_loop(first, last, lg(last - first) * 2);
 		final_insertion_sort(first, last);
 	}
 }
 
+// ֶε汾: ָͬһʱ, ԭָ
+// εСֱ, ˲Ҫһ˿ԽĲ
+template<class RandomAccessIterator, class Size>
+void segmented_introsort_loop(RandomAccessIterator first, RandomAccessIterator last, Size depth_limit) {
+	typedef segmented_iterator_traits<RandomAccessIterator> traits;
+	while (first != last) {
+		if (traits::segment(first) == traits::segment(last - 1)) {
+			auto cur = traits::local(first);
+			__sort(cur, cur + (last - first), false_type());
+			return;
+		}
+		if (static_cast<size_t>(last - first) <= stl_threshold) {
+			insertion_sort(first, last);
+			return;
+		}
+		if (0 == depth_limit) {
+			mystl::partial_sort(first, last, last);
+			return;
+		}
+		--depth_limit;
+		auto mid = median(*first, *(first + (last - first) / 2), *(last - 1));
+		RandomAccessIterator cut = unguarded_partition(first, last, mid);
+		segmented_introsort_loop(cut, last, depth_limit);
+		last = cut;
+	}
+}
+
+template<class RandomAccessIterator>
+void __sort(RandomAccessIterator first, RandomAccessIterator last, true_type) {
+	if (first != last)
+		segmented_introsort_loop(first, last, lg(last - first) * 2);
+}
+
+template<class RandomAccessIterator>
+void sort(RandomAccessIterator first, RandomAccessIterator last) {
+	__sort(first, last, mystl::is_segmented(first));
+}
+
 template<class RandomAccessIterator, class T, class BinaryPredicate>
 void unguarded_linear_insert(RandomAccessIterator last, T value, BinaryPredicate binary_pred) {
 	RandomAccessIterator next = last;
@@ -2163,7 +2269,7 @@ template<class RandomAccessIterator, class BinaryPredicate>
 void linear_insert(RandomAccessIterator first, RandomAccessIterator last, BinaryPredicate binary_pred) {
 	auto value = *last;
 	if (binary_pred(value, *first)) {
-		copy_backward(first, last, last + 1);
+		mystl::copy_backward(first, last, last + 1);
 		*first = value;
 	}
 	else
@@ -2195,11 +2301,11 @@ RandomAccessIterator unguarded_partition(RandomAccessIterator first,
 		while (binary_pred(*first, pivot))
 			++first;
 		--last;
-		while (binary_pred(*last, pivot))
+		while (binary_pred(pivot, *last))
 			--last;
 		if (!(first < last))
 			return first;
-		iter_swap(first, last);
+		mystl::iter_swap(first, last);
 		++first;
 	}
 }
@@ -2220,13 +2326,49 @@ void introsort_loop(RandomAccessIterator first, RandomAccessIterator last, Size
 }
 
 template<class RandomAccessIterator, class BinaryPredicate>
-void sort(RandomAccessIterator first, RandomAccessIterator last, BinaryPredicate binary_pred) {
+void __sort(RandomAccessIterator first, RandomAccessIterator last, BinaryPredicate binary_pred, false_type) {
 	if (first != last) {
 		introsort_loop(first, last, lg(last - first) * 2, binary_pred);
 		final_insertion_sort(first, last, binary_pred);
 	}
 }
 
+template<class RandomAccessIterator, class Size, class BinaryPredicate>
+void segmented_introsort_loop(RandomAccessIterator first, RandomAccessIterator last, Size depth_limit, BinaryPredicate binary_pred) {
+	typedef segmented_iterator_traits<RandomAccessIterator> traits;
+	while (first != last) {
+		if (traits::segment(first) == traits::segment(last - 1)) {
+			auto cur = traits::local(first);
+			__sort(cur, cur + (last - first), binary_pred, false_type());
+			return;
+		}
+		if (static_cast<size_t>(last - first) <= stl_threshold) {
+			insertion_sort(first, last, binary_pred);
+			return;
+		}
+		if (0 == depth_limit) {
+			mystl::partial_sort(first, last, last, binary_pred);
+			return;
+		}
+		--depth_limit;
+		auto mid = median(*first, *(first + (last - first) / 2), *(last - 1), binary_pred);
+		RandomAccessIterator cut = unguarded_partition(first, last, mid, binary_pred);
+		segmented_introsort_loop(cut, last, depth_limit, binary_pred);
+		last = cut;
+	}
+}
+
+template<class RandomAccessIterator, class BinaryPredicate>
+void __sort(RandomAccessIterator first, RandomAccessIterator last, BinaryPredicate binary_pred, true_type) {
+	if (first != last)
+		segmented_introsort_loop(first, last, lg(last - first) * 2, binary_pred);
+}
+
+template<class RandomAccessIterator, class BinaryPredicate>
+void sort(RandomAccessIterator first, RandomAccessIterator last, BinaryPredicate binary_pred) {
+	__sort(first, last, binary_pred, mystl::is_segmented(first));
+}
+
 /*****************************************************************************************/
 // stable_sort
 // [first, last)ڵԪԵķʽ
@@ -2251,11 +2393,11 @@ void merge_sort_loop(RandomAccessIterator1 first, RandomAccessIterator1 last,
 	RandomAccessIterator2 result, Distance step_size) {
 	Distance two_step = step_size * 2;
 	while (last - first >= two_step) {
-		result = merge(first, first + step_size, first + step_size, first + two_step, result);
+		result = mystl::merge(first, first + step_size, first + step_size, first + two_step, result);
 		first += two_step;
 	}
 	step_size = mystl::min(static_cast<Distance>(last - first), step_size);
-	merge(first, first + step_size, first + step_size, last, result);
+	mystl::merge(first, first + step_size, first + step_size, last, result);
 }
 
 template<class RandomAccessIterator, class Distance>
@@ -2274,9 +2416,6 @@ void merge_sort_with_buffer(RandomAccessIterator first, RandomAccessIterator las
 	size_t step_size = stl_chunk_size;
 
 	chunk_insertion_sort(first, last, step_size);
-	for (auto j = first; j != last; ++j)
-		std::cout << *j << " ";
-	std::cout << "\n";
 	while (step_size < len) {
 		merge_sort_loop(first, last, buffer, step_size);
 		step_size *= 2;
@@ -2401,18 +2540,18 @@ void stable_sort(RandomAccessIterator first, RandomAccessIterator last, BinaryPr
 /*****************************************************************************************/
 template<class BidirectionalIterator>
 void mergesort(BidirectionalIterator first, BidirectionalIterator last) {
-	auto n = distance(first, last);
+	auto n = mystl::distance(first, last);
 	if (0 == n || 1 == n)
 		return;
 	BidirectionalIterator middle = first + (n >> 1);
 	mergesort(first, middle);
 	mergesort(middle, last);
-	inplace_merge(first, middle, last);
+	mystl::inplace_merge(first, middle, last);
 }
 
 template<class BidirectionalIterator, class BinaryPredicate>
 void mergesort(BidirectionalIterator first, BidirectionalIterator last, BinaryPredicate binary_pred) {
-	auto n = distance(first, last);
+	auto n = mystl::distance(first, last);
 	if (0 == n || 1 == n)
 		return;
 	BidirectionalIterator middle = first + (n >> 1);
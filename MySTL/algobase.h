@@ -3,6 +3,8 @@
 
 #include "iterator.h"
 #include "mystl_pair.h"
+#include <utility>
+#include <cstring>
 
 // ļһЩ㷨
 
@@ -29,9 +31,9 @@ inline void iter_swap(ForwardIterator1 a, ForwardIterator2 b) {
 /*****************************************************************************************/
 template<class T>
 inline void swap(T& a, T& b) {
-	T temp = a;
-	a = b;
-	b = temp;
+	T temp = std::move(a);
+	a = std::move(b);
+	b = std::move(temp);
 }
 
 /*****************************************************************************************/
@@ -87,26 +89,83 @@ OutputIterator copy_aux(InputIterator first, InputIterator last, OutputIterator
 }
 
 template<class T, class U>
-typename std::enable_if<std::is_same<typename std::remove_const<T>::value, U>::value&&
+typename std::enable_if<std::is_same<typename std::remove_const<T>::type, U>::value&&
 	std::is_trivially_copy_assignable<U>::value, U*>::type
 	copy_aux(T* first, T* last, U* result) {
 	size_t n = static_cast<size_t>(last - first);
 	if (n != 0)
 		std::memmove(result, first, n * sizeof(U));
-	return first + n;
+	return result + n;
 }
 
+// ԴĿ䶼Ƿֶε
 template<class InputIterator, class OutputIterator>
-OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result) {
+OutputIterator __copy_dispatch(InputIterator first, InputIterator last, OutputIterator result, false_type, false_type) {
+	return copy_aux(first, last, result);
+}
+
+// ĿǷֶε: ĿĶзԴ, ÿһζԭָ
+template<class InputIterator, class SegmentedIterator>
+SegmentedIterator __copy_to_segmented(InputIterator first, InputIterator last, SegmentedIterator result, input_iterator_tag) {
 	return copy_aux(first, last, result);
 }
 
+template<class RandomAccessIterator, class SegmentedIterator>
+SegmentedIterator __copy_to_segmented(RandomAccessIterator first, RandomAccessIterator last,
+	SegmentedIterator result, random_iterator_tag) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+	const difference_type total = last - first;
+	difference_type n = total;
+	if (n <= 0)
+		return result;
+	auto seg = traits::segment(result);
+	auto cur = traits::local(result);
+	while (true) {
+		difference_type len = mystl::min(n, static_cast<difference_type>(traits::end(seg) - cur));
+		copy_aux(first, first + len, cur);
+		first += len;
+		n -= len;
+		if (0 == n)
+			break;
+		cur = traits::begin(++seg);
+	}
+	return result + total;
+}
+
+template<class InputIterator, class SegmentedIterator>
+SegmentedIterator __copy_dispatch(InputIterator first, InputIterator last, SegmentedIterator result, false_type, true_type) {
+	return __copy_to_segmented(first, last, result, mystl::iterator_category(first));
+}
+
+// ԴǷֶε: ο
+template<class SegmentedIterator, class OutputIterator, class IsSegmentedOutput>
+OutputIterator __copy_dispatch(SegmentedIterator first, SegmentedIterator last, OutputIterator result,
+	true_type, IsSegmentedOutput) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first);
+	auto slast = traits::segment(last);
+	auto cur = traits::local(first);
+	while (true) {
+		auto seg_last = sfirst == slast ? traits::local(last) : traits::end(sfirst);
+		result = __copy_dispatch(cur, seg_last, result, false_type(), IsSegmentedOutput());
+		if (sfirst == slast)
+			return result;
+		cur = traits::begin(++sfirst);
+	}
+}
+
+template<class InputIterator, class OutputIterator>
+OutputIterator copy(InputIterator first, InputIterator last, OutputIterator result) {
+	return __copy_dispatch(first, last, result, mystl::is_segmented(first), mystl::is_segmented(result));
+}
+
 /*****************************************************************************************/
 // copy_backward
 //  [first, last)ڵԪؿ [result - (last - first), result)
 /*****************************************************************************************/
 template<class T, class U>
-typename std::enable_if<std::is_same<typename std::remove_const<T>::value, U>::value&&
+typename std::enable_if<std::is_same<typename std::remove_const<T>::type, U>::value&&
 	std::is_trivially_copy_assignable<U>::value, U*>::type
 	copy_backward_aux(T* first, T* last, U* result) {
 	size_t n = static_cast<size_t>(last - first);
@@ -141,10 +200,234 @@ BidirectionalIterator2 copy_backward_aux(BidirectionalIterator1 first, Bidirecti
 }
 
 template<class BidirectionalIterator1, class BidirectionalIterator2>
-BidirectionalIterator2 copy_backward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result) {
+BidirectionalIterator2 __copy_backward_dispatch(BidirectionalIterator1 first, BidirectionalIterator1 last,
+	BidirectionalIterator2 result, false_type, false_type) {
 	return copy_backward_aux(first, last, result);
 }
 
+template<class BidirectionalIterator, class SegmentedIterator>
+SegmentedIterator __copy_backward_to_segmented(BidirectionalIterator first, BidirectionalIterator last,
+	SegmentedIterator result, bidirectional_iterator_tag) {
+	return copy_backward_aux(first, last, result);
+}
+
+template<class RandomAccessIterator, class SegmentedIterator>
+SegmentedIterator __copy_backward_to_segmented(RandomAccessIterator first, RandomAccessIterator last,
+	SegmentedIterator result, random_iterator_tag) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+	const difference_type total = last - first;
+	difference_type n = total;
+	if (n <= 0)
+		return result;
+	auto seg = traits::segment(result);
+	auto cur = traits::local(result);
+	while (true) {
+		if (cur == traits::begin(seg))
+			cur = traits::end(--seg);
+		difference_type len = mystl::min(n, static_cast<difference_type>(cur - traits::begin(seg)));
+		cur = copy_backward_aux(last - len, last, cur);
+		last -= len;
+		n -= len;
+		if (0 == n)
+			break;
+	}
+	return result - total;
+}
+
+template<class BidirectionalIterator, class SegmentedIterator>
+SegmentedIterator __copy_backward_dispatch(BidirectionalIterator first, BidirectionalIterator last,
+	SegmentedIterator result, false_type, true_type) {
+	return __copy_backward_to_segmented(first, last, result, mystl::iterator_category(first));
+}
+
+template<class SegmentedIterator, class BidirectionalIterator, class IsSegmentedOutput>
+BidirectionalIterator __copy_backward_dispatch(SegmentedIterator first, SegmentedIterator last,
+	BidirectionalIterator result, true_type, IsSegmentedOutput) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first);
+	auto slast = traits::segment(last);
+	auto cur = traits::local(last);
+	while (true) {
+		auto seg_first = sfirst == slast ? traits::local(first) : traits::begin(slast);
+		result = __copy_backward_dispatch(seg_first, cur, result, false_type(), IsSegmentedOutput());
+		if (sfirst == slast)
+			return result;
+		cur = traits::end(--slast);
+	}
+}
+
+template<class BidirectionalIterator1, class BidirectionalIterator2>
+BidirectionalIterator2 copy_backward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result) {
+	return __copy_backward_dispatch(first, last, result, mystl::is_segmented(first), mystl::is_segmented(result));
+}
+
+/*****************************************************************************************/
+// move
+//  [first, last)ڵԪƶ [result, result + (last - first))
+/*****************************************************************************************/
+template<class InputIterator, class OutputIterator>
+OutputIterator move_aux(InputIterator first, InputIterator last, OutputIterator result) {
+	for (; first != last; ++first, ++result)
+		*result = std::move(*first);
+	return result;
+}
+
+template<class T, class U>
+typename std::enable_if<std::is_same<typename std::remove_const<T>::type, U>::value&&
+	std::is_trivially_move_assignable<U>::value, U*>::type
+	move_aux(T* first, T* last, U* result) {
+	size_t n = static_cast<size_t>(last - first);
+	if (n != 0)
+		std::memmove(result, first, n * sizeof(U));
+	return result + n;
+}
+
+template<class InputIterator, class OutputIterator>
+OutputIterator __move_dispatch(InputIterator first, InputIterator last, OutputIterator result, false_type, false_type) {
+	return move_aux(first, last, result);
+}
+
+template<class InputIterator, class SegmentedIterator>
+SegmentedIterator __move_to_segmented(InputIterator first, InputIterator last, SegmentedIterator result, input_iterator_tag) {
+	return move_aux(first, last, result);
+}
+
+template<class RandomAccessIterator, class SegmentedIterator>
+SegmentedIterator __move_to_segmented(RandomAccessIterator first, RandomAccessIterator last,
+	SegmentedIterator result, random_iterator_tag) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+	const difference_type total = last - first;
+	difference_type n = total;
+	if (n <= 0)
+		return result;
+	auto seg = traits::segment(result);
+	auto cur = traits::local(result);
+	while (true) {
+		difference_type len = mystl::min(n, static_cast<difference_type>(traits::end(seg) - cur));
+		move_aux(first, first + len, cur);
+		first += len;
+		n -= len;
+		if (0 == n)
+			break;
+		cur = traits::begin(++seg);
+	}
+	return result + total;
+}
+
+template<class InputIterator, class SegmentedIterator>
+SegmentedIterator __move_dispatch(InputIterator first, InputIterator last, SegmentedIterator result, false_type, true_type) {
+	return __move_to_segmented(first, last, result, mystl::iterator_category(first));
+}
+
+template<class SegmentedIterator, class OutputIterator, class IsSegmentedOutput>
+OutputIterator __move_dispatch(SegmentedIterator first, SegmentedIterator last, OutputIterator result,
+	true_type, IsSegmentedOutput) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first);
+	auto slast = traits::segment(last);
+	auto cur = traits::local(first);
+	while (true) {
+		auto seg_last = sfirst == slast ? traits::local(last) : traits::end(sfirst);
+		result = __move_dispatch(cur, seg_last, result, false_type(), IsSegmentedOutput());
+		if (sfirst == slast)
+			return result;
+		cur = traits::begin(++sfirst);
+	}
+}
+
+template<class InputIterator, class OutputIterator>
+OutputIterator move(InputIterator first, InputIterator last, OutputIterator result) {
+	return __move_dispatch(first, last, result, mystl::is_segmented(first), mystl::is_segmented(result));
+}
+
+/*****************************************************************************************/
+// move_backward
+//  [first, last)ڵԪƶ [result - (last - first), result)
+/*****************************************************************************************/
+template<class BidirectionalIterator1, class BidirectionalIterator2>
+BidirectionalIterator2 move_backward_aux(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result) {
+	while (first != last)
+		*--result = std::move(*--last);
+	return result;
+}
+
+template<class T, class U>
+typename std::enable_if<std::is_same<typename std::remove_const<T>::type, U>::value&&
+	std::is_trivially_move_assignable<U>::value, U*>::type
+	move_backward_aux(T* first, T* last, U* result) {
+	size_t n = static_cast<size_t>(last - first);
+	if (n != 0) {
+		result -= n;
+		std::memmove(result, first, sizeof(U) * n);
+	}
+	return result;
+}
+
+template<class BidirectionalIterator1, class BidirectionalIterator2>
+BidirectionalIterator2 __move_backward_dispatch(BidirectionalIterator1 first, BidirectionalIterator1 last,
+	BidirectionalIterator2 result, false_type, false_type) {
+	return move_backward_aux(first, last, result);
+}
+
+template<class BidirectionalIterator, class SegmentedIterator>
+SegmentedIterator __move_backward_to_segmented(BidirectionalIterator first, BidirectionalIterator last,
+	SegmentedIterator result, bidirectional_iterator_tag) {
+	return move_backward_aux(first, last, result);
+}
+
+template<class RandomAccessIterator, class SegmentedIterator>
+SegmentedIterator __move_backward_to_segmented(RandomAccessIterator first, RandomAccessIterator last,
+	SegmentedIterator result, random_iterator_tag) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	typedef typename iterator_traits<RandomAccessIterator>::difference_type difference_type;
+	const difference_type total = last - first;
+	difference_type n = total;
+	if (n <= 0)
+		return result;
+	auto seg = traits::segment(result);
+	auto cur = traits::local(result);
+	while (true) {
+		if (cur == traits::begin(seg))
+			cur = traits::end(--seg);
+		difference_type len = mystl::min(n, static_cast<difference_type>(cur - traits::begin(seg)));
+		cur = move_backward_aux(last - len, last, cur);
+		last -= len;
+		n -= len;
+		if (0 == n)
+			break;
+	}
+	return result - total;
+}
+
+template<class BidirectionalIterator, class SegmentedIterator>
+SegmentedIterator __move_backward_dispatch(BidirectionalIterator first, BidirectionalIterator last,
+	SegmentedIterator result, false_type, true_type) {
+	return __move_backward_to_segmented(first, last, result, mystl::iterator_category(first));
+}
+
+template<class SegmentedIterator, class BidirectionalIterator, class IsSegmentedOutput>
+BidirectionalIterator __move_backward_dispatch(SegmentedIterator first, SegmentedIterator last,
+	BidirectionalIterator result, true_type, IsSegmentedOutput) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first);
+	auto slast = traits::segment(last);
+	auto cur = traits::local(last);
+	while (true) {
+		auto seg_first = sfirst == slast ? traits::local(first) : traits::begin(slast);
+		result = __move_backward_dispatch(seg_first, cur, result, false_type(), IsSegmentedOutput());
+		if (sfirst == slast)
+			return result;
+		cur = traits::end(--slast);
+	}
+}
+
+template<class BidirectionalIterator1, class BidirectionalIterator2>
+BidirectionalIterator2 move_backward(BidirectionalIterator1 first, BidirectionalIterator1 last, BidirectionalIterator2 result) {
+	return __move_backward_dispatch(first, last, result, mystl::is_segmented(first), mystl::is_segmented(result));
+}
+
 /*****************************************************************************************/
 // copy_if
 // [first, last)һԪ unary_pred Ԫؿ result Ϊʼλ
@@ -201,19 +484,23 @@ typename std::enable_if <std::is_integral<T>::value && 1 == sizeof(T) && !std::i
 }
 
 template<class OutputIterator, class Size, class T>
-OutputIterator fill_n(OutputIterator first, Size n, const T& value) {
+OutputIterator __fill_n_dispatch(OutputIterator first, Size n, const T& value, false_type) {
 	return __fill_n(first, n, value);
 }
 
+// ֶεյ, ٽfill
+template<class SegmentedIterator, class Size, class T>
+SegmentedIterator __fill_n_dispatch(SegmentedIterator first, Size n, const T& value, true_type);
+
+template<class OutputIterator, class Size, class T>
+OutputIterator fill_n(OutputIterator first, Size n, const T& value) {
+	return __fill_n_dispatch(first, n, value, mystl::is_segmented(first));
+}
+
 /*****************************************************************************************/
 // fill
 // Ϊ [first, last)ڵԪֵ
 /*****************************************************************************************/
-template<class ForwardIterator, class T>
-void fill(ForwardIterator first, ForwardIterator last, const T& value) {
-	__fill(first, last, value, iterator_category(first));
-}
-
 template<class ForwardIterator, class T>
 void __fill(ForwardIterator first, ForwardIterator last, const T& value, forward_iterator_tag) {
 	for (; first != last; ++first)
@@ -223,7 +510,42 @@ void __fill(ForwardIterator first, ForwardIterator last, const T& value, forward
 template<class RandomAccessIterator, class T>
 void __fill(RandomAccessIterator first, RandomAccessIterator last, const T& value, random_iterator_tag) {
 	size_t n = static_cast<size_t>(last - first);
-	fill_n(first, n, value);
+	mystl::fill_n(first, n, value);
+}
+
+template<class ForwardIterator, class T>
+void __fill_dispatch(ForwardIterator first, ForwardIterator last, const T& value, false_type) {
+	__fill(first, last, value, iterator_category(first));
+}
+
+// ֶε, ÿһζԭָ
+template<class SegmentedIterator, class T>
+void __fill_dispatch(SegmentedIterator first, SegmentedIterator last, const T& value, true_type) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first);
+	auto slast = traits::segment(last);
+	auto cur = traits::local(first);
+	while (true) {
+		auto seg_last = sfirst == slast ? traits::local(last) : traits::end(sfirst);
+		__fill(cur, seg_last, value, random_iterator_tag());
+		if (sfirst == slast)
+			return;
+		cur = traits::begin(++sfirst);
+	}
+}
+
+template<class ForwardIterator, class T>
+void fill(ForwardIterator first, ForwardIterator last, const T& value) {
+	__fill_dispatch(first, last, value, mystl::is_segmented(first));
+}
+
+template<class SegmentedIterator, class Size, class T>
+SegmentedIterator __fill_n_dispatch(SegmentedIterator first, Size n, const T& value, true_type) {
+	if (n <= 0)
+		return first;
+	SegmentedIterator last = first + n;
+	mystl::fill(first, last, value);
+	return last;
 }
 
 /*****************************************************************************************/
@@ -257,15 +579,39 @@ mismatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, Bin
 // Ƚϵһ [first, last)ϵԪֵǷ͵ڶ
 /*****************************************************************************************/
 template<class InputIterator1, class InputIterator2>
-bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+bool __equal_dispatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, false_type) {
 	for (; first1 != last1; ++first1, ++first2)
 		if (*first1 != *first2)
 			return false;
 	return true;
 }
 
+// һǷֶεʱαȽ, first2֮ǰ
+template<class SegmentedIterator, class InputIterator2>
+bool __equal_dispatch(SegmentedIterator first1, SegmentedIterator last1, InputIterator2 first2, true_type) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first1);
+	auto slast = traits::segment(last1);
+	auto cur = traits::local(first1);
+	while (true) {
+		auto seg_last = sfirst == slast ? traits::local(last1) : traits::end(sfirst);
+		for (; cur != seg_last; ++cur, ++first2)
+			if (*cur != *first2)
+				return false;
+		if (sfirst == slast)
+			return true;
+		cur = traits::begin(++sfirst);
+	}
+}
+
+template<class InputIterator1, class InputIterator2>
+bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2) {
+	return __equal_dispatch(first1, last1, first2, mystl::is_segmented(first1));
+}
+
 template<class InputIterator1, class InputIterator2, class BinaryPredicate>
-bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate binary_pred) {
+bool __equal_dispatch(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2,
+	BinaryPredicate binary_pred, false_type) {
 	for (; first1 != last1; ++first1, ++first2) {
 		if (!binary_pred(*first1, *first2))
 			return false;
@@ -273,6 +619,29 @@ bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, B
 	return true;
 }
 
+template<class SegmentedIterator, class InputIterator2, class BinaryPredicate>
+bool __equal_dispatch(SegmentedIterator first1, SegmentedIterator last1, InputIterator2 first2,
+	BinaryPredicate binary_pred, true_type) {
+	typedef segmented_iterator_traits<SegmentedIterator> traits;
+	auto sfirst = traits::segment(first1);
+	auto slast = traits::segment(last1);
+	auto cur = traits::local(first1);
+	while (true) {
+		auto seg_last = sfirst == slast ? traits::local(last1) : traits::end(sfirst);
+		for (; cur != seg_last; ++cur, ++first2)
+			if (!binary_pred(*cur, *first2))
+				return false;
+		if (sfirst == slast)
+			return true;
+		cur = traits::begin(++sfirst);
+	}
+}
+
+template<class InputIterator1, class InputIterator2, class BinaryPredicate>
+bool equal(InputIterator1 first1, InputIterator1 last1, InputIterator2 first2, BinaryPredicate binary_pred) {
+	return __equal_dispatch(first1, last1, first2, binary_pred, mystl::is_segmented(first1));
+}
+
 /*****************************************************************************************/
 // lexicographical_compare
 // ֵжнбȽϣĳλ÷ֵһ鲻Ԫʱм
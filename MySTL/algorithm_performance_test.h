@@ -52,6 +52,27 @@ namespace algorithm_performance_test {
     delete []arr;                                              \
 } while(0)                                                     \
 
+// countԪطֳÿbatch, 
+#define FUN_TEST3(NameSpace, fun, batch, count) do {           \
+    srand(static_cast<int>(time(0)));                          \
+    char buf[10];                                              \
+    clock_t start, end;                                        \
+    int *arr = new int[count];                                 \
+    for(size_t i = 0; i < count; ++i)                          \
+        *(arr + i) = rand();                                   \
+    start = clock();                                           \
+    for(size_t i = 0; i + batch <= count; i += batch)          \
+        NameSpace::fun(arr + i, arr + i + batch);              \
+    end = clock();                                             \
+    int n = static_cast<int>(static_cast<double>(end - start)  \
+        / CLOCKS_PER_SEC * 1000);                              \
+    std::snprintf(buf, sizeof(buf), "%d", n);                  \
+    std::string t = buf;                                       \
+    t += "ms   |";                                             \
+    std::cout << std::setw(WIDE) << t;                         \
+    delete []arr;                                              \
+} while(0)                                                     \
+
 
 void binary_search_test() {
 	std::cout << "[------------------- function : binary_search ------------------]" << std::endl;
@@ -83,12 +104,37 @@ void sort_test() {
 	std::cout << std::endl;
 }
 
+// ÿ128Ԫصstable_sort, ʱռ˺ܴ
+// scratch_arenaΪ0ʱʱÿζmalloc
+void stable_sort_small_test() {
+	std::cout << "[---------------- function : stable_sort (128) -----------------]" << std::endl;
+	std::cout << "| orders of magnitude |";
+	PRINT_LEN(M(LEN1), M(LEN2), M(LEN3), WIDE);
+	std::cout << "|         std         |";
+	FUN_TEST3(std, stable_sort, 128, M(LEN1));
+	FUN_TEST3(std, stable_sort, 128, M(LEN2));
+	FUN_TEST3(std, stable_sort, 128, M(LEN3));
+	std::cout << std::endl << "|    mystl (malloc)   |";
+	size_t limit = mystl::scratch_arena::limit();
+	mystl::scratch_arena::set_limit(0);
+	FUN_TEST3(mystl, stable_sort, 128, M(LEN1));
+	FUN_TEST3(mystl, stable_sort, 128, M(LEN2));
+	FUN_TEST3(mystl, stable_sort, 128, M(LEN3));
+	mystl::scratch_arena::set_limit(limit);
+	std::cout << std::endl << "|        mystl        |";
+	FUN_TEST3(mystl, stable_sort, 128, M(LEN1));
+	FUN_TEST3(mystl, stable_sort, 128, M(LEN2));
+	FUN_TEST3(mystl, stable_sort, 128, M(LEN3));
+	std::cout << std::endl;
+}
+
 void algorithm_performance_test() {
 
 #if PERFORMANCE_TEST_ON
     std::cout << "[===============================================================]" << std::endl;
     std::cout << "[--------------- Run algorithm performance test ----------------]" << std::endl;
     sort_test();
+    stable_sort_small_test();
     binary_search_test();
     std::cout << "[--------------- End algorithm performance test ----------------]" << std::endl;
     std::cout << "[===============================================================]" << std::endl;
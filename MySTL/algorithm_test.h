@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <numeric>
+#include <stdexcept>
 
 #include "algorithm.h"
 #include "vector.h"
@@ -1117,6 +1118,54 @@ TEST(stable_sort_test)
 	EXPECT_CON_EQ(arr5, arr6);
 }
 
+// countdownο(ֵ)ʱ׳쳣, temporary_buffer仺ʱʧ
+struct throw_on_copy {
+	int value;
+	static int countdown;
+
+	throw_on_copy(int v = 0) : value(v) {};
+
+	throw_on_copy(const throw_on_copy& rhs) : value(rhs.value) {
+		count();
+	}
+
+	throw_on_copy& operator=(const throw_on_copy& rhs) {
+		count();
+		value = rhs.value;
+		return *this;
+	}
+
+	static void count() {
+		if (countdown > 0 && --countdown == 0)
+			throw std::runtime_error("throw_on_copy");
+	}
+
+	bool operator<(const throw_on_copy& rhs) const {
+		return value < rhs.value;
+	}
+};
+
+int throw_on_copy::countdown = 0;
+
+// 䵽һ׳쳣ʱ, stable_sort˻صûİ汾, ʱռҲ
+TEST(stable_sort_buffer_throw_test)
+{
+	int arr1[] = { 80,30,51,65,12,10,24,87,62,51,32,45,1,33,66,20,35,84,62,14 };
+	for (int k = 1; k <= 3; k++) {
+		throw_on_copy arr2[20];
+		for (int i = 0; i < 20; i++)
+			arr2[i].value = arr1[i];
+		throw_on_copy::countdown = k;
+		mystl::stable_sort(arr2, arr2 + 20);
+		EXPECT_TRUE(mystl::is_sorted(arr2, arr2 + 20));
+	}
+	throw_on_copy::countdown = 0;
+	int arr3[] = { 80,30,51,65,12,10,24,87,62,51,32,45,1,33,66,20,35,84,62,14 };
+	std::stable_sort(arr1, arr1 + 20);
+	mystl::stable_sort(arr3, arr3 + 20);
+	EXPECT_CON_EQ(arr1, arr3);
+}
+
 TEST(merge_sort_test)
 {
 	int arr1[] = { 6,1,2,5,4,8,3,2,4,6,10,2,1,9 };
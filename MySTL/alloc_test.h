@@ -0,0 +1,519 @@
+#ifndef MYSTL_ALLOC_TEST_H
+#define MYSTL_ALLOC_TEST_H
+
+#include "test.h"
+#include "mystl_alloc.h"
+#include "mystl_arena.h"
+#include "allocator.h"
+#include "memory_resource.h"
+#include "vector.h"
+#include "deque.h"
+#include "list.h"
+#include "map.h"
+#include "unordered_map.h"
+#include <vector>
+#include <iostream>
+#include <thread>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#pragma comment(lib, "psapi.lib")
+#elif defined(__unix__)
+#include <unistd.h>
+#endif
+
+namespace mystl {
+namespace alloc_test {
+
+// ǰ̵ĳפڴ(KB), ֵ֧ƽ̨0
+size_t current_rss_kb() {
+#if defined(_WIN32)
+	PROCESS_MEMORY_COUNTERS pmc;
+	if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc)))
+		return pmc.WorkingSetSize / 1024;
+	return 0;
+#elif defined(__unix__)
+	size_t pages = 0, resident = 0;
+	FILE* f = std::fopen("/proc/self/statm", "r");
+	if (nullptr == f)
+		return 0;
+	if (std::fscanf(f, "%zu %zu", &pages, &resident) != 2)
+		resident = 0;
+	std::fclose(f);
+	return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE)) / 1024;
+#else
+	return 0;
+#endif
+}
+
+// һܴmap, Ȼ۲trimǰRSS
+// clearѽصslaballoc, map, trimܰѿеslabϵͳ
+void rss_after_map_test(size_t count) {
+	std::cout << " RSS before map constructed : " << current_rss_kb() << " KB\n";
+	mystl::map<int, int> m;
+	for (size_t i = 0; i < count; i++)
+		m.insert(mystl::make_pair(static_cast<int>(i), static_cast<int>(i)));
+	std::cout << " RSS with " << count << " map nodes : " << current_rss_kb() << " KB\n";
+	m.clear();
+	std::cout << " RSS after map cleared : " << current_rss_kb() << " KB\n";
+	size_t released = mystl::alloc::trim();
+	std::cout << " alloc::trim() released : " << released / 1024 << " KB\n";
+	std::cout << " RSS after trim : " << current_rss_kb() << " KB\n";
+}
+
+// ͳһӿ, ڶԱmallocalloc
+struct malloc_policy {
+	static void* allocate(size_t n) { return std::malloc(n); }
+	static void deallocate(void* p, size_t) { std::free(p); }
+};
+
+struct alloc_policy {
+	static void* allocate(size_t n) { return mystl::alloc::allocate(n); }
+	static void deallocate(void* p, size_t n) { mystl::alloc::deallocate(p, n); }
+};
+
+// ÿ̷߳һ8~128ֽڵСȫͷ
+// ͬʱдֽ, ֹŻ
+template<class Policy>
+void alloc_worker(size_t rounds, size_t batch) {
+	void** ptrs = static_cast<void**>(std::malloc(sizeof(void*) * batch));
+	for (size_t r = 0; r < rounds; r++) {
+		for (size_t i = 0; i < batch; i++) {
+			size_t n = ((i + r) % 16 + 1) * 8;
+			ptrs[i] = Policy::allocate(n);
+			*static_cast<char*>(ptrs[i]) = static_cast<char>(i);
+		}
+		for (size_t i = 0; i < batch; i++) {
+			size_t n = ((i + r) % 16 + 1) * 8;
+			Policy::deallocate(ptrs[i], n);
+		}
+	}
+	std::free(ptrs);
+}
+
+// ߳ͷ: һ߳, һ߳ͷ
+template<class Policy>
+void cross_thread_worker(void** ptrs, size_t count, bool is_alloc) {
+	for (size_t i = 0; i < count; i++) {
+		size_t n = (i % 16 + 1) * 8;
+		if (is_alloc) {
+			ptrs[i] = Policy::allocate(n);
+			std::memset(ptrs[i], 0x5a, n);
+		}
+		else {
+			Policy::deallocate(ptrs[i], n);
+		}
+	}
+}
+
+// ʹǽʱ, clock()ͳƵ̵߳cpuʱ
+template<class Policy>
+void alloc_thread_test(size_t nthreads, size_t total) {
+	const size_t batch = 256;
+	size_t rounds = total / nthreads / batch;
+	std::thread* threads[16];
+	auto start = std::chrono::steady_clock::now();
+	for (size_t i = 0; i < nthreads; i++)
+		threads[i] = new std::thread(alloc_worker<Policy>, rounds, batch);
+	for (size_t i = 0; i < nthreads; i++) {
+		threads[i]->join();
+		delete threads[i];
+	}
+	auto end = std::chrono::steady_clock::now();
+	int n = static_cast<int>(std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count());
+	char buf[16];
+	std::snprintf(buf, sizeof(buf), "%d", n);
+	std::string t = buf;
+	t += "ms    |";
+	std::cout << std::setw(WIDE) << t;
+}
+
+// ģһ: һmapһunordered_map, ʱȫ
+// ʹmonotonic_allocʱʱreset
+template<class Alloc>
+struct request_end {
+	static void run() {};
+};
+
+template<int inst>
+struct request_end<mystl::monotonic_alloc<inst>> {
+	static void run() {
+		mystl::monotonic_alloc<inst>::reset();
+	}
+};
+
+template<class Alloc>
+void request_test(size_t requests, size_t nodes) {
+	srand(static_cast<int>(time(0)));
+	clock_t start, end;
+	start = clock();
+	for (size_t r = 0; r < requests; r++) {
+		{
+			mystl::map<int, int, mystl::less<int>, Alloc> m;
+			mystl::unordered_map<int, int, mystl::hash<int>, mystl::equal_to<int>, Alloc> h;
+			for (size_t i = 0; i < nodes; i++) {
+				int k = rand();
+				m.insert(mystl::make_pair(k, k));
+				h.insert(mystl::make_pair(k, k));
+			}
+		}
+		request_end<Alloc>::run();
+	}
+	end = clock();
+	PRINT_TIME(start, end);
+}
+
+// Ͳ, ͨĬڴԴʱл
+// arenaΪʱÿreset
+void resource_request_test(mystl::memory_resource* res, mystl::monotonic_buffer_resource* arena,
+	size_t requests, size_t nodes) {
+	mystl::memory_resource* old = mystl::set_default_resource(res);
+	srand(static_cast<int>(time(0)));
+	clock_t start, end;
+	start = clock();
+	for (size_t r = 0; r < requests; r++) {
+		{
+			mystl::map<int, int, mystl::less<int>, mystl::polymorphic_alloc> m;
+			mystl::unordered_map<int, int, mystl::hash<int>, mystl::equal_to<int>, mystl::polymorphic_alloc> h;
+			for (size_t i = 0; i < nodes; i++) {
+				int k = rand();
+				m.insert(mystl::make_pair(k, k));
+				h.insert(mystl::make_pair(k, k));
+			}
+		}
+		if (arena)
+			arena->reset();
+	}
+	end = clock();
+	PRINT_TIME(start, end);
+	mystl::set_default_resource(old);
+}
+
+// ÿƬһڴ, ֻ¼ûлյֽ
+struct shard_pool {
+	size_t live;
+	size_t largest;				// һ
+	shard_pool() : live(0), largest(0) {};
+};
+
+// 2KBԪ, һslabŲPOOL_MIN_NODES
+struct big_value {
+	char bytes[3000];
+};
+
+// ״̬ķ, Ƭڴ
+// ƸֵͽʱԪһ
+class shard_alloc {
+public:
+	typedef std::true_type	propagate_on_container_copy_assignment;
+	typedef std::true_type	propagate_on_container_swap;
+
+	shard_pool* pool;
+
+	shard_alloc() : pool(default_pool()) {};
+	explicit shard_alloc(shard_pool* p) : pool(p) {};
+
+	void* allocate(size_t n) {
+		pool->live += n;
+		if (n > pool->largest)
+			pool->largest = n;
+		return mystl::alloc::allocate(n);
+	}
+
+	void deallocate(void* p, size_t n) {
+		pool->live -= n;
+		mystl::alloc::deallocate(p, n);
+	}
+
+	void* reallocate(void* p, size_t old_size, size_t new_size) {
+		pool->live += new_size - old_size;
+		return mystl::alloc::reallocate(p, old_size, new_size);
+	}
+
+	bool operator==(const shard_alloc& rhs) const {
+		return pool == rhs.pool;
+	}
+
+	static shard_pool* default_pool() {
+		static shard_pool pool;
+		return &pool;
+	}
+};
+
+#define ARENA_REQUEST_TEST(nodes, len1, len2, len3) do {					\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|        alloc        |";									\
+	request_test<mystl::alloc>(len1, nodes);								\
+	request_test<mystl::alloc>(len2, nodes);								\
+	request_test<mystl::alloc>(len3, nodes);								\
+	std::cout << "\n|   monotonic_alloc   |";								\
+	request_test<mystl::monotonic_alloc<0>>(len1, nodes);					\
+	request_test<mystl::monotonic_alloc<0>>(len2, nodes);					\
+	request_test<mystl::monotonic_alloc<0>>(len3, nodes);					\
+	std::cout << "\n|   pmr new_delete    |";								\
+	resource_request_test(mystl::new_delete_resource(), nullptr, len1, nodes);	\
+	resource_request_test(mystl::new_delete_resource(), nullptr, len2, nodes);	\
+	resource_request_test(mystl::new_delete_resource(), nullptr, len3, nodes);	\
+	std::cout << "\n|      pmr pool       |";								\
+	resource_request_test(mystl::pool_resource(), nullptr, len1, nodes);	\
+	resource_request_test(mystl::pool_resource(), nullptr, len2, nodes);	\
+	resource_request_test(mystl::pool_resource(), nullptr, len3, nodes);	\
+	std::cout << "\n|    pmr monotonic    |";								\
+	{																		\
+		mystl::monotonic_buffer_resource arena;								\
+		resource_request_test(&arena, &arena, len1, nodes);					\
+		resource_request_test(&arena, &arena, len2, nodes);					\
+		resource_request_test(&arena, &arena, len3, nodes);					\
+	}																		\
+	std::cout << "\n";														\
+} while(0)
+
+#define ALLOC_THREAD_TEST(nthreads, len1, len2, len3) do {					\
+	std::cout << "|      " << std::setw(2) << nthreads << " threads     |";	\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|        malloc       |";									\
+	alloc_thread_test<malloc_policy>(nthreads, len1);						\
+	alloc_thread_test<malloc_policy>(nthreads, len2);						\
+	alloc_thread_test<malloc_policy>(nthreads, len3);						\
+	std::cout << "\n|        mystl        |";								\
+	alloc_thread_test<alloc_policy>(nthreads, len1);						\
+	alloc_thread_test<alloc_policy>(nthreads, len2);						\
+	alloc_thread_test<alloc_policy>(nthreads, len3);						\
+	std::cout << "\n";														\
+} while(0)
+
+void alloc_test() {
+	std::cout << "[===============================================================]\n";
+	std::cout << "[----------------- Run allocator test : alloc ------------------]\n";
+	std::cout << "[-------------------------- API test ---------------------------]\n";
+
+	// ͬһ߳ͷ
+	void* p[16];
+	for (size_t i = 0; i < 16; i++) {
+		p[i] = mystl::alloc::allocate((i + 1) * 8);
+		std::memset(p[i], static_cast<int>(i), (i + 1) * 8);
+	}
+	for (size_t i = 0; i < 16; i++) {
+		FUN_VALUE(static_cast<int>(static_cast<unsigned char*>(p[i])[i * 8]));
+		mystl::alloc::deallocate(p[i], (i + 1) * 8);
+	}
+
+	// ͷźٴͬСʹ̻߳
+	void* q = mystl::alloc::allocate(32);
+	mystl::alloc::deallocate(q, 32);
+	std::cout << std::boolalpha;
+	FUN_VALUE(q == mystl::alloc::allocate(32));
+	std::cout << std::noboolalpha;
+	mystl::alloc::deallocate(q, 32);
+
+	// һ߳, һ߳ͷ, ֿͨص߳
+	const size_t count = 10000;
+	void** ptrs = static_cast<void**>(std::malloc(sizeof(void*) * count));
+	std::thread producer(cross_thread_worker<alloc_policy>, ptrs, count, true);
+	producer.join();
+	std::thread consumer(cross_thread_worker<alloc_policy>, ptrs, count, false);
+	consumer.join();
+	std::free(ptrs);
+	std::cout << " cross thread allocate / deallocate : " << count << " blocks\n";
+
+	// ʽtrim黹еslab
+	rss_after_map_test(LEN2);
+
+	// ֵֿ֮еĿ鳬ֵԶ黹
+	mystl::alloc::set_release_threshold(1 << 20);
+	rss_after_map_test(LEN2);
+	mystl::alloc::set_release_threshold(0);
+
+	// arena: ʲôҲ, reset֮ʹԭĿ
+	{
+		mystl::monotonic_buffer arena(1024);
+		void* a = arena.allocate(100);
+		arena.deallocate(a, 100);
+		void* b = arena.allocate(2000);
+		std::cout << " arena capacity : " << arena.capacity() << "\n";
+		arena.reset();
+		std::cout << std::boolalpha;
+		FUN_VALUE(a == arena.allocate(100));
+		FUN_VALUE(b == arena.allocate(2000));
+		std::cout << std::noboolalpha;
+		std::cout << " arena capacity after reset : " << arena.capacity() << "\n";
+	}
+	{
+		mystl::map<int, int, mystl::less<int>, mystl::monotonic_alloc<0>> m;
+		for (int i = 0; i < 5; i++)
+			m.insert(mystl::make_pair(i, i));
+		std::cout << " map with monotonic_alloc :";
+		for (auto it : m)
+			std::cout << " <" << it.first << ", " << it.second << ">";
+		std::cout << "\n";
+	}
+	mystl::monotonic_alloc<0>::reset();
+
+	// ״̬ķ: ÿԼķ, ĬϷռռ
+	FUN_VALUE(sizeof(mystl::vector<int>));
+	FUN_VALUE(sizeof(mystl::vector<int, shard_alloc>));
+	{
+		shard_pool pool1, pool2;
+		shard_alloc shard1(&pool1), shard2(&pool2);
+		{
+			mystl::vector<int, shard_alloc> v(shard1);
+			mystl::deque<int, shard_alloc> d(shard1);
+			mystl::list<int, shard_alloc> l(shard1);
+			mystl::map<int, int, mystl::less<int>, shard_alloc> m(shard1);
+			mystl::unordered_map<int, int, mystl::hash<int>, mystl::equal_to<int>, shard_alloc>
+				h(100, mystl::hash<int>(), mystl::equal_to<int>(), shard1);
+			for (int i = 0; i < 1000; i++) {
+				v.push_back(i);
+				d.push_front(i);
+				l.push_back(i);
+				m.insert(mystl::make_pair(i, i));
+				h.insert(mystl::make_pair(i, i));
+			}
+			std::cout << " shard 1 live bytes : " << pool1.live << "\n";
+
+			// Ƹֵ֮Ԫ, ʱķҲ
+			mystl::vector<int, shard_alloc> v2(shard2);
+			v2.push_back(1);
+			v2 = v;
+			std::cout << std::boolalpha;
+			FUN_VALUE(v2.get_allocator() == v.get_allocator());
+			mystl::list<int, shard_alloc> l2(shard2);
+			l2.push_back(1);
+			l2.swap(l);
+			FUN_VALUE(l2.get_allocator().pool == &pool1);
+			FUN_VALUE(l.get_allocator().pool == &pool2);
+			std::cout << std::noboolalpha;
+			std::cout << " shard 2 live bytes : " << pool2.live << "\n";
+		}
+		std::cout << " shard 1 live bytes after destroy : " << pool1.live << "\n";
+		std::cout << " shard 2 live bytes after destroy : " << pool2.live << "\n";
+	}
+
+	// ܴʱصslabͬPOOL_SLAB_BYTES, ȻallocĴСṩ
+	{
+		shard_pool pool;
+		{
+			mystl::map<int, big_value, mystl::less<int>, shard_alloc> m{ shard_alloc(&pool) };
+			for (int i = 0; i < 100; i++)
+				m.insert(mystl::make_pair(i, big_value()));
+			FUN_VALUE(m.size());
+		}
+		std::cout << std::boolalpha;
+		FUN_VALUE((pool.largest <= static_cast<size_t>(mystl::POOL_SLAB_BYTES)));
+		FUN_VALUE((pool.live == 0));
+		std::cout << std::noboolalpha;
+	}
+
+	// ̬ڴԴ: ͬһʱѡ
+	FUN_VALUE(sizeof(mystl::map<int, int, mystl::less<int>, mystl::polymorphic_alloc>));
+	{
+		mystl::monotonic_buffer_resource arena(4096);
+		{
+			mystl::polymorphic_alloc pa(&arena);
+			mystl::vector<int, mystl::polymorphic_alloc> v(pa);
+			mystl::map<int, int, mystl::less<int>, mystl::polymorphic_alloc> m(pa);
+			mystl::unordered_map<int, int, mystl::hash<int>, mystl::equal_to<int>, mystl::polymorphic_alloc>
+				h(100, mystl::hash<int>(), mystl::equal_to<int>(), pa);
+			for (int i = 0; i < 1000; i++) {
+				v.push_back(i);
+				m.insert(mystl::make_pair(i, i));
+				h.insert(mystl::make_pair(i, i));
+			}
+			std::cout << " arena resource capacity : " << arena.capacity() << "\n";
+
+			// ƹʹĬڴԴ, ƸֵıڴԴ
+			mystl::vector<int, mystl::polymorphic_alloc> v2(v);
+			std::cout << std::boolalpha;
+			FUN_VALUE(v2.get_allocator().resource() == mystl::pool_resource());
+			v2 = v;
+			FUN_VALUE(v2.get_allocator().resource() == mystl::pool_resource());
+			FUN_VALUE(v2.get_allocator() == v.get_allocator());
+
+			// assign(n, value)Ҫ·ռʱȻʹԼڴԴ
+			v.assign(5000, 7);
+			FUN_VALUE(v.get_allocator().resource() == &arena);
+			FUN_VALUE((v.size() == 5000 && v.back() == 7));
+			std::cout << std::noboolalpha;
+		}
+		arena.reset();
+
+		// лĬڴԴ֮, ĬϹʹµڴԴ
+		mystl::memory_resource* old = mystl::set_default_resource(&arena);
+		{
+			mystl::list<int, mystl::polymorphic_alloc> l;
+			for (int i = 0; i < 5; i++)
+				l.push_back(i);
+			std::cout << std::boolalpha;
+			FUN_VALUE(l.get_allocator().resource() == &arena);
+			std::cout << std::noboolalpha;
+			FUN_AFTER(l, l.push_front(-1));
+		}
+		mystl::set_default_resource(old);
+		std::cout << std::boolalpha;
+		FUN_VALUE(mystl::get_default_resource() == mystl::pool_resource());
+		std::cout << std::noboolalpha;
+	}
+
+	// stdͨmystl::allocatorʹalloc
+	{
+		std::vector<int, mystl::allocator<int>> v;
+		for (int i = 0; i < 1000; i++)
+			v.push_back(i);
+		FUN_VALUE(v[999]);
+	}
+
+	// ͳϢ, MYSTL_ALLOC_STATS֮зͻմ
+	{
+		mystl::map<int, int> m;
+		for (int i = 0; i < 1000; i++)
+			m.insert(mystl::make_pair(i, i));
+		mystl::alloc::dump_stats(std::cout);
+		mystl::alloc::dump_stats_json(std::cout);
+		std::cout << "\n";
+	}
+
+	PASSED;
+
+#if PERFORMANCE_TEST_ON
+	std::cout << "[--------------------- Performance Testing ---------------------]\n";
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+#if LARGE_DATA_TEST_ON
+	ALLOC_THREAD_TEST(1, L(LEN2), XL(LEN2), XL(LEN3));
+	ALLOC_THREAD_TEST(2, L(LEN2), XL(LEN2), XL(LEN3));
+	ALLOC_THREAD_TEST(4, L(LEN2), XL(LEN2), XL(LEN3));
+	ALLOC_THREAD_TEST(8, L(LEN2), XL(LEN2), XL(LEN3));
+	ALLOC_THREAD_TEST(16, L(LEN2), XL(LEN2), XL(LEN3));
+#else
+	ALLOC_THREAD_TEST(1, M(LEN2), L(LEN2), M(LEN3));
+	ALLOC_THREAD_TEST(2, M(LEN2), L(LEN2), M(LEN3));
+	ALLOC_THREAD_TEST(4, M(LEN2), L(LEN2), M(LEN3));
+	ALLOC_THREAD_TEST(8, M(LEN2), L(LEN2), M(LEN3));
+	ALLOC_THREAD_TEST(16, M(LEN2), L(LEN2), M(LEN3));
+#endif
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|  request (64 nodes) |";
+#if LARGE_DATA_TEST_ON
+	ARENA_REQUEST_TEST(64, XS(LEN2), XS(LEN3), M(LEN2));
+#else
+	ARENA_REQUEST_TEST(64, XXS(LEN1), XXS(LEN2), XXS(LEN3));
+#endif
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	PASSED;
+#endif
+	std::cout << "[----------------- End allocator test : alloc ------------------]\n";
+	std::cout << std::endl;
+	std::cout << std::endl;
+}
+
+	}	// alloc_test
+}	// mystl
+
+#endif
@@ -1,9 +1,15 @@
 #ifndef ALLOCATOR_H
 #define ALLOCATOR_H
 
+// std淶ķռmystl::alloc
+// stdҲʹmystlڴأstd::vector<int, mystl::allocator<int>>
+// mystlֱʹðֽڷallocҪ
+
 #include <cstddef>		// ptrdiff_t
-#include <iostream>
-#include <new.h>		// placement new
+#include <new>			// placement new, bad_alloc
+#include <utility>		// forward
+#include <type_traits>	// true_type
+#include "mystl_alloc.h"
 
 namespace mystl {
 
@@ -18,42 +24,46 @@ namespace mystl {
 		using size_type = size_t;
 		using difference_type = ptrdiff_t;
 
+		// allocֻо̬ԱжȣҪ
+		using propagate_on_container_move_assignment = std::true_type;
+		using is_always_equal = std::true_type;
+
 		template<class U>
 		struct rebind {
 			using other = allocator<U>;
 		};
 
-		allocator() {} noexcept;
-		allocator(const allocator& rhs)noexcept = default;
+		allocator() noexcept {};
+		allocator(const allocator& rhs) noexcept = default;
 		// copy캯
 		template<class U>
-		allocator(const allocator<U>& rhs)noexcept {};
-		~allocator()noexcept = default;
+		allocator(const allocator<U>& rhs) noexcept {};
+		~allocator() = default;
 
-		pointer address(reference x) {
-			return static_cast<pointer> &x;
+		pointer address(reference x) const {
+			return &x;
 		}
-		const_pointer address(const_reference x)const {
-			return static_cast<const_pointer> address(const_cast<x>);
+
+		const_pointer address(const_reference x) const {
+			return &x;
 		}
 
 		pointer allocate(size_type n, const void* = 0) {
-			if (0 == n) {
-				std::cout << "The size of allocate can't be 0\n";
+			if (0 == n)
 				return nullptr;
-			}
-			static_cast<pointer> ::operator new(n * sizeof(value_type));
+			if (n > max_size())
+				throw std::bad_alloc();
+			return static_cast<pointer>(alloc::allocate(n * sizeof(value_type)));
 		}
+
 		void deallocate(pointer p, size_type n) {
-			if (nullptr == p) {
-				std::cout << "The pointer to be destroyed can't be nullptr\n";
+			if (nullptr == p)
 				return;
-			}
-			::operator delete(p);
+			alloc::deallocate(p, n * sizeof(value_type));
 		}
 
-		size_type max_size()const {
-			return static_cast<size_type> (-1) / sizeof(value_type);
+		size_type max_size() const {
+			return static_cast<size_type>(-1) / sizeof(value_type);
 		}
 
 		template<class U, class... Args>
@@ -62,11 +72,21 @@ namespace mystl {
 		}
 
 		template<class U>
-		void destory(U* p) {
+		void destroy(U* p) {
 			p->~U();
 		}
 	};
 
+	template<class T, class U>
+	inline bool operator==(const allocator<T>&, const allocator<U>&) {
+		return true;
+	}
+
+	template<class T, class U>
+	inline bool operator!=(const allocator<T>&, const allocator<U>&) {
+		return false;
+	}
+
 }// mystl
 
-#endif
\ No newline at end of file
+#endif
@@ -9,18 +9,34 @@
 
 namespace mystl {
 
-// bufferĴС
-template<class T>
+// СnС2
+constexpr size_t deque_ceil_pow2(size_t n, size_t r = 1) {
+	return r >= n ? r : deque_ceil_pow2(n, r << 1);
+}
+
+constexpr size_t deque_log2(size_t n) {
+	return n <= 1 ? 0 : 1 + deque_log2(n >> 1);
+}
+
+// bufferĴС(Ԫظ)
+// Ԫظ2, λʱλȡģ
+// BufSizΪ0ʱʹĬֵ: 4KB, 16Ԫ
+template<class T, size_t BufSiz = 0>
 struct deque_buf_size {
-	static constexpr size_t value = sizeof(T) < 512 ? 512 / sizeof(T) : 1;
+	static_assert(0 == (BufSiz & (BufSiz - 1)), "deque buffer size must be a power of two");
+
+	static constexpr size_t value = BufSiz != 0 ? BufSiz
+		: (sizeof(T) > 4096 / 16 ? 16 : deque_ceil_pow2((4096 + sizeof(T) - 1) / sizeof(T)));
+	static constexpr size_t shift = deque_log2(value);
+	static constexpr size_t mask = value - 1;
 };
 
 // deque
-template<class T, class Ref, class Ptr>
+template<class T, class Ref, class Ptr, size_t BufSiz>
 struct deque_iterator : public iterator<random_iterator_tag, T> {
 	// typedef
-	typedef deque_iterator<T, T&, T*>							iterator;
-	typedef deque_iterator<T, const T&, const T*>				const_iterator;
+	typedef deque_iterator<T, T&, T*, BufSiz>					iterator;
+	typedef deque_iterator<T, const T&, const T*, BufSiz>		const_iterator;
 
 	typedef T													value_type;
 	typedef T*													pointer;
@@ -31,7 +47,9 @@ struct deque_iterator : public iterator<random_iterator_tag, T> {
 	typedef deque_iterator										self;
 	typedef T**													map_pointer;
 
-	static const size_type buf_size = deque_buf_size<T>::value;
+	static const size_type buf_size = deque_buf_size<T, BufSiz>::value;
+	static const size_type buf_shift = deque_buf_size<T, BufSiz>::shift;
+	static const size_type buf_mask = deque_buf_size<T, BufSiz>::mask;
 
 	// άĸָ
 	T* cur;
@@ -56,13 +74,12 @@ struct deque_iterator : public iterator<random_iterator_tag, T> {
 	}
 
 	// 
+	// curǷֵͬ: map·curnodeѾı
 	self& operator=(const iterator& rhs) {
-		if (rhs != *this) {
-			cur = rhs.cur;
-			first = rhs.first;
-			last = rhs.last;
-			node = rhs.node;
-		}
+		cur = rhs.cur;
+		first = rhs.first;
+		last = rhs.last;
+		node = rhs.node;
 		return *this;
 	}
 
@@ -113,15 +130,16 @@ struct deque_iterator : public iterator<random_iterator_tag, T> {
 	}
 
 	// עoffset_nodeϸںcurµϸ
+	// buf_size2, ƫλ(ȡ), ƫȡλ
 	self& operator+=(difference_type n) {
 		difference_type offset = cur - first + n;
 		if (offset >= 0 && offset < static_cast<difference_type>(buf_size))
 			cur += n;
 		else {
-			difference_type offset_node = offset > 0 ? (offset / static_cast<difference_type>(buf_size)) 
-				: -((-offset - 1) / static_cast<difference_type>(buf_size)) - 1;
+			difference_type offset_node = offset > 0 ? static_cast<difference_type>(static_cast<size_type>(offset) >> buf_shift)
+				: -static_cast<difference_type>(static_cast<size_type>(-offset - 1) >> buf_shift) - 1;
 			set_node(node + offset_node);
-			cur = first + (offset - offset_node * static_cast<difference_type>(buf_size));
+			cur = first + (static_cast<size_type>(offset) & buf_mask);
 		}
 		return *this;
 	}
@@ -172,12 +190,44 @@ struct deque_iterator : public iterator<random_iterator_tag, T> {
 
 };
 
+// dequeǷֶε, ÿָĻһ
+template<class T, class Ref, class Ptr, size_t BufSiz>
+struct segmented_iterator_traits<deque_iterator<T, Ref, Ptr, BufSiz>> {
+	typedef true_type								is_segmented_iterator;
+	typedef deque_iterator<T, Ref, Ptr, BufSiz>		iterator;
+	typedef T**										segment_iterator;
+	typedef Ptr										local_iterator;
+
+	static segment_iterator segment(const iterator& it) {
+		return it.node;
+	}
+
+	static local_iterator local(const iterator& it) {
+		return it.cur;
+	}
+
+	static local_iterator begin(segment_iterator seg) {
+		return *seg;
+	}
+
+	static local_iterator end(segment_iterator seg) {
+		return *seg + iterator::buf_size;
+	}
+
+	static iterator compose(segment_iterator seg, local_iterator local) {
+		iterator it;
+		it.set_node(seg);
+		it.cur = const_cast<T*>(local);
+		return it;
+	}
+};
+
 // deque
-template<class T, class Alloc = alloc>
-class deque {
+template<class T, class Alloc = alloc, size_t BufSiz = 0>
+class deque : private simple_alloc<T, Alloc> {
 public:
 	// 
-	typedef simple_alloc<T, Alloc>						allocator_type;
+	typedef Alloc										allocator_type;
 	typedef simple_alloc<T, Alloc>						data_allocator;
 	typedef simple_alloc<T*, Alloc>						map_allocator;
 
@@ -193,20 +243,24 @@ public:
 	typedef const pointer*								const_map_pointer;
 
 	// 
-	typedef deque_iterator<T, T&, T*>					iterator;
-	typedef deque_iterator<T, const T&, const T*>		const_iterator;
+	typedef deque_iterator<T, T&, T*, BufSiz>			iterator;
+	typedef deque_iterator<T, const T&, const T*, BufSiz>	const_iterator;
 	typedef reverse_iterator<const_iterator>			const_reverse_iterator;
 	typedef reverse_iterator<iterator>					reverse_iterator;
 
-	allocator_type get_allocator() {
-		return data_allocator();
+	allocator_type get_allocator() const {
+		return data_allocator::resource();
 	}
 
 protected:
 	// ĴС
-	static const size_type buffer_size = deque_buf_size<T>::value;
+	static const size_type buffer_size = deque_buf_size<T, BufSiz>::value;
+	static const size_type buffer_shift = deque_buf_size<T, BufSiz>::shift;
+	static const size_type buffer_mask = deque_buf_size<T, BufSiz>::mask;
 	// ʼĬϸ
 	const size_type initial_map_size = 8;
+	// ໺Ŀл
+	static const size_type spare_capacity = 2;
 
 private:
 	// άĸһdeque
@@ -214,25 +268,33 @@ private:
 	size_type map_size;
 	iterator start;
 	iterator finish;
+	// һͷŵĻȻ, һҪ»ʱȸ
+	// Ϊʹʱһpop_frontһpush_back, ȶ״̬²ͷŻ
+	pointer spare_nodes[spare_capacity];
+	size_type spare_count = 0;
 
 public:
 //------------------------------------------------졢ƺ------------------------------------------------
 	deque();
 
+	explicit deque(const Alloc& a);
+
 	deque(size_type n);
 
-	deque(size_type n, const value_type& value);
+	deque(size_type n, const value_type& value, const Alloc& a = Alloc());
 
 	deque(const deque& rhs);
 
-	deque(const std::initializer_list<T>& ilist);
+	deque(const deque& rhs, const Alloc& a);
+
+	deque(const std::initializer_list<T>& ilist, const Alloc& a = Alloc());
 
 	template<class InputIterator>
-	deque(InputIterator first, InputIterator last);
+	deque(InputIterator first, InputIterator last, const Alloc& a = Alloc());
 
-	deque(value_type* first, value_type* last);
+	deque(value_type* first, value_type* last, const Alloc& a = Alloc());
 
-	deque(const_iterator first, const_iterator last);
+	deque(const_iterator first, const_iterator last, const Alloc& a = Alloc());
 
 	~deque();
 
@@ -278,6 +340,9 @@ public:
 
 	void resize(size_type new_size);
 
+	// ͷŻĿл, mapСպн
+	void shrink_to_fit();
+
 	void swap(deque& rhs);
 
 
@@ -341,9 +406,35 @@ public:
 
 //-------------------------------------------------------------------------------------------------------------
 protected:
+// mapʹúͻͬķ
+	map_allocator map_alloc() const {
+		return map_allocator(data_allocator::resource());
+	}
+
 // ʼһmap(ÿռ)
 	void initialize_map(size_type num_elements);
 
+// ȡһ, ʹûĿл
+	pointer allocate_node() {
+		if (spare_count > 0)
+			return spare_nodes[--spare_count];
+		return data_allocator::allocate(buffer_size);
+	}
+
+// 黹һ, δʱ
+	void deallocate_node(pointer p) {
+		if (spare_count < spare_capacity)
+			spare_nodes[spare_count++] = p;
+		else
+			data_allocator::deallocate(p, buffer_size);
+	}
+
+// ͷлĿл
+	void release_spare_nodes() {
+		while (spare_count > 0)
+			data_allocator::deallocate(spare_nodes[--spare_count], buffer_size);
+	}
+
 // ʼ(ÿռ)
 	void create_nodes(map_pointer first, map_pointer last);
 
@@ -466,69 +557,95 @@ protected:
 
 
 //------------------------------------------------졢ƺ------------------------------------------------
-template<class T, class Alloc>
-deque<T, Alloc>::deque() {
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::deque() {
 	initialize_map(0);
 }
 
-template<class T, class Alloc>
-deque<T, Alloc>::deque(size_type n) {
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::deque(const Alloc& a) : data_allocator(a) {
+	initialize_map(0);
+}
+
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::deque(size_type n) {
 	initialize_map(n);
 	fill_initialize(T());
 }
 
-template<class T, class Alloc>
-deque<T, Alloc>::deque(size_type n, const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::deque(size_type n, const value_type& value, const Alloc& a) : data_allocator(a) {
 	initialize_map(n);
 	fill_initialize(value);
 }
 
-template<class T, class Alloc>
-deque<T, Alloc>::deque(const deque& rhs) {
+// ķselect_on_container_copy_construction
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::deque(const deque& rhs)
+	: data_allocator(data_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())) {
 	initialize_map(rhs.size());
 	mystl::uninitialized_copy(rhs.start, rhs.finish, start);
 }
 
-template<class T, class Alloc>
-deque<T, Alloc>::deque(const std::initializer_list<T>& ilist) {
-	size_type n = distance(ilist.begin(), ilist.end());
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::deque(const deque& rhs, const Alloc& a) : data_allocator(a) {
+	initialize_map(rhs.size());
+	mystl::uninitialized_copy(rhs.start, rhs.finish, start);
+}
+
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::deque(const std::initializer_list<T>& ilist, const Alloc& a) : data_allocator(a) {
+	size_type n = mystl::distance(ilist.begin(), ilist.end());
 	initialize_map(n);
 	mystl::uninitialized_copy(ilist.begin(), ilist.end(), start);
 }
 
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class InputIterator>
-deque<T, Alloc>::deque(InputIterator first, InputIterator last) {
+deque<T, Alloc, BufSiz>::deque(InputIterator first, InputIterator last, const Alloc& a) : data_allocator(a) {
 	typedef typename Is_integer<InputIterator>::value Integer;
 	initialize_dispatch(first, last, Integer());
 }
 
-template<class T, class Alloc>
-deque<T, Alloc>::deque(value_type* first, value_type* last) {
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::deque(value_type* first, value_type* last, const Alloc& a) : data_allocator(a) {
 	difference_type n = last - first;
 	initialize_map(n);
 	mystl::uninitialized_copy(first, last, start);
 }
 
-template<class T, class Alloc>
-deque<T, Alloc>::deque(const_iterator first, const_iterator last) {
-	difference_type n = distance(first, last);
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::deque(const_iterator first, const_iterator last, const Alloc& a) : data_allocator(a) {
+	difference_type n = mystl::distance(first, last);
 	initialize_map(n);
 	mystl::uninitialized_copy(first, last, start);
 }
 
-template<class T, class Alloc>
-deque<T, Alloc>::~deque() {
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>::~deque() {
 	mystl::destroy(start, finish);
 	if (map) {
 		destroy_nodes(start.node, finish.node + 1);
-		map_allocator::deallocate(map, map_size);
+		map_alloc().deallocate(map, map_size);
 	}
+	release_spare_nodes();
 }
 
-template<class T, class Alloc>
-deque<T, Alloc>& deque<T, Alloc>::operator=(const deque& rhs) {
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>& deque<T, Alloc, BufSiz>::operator=(const deque& rhs) {
 	if (&rhs != this) {
+		// Ҫɲȵķ, þɵķͷлmap
+		if (data_allocator::replaced_on_copy(rhs)) {
+			mystl::destroy(start, finish);
+			destroy_nodes(start.node, finish.node + 1);
+			release_spare_nodes();
+			map_alloc().deallocate(map, map_size);
+			data_allocator::propagate_copy(rhs);
+			initialize_map(0);
+		}
+		else {
+			data_allocator::propagate_copy(rhs);
+		}
 		const auto len = size();
 		if (size() >= rhs.size()) {
 			erase(mystl::copy(rhs.begin(), rhs.end(), start), finish);
@@ -542,108 +659,108 @@ deque<T, Alloc>& deque<T, Alloc>::operator=(const deque& rhs) {
 	return *this;
 }
 
-template<class T, class Alloc>
-deque<T, Alloc>& deque<T, Alloc>::operator=(const std::initializer_list<T>& ilist) {
-	deque temp(ilist);
+template<class T, class Alloc, size_t BufSiz>
+deque<T, Alloc, BufSiz>& deque<T, Alloc, BufSiz>::operator=(const std::initializer_list<T>& ilist) {
+	deque temp(ilist, get_allocator());
 	swap(temp);
 	return *this;
 }
 
 
 //------------------------------------------------غ------------------------------------------------
-template<class T, class Alloc>
-typename deque<T, Alloc>::iterator
-deque<T, Alloc>::begin() {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::iterator
+deque<T, Alloc, BufSiz>::begin() {
 	return start;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_iterator
-deque<T, Alloc>::begin() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_iterator
+deque<T, Alloc, BufSiz>::begin() const {
 	return start;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::iterator
-deque<T, Alloc>::end() {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::iterator
+deque<T, Alloc, BufSiz>::end() {
 	return finish;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_iterator
-deque<T, Alloc>::end() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_iterator
+deque<T, Alloc, BufSiz>::end() const {
 	return finish;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::reverse_iterator
-deque<T, Alloc>::rbegin() {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::reverse_iterator
+deque<T, Alloc, BufSiz>::rbegin() {
 	return reverse_iterator(end());
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_reverse_iterator
-deque<T, Alloc>::rbegin() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_reverse_iterator
+deque<T, Alloc, BufSiz>::rbegin() const {
 	return reverse_iterator(end());
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::reverse_iterator
-deque<T, Alloc>::rend() {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::reverse_iterator
+deque<T, Alloc, BufSiz>::rend() {
 	return reverse_iterator(begin());
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_reverse_iterator
-deque<T, Alloc>::rend() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_reverse_iterator
+deque<T, Alloc, BufSiz>::rend() const {
 	return reverse_iterator(begin());
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_iterator
-deque<T, Alloc>::cbegin() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_iterator
+deque<T, Alloc, BufSiz>::cbegin() const {
 	return begin();
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_iterator
-deque<T, Alloc>::cend() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_iterator
+deque<T, Alloc, BufSiz>::cend() const {
 	return end();
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_reverse_iterator
-deque<T, Alloc>::crbegin() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_reverse_iterator
+deque<T, Alloc, BufSiz>::crbegin() const {
 	return rbegin();
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_reverse_iterator
-deque<T, Alloc>::crend() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_reverse_iterator
+deque<T, Alloc, BufSiz>::crend() const {
 	return rend();
 }
 
 
 //------------------------------------------------غ------------------------------------------------
-template<class T, class Alloc>
-bool deque<T, Alloc>::empty() const {
+template<class T, class Alloc, size_t BufSiz>
+bool deque<T, Alloc, BufSiz>::empty() const {
 	return start == finish;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::size_type
-deque<T, Alloc>::size() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::size_type
+deque<T, Alloc, BufSiz>::size() const {
 	return finish - start;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::size_type
-deque<T, Alloc>::max_size() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::size_type
+deque<T, Alloc, BufSiz>::max_size() const {
 	return static_cast<size_type>(-1);
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::resize(size_type new_size, const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::resize(size_type new_size, const value_type& value) {
 	if (new_size < size())
 		erase(start + static_cast<difference_type>(new_size), finish);
 	else {
@@ -651,72 +768,97 @@ void deque<T, Alloc>::resize(size_type new_size, const value_type& value) {
 	}
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::resize(size_type new_size) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::resize(size_type new_size) {
 	resize(new_size, T());
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::swap(deque<T, Alloc>& rhs) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::swap(deque<T, Alloc, BufSiz>& rhs) {
+	data_allocator::propagate_swap(rhs);
 	mystl::swap(start, rhs.start);
 	mystl::swap(finish, rhs.finish);
 	mystl::swap(map, rhs.map);
 	mystl::swap(map_size, rhs.map_size);
+	for (size_type i = 0; i < spare_capacity; ++i)
+		mystl::swap(spare_nodes[i], rhs.spare_nodes[i]);
+	mystl::swap(spare_count, rhs.spare_count);
+}
+
+
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::shrink_to_fit() {
+	release_spare_nodes();
+	const size_type num_nodes = finish.node - start.node + 1;
+	const size_type new_map_size = mystl::max(num_nodes + 2, initial_map_size);
+	if (new_map_size < map_size) {
+		map_pointer new_map = map_alloc().allocate(new_map_size);
+		map_pointer new_start = new_map + (new_map_size - num_nodes) / 2;
+		mystl::copy(start.node, finish.node + 1, new_start);
+		map_alloc().deallocate(map, map_size);
+		map = new_map;
+		map_size = new_map_size;
+		start.set_node(new_start);
+		finish.set_node(new_start + num_nodes - 1);
+	}
 }
 
 
 //------------------------------------------------------Ԫغ-------------------------------------------------------
-template<class T, class Alloc>
-typename deque<T, Alloc>::reference
-deque<T, Alloc>::operator[](difference_type n) {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::reference
+deque<T, Alloc, BufSiz>::operator[](difference_type n) {
 	assert(n < size());
-	return start[n];
+	// startڽƫ, λǽ±, λǽ±
+	const size_type offset = static_cast<size_type>(n + (start.cur - start.first));
+	return start.node[offset >> buffer_shift][offset & buffer_mask];
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_reference
-deque<T, Alloc>::operator[](difference_type n) const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_reference
+deque<T, Alloc, BufSiz>::operator[](difference_type n) const {
 	assert(n < size());
-	return start[n];
+	const size_type offset = static_cast<size_type>(n + (start.cur - start.first));
+	return start.node[offset >> buffer_shift][offset & buffer_mask];
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::reference
-deque<T, Alloc>::at(difference_type n) {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::reference
+deque<T, Alloc, BufSiz>::at(difference_type n) {
 	assert(n < size());
 	return (*this)[n];
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_reference
-deque<T, Alloc>::at(difference_type n) const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_reference
+deque<T, Alloc, BufSiz>::at(difference_type n) const {
 	assert(n < size());
 	return (*this)[n];
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::reference
-deque<T, Alloc>::front() {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::reference
+deque<T, Alloc, BufSiz>::front() {
 	return *start;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_reference
-deque<T, Alloc>::front() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_reference
+deque<T, Alloc, BufSiz>::front() const {
 	return *start;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::reference
-deque<T, Alloc>::back() {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::reference
+deque<T, Alloc, BufSiz>::back() {
 	iterator temp = finish;
 	--temp;
 	return *temp;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::const_reference
-deque<T, Alloc>::back() const {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::const_reference
+deque<T, Alloc, BufSiz>::back() const {
 	iterator temp = finish;
 	--temp;
 	return *temp;
@@ -724,25 +866,25 @@ deque<T, Alloc>::back() const {
 
 
 //------------------------------------------------------޸غ-------------------------------------------------------
-template<class T, class Alloc>
-void deque<T, Alloc>::assign(size_type n, const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::assign(size_type n, const value_type& value) {
 	fill_assign(n, value);
 }
 
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class InputIterator>
-void deque<T, Alloc>::assign(InputIterator first, InputIterator last) {
+void deque<T, Alloc, BufSiz>::assign(InputIterator first, InputIterator last) {
 	typedef typename Is_integer<InputIterator>::value Integer;
 	assign_dispatch(first, last, Integer());
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::assign(std::initializer_list<T>& ilist) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::assign(std::initializer_list<T>& ilist) {
 	assign_aux(ilist.begin(), ilist.end(), forward_iterator_tag);
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::push_back(const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::push_back(const value_type& value) {
 	if (finish.cur != finish.last - 1) {
 		mystl::construct(finish.cur, value);
 		++finish.cur;
@@ -751,8 +893,8 @@ void deque<T, Alloc>::push_back(const value_type& value) {
 		push_back_aux(value);
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::push_back() {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::push_back() {
 	if (finish.cur != finish.last - 1) {
 		mystl::construct(finish.cur);
 		++finish.cur;
@@ -761,28 +903,28 @@ void deque<T, Alloc>::push_back() {
 		push_back_aux();
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::push_front(const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::push_front(const value_type& value) {
 	if (start.cur != start.first) {
+		mystl::construct(start.cur - 1, value);
 		--start.cur;
-		mystl::construct(start.cur, value);
 	}
 	else
 		push_front_aux(value);
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::push_front() {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::push_front() {
 	if (start.cur != start.first) {
+		mystl::construct(start.cur - 1);
 		--start.cur;
-		mystl::construct(start.cur);
 	}
 	else
 		push_front_aux();
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::pop_back() {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::pop_back() {
 	if (finish.cur != finish.first) {
 		--finish.cur;
 		mystl::destroy(finish.cur);
@@ -791,8 +933,8 @@ void deque<T, Alloc>::pop_back() {
 		pop_back_aux();
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::pop_front() {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::pop_front() {
 	if (start.cur != start.last - 1) {
 		mystl::destroy(start.cur);
 		++start.cur;
@@ -801,9 +943,9 @@ void deque<T, Alloc>::pop_front() {
 		pop_front_aux();
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::iterator
-deque<T, Alloc>::insert(iterator position, const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::iterator
+deque<T, Alloc, BufSiz>::insert(iterator position, const value_type& value) {
 	if (position.cur == start.cur) {
 		push_front(value);
 		return start;
@@ -818,27 +960,27 @@ deque<T, Alloc>::insert(iterator position, const value_type& value) {
 		return insert_aux(position, value);
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::iterator
-deque<T, Alloc>::insert(iterator position) {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::iterator
+deque<T, Alloc, BufSiz>::insert(iterator position) {
 	return insert(position, T());
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::insert(iterator position, size_type n, const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::insert(iterator position, size_type n, const value_type& value) {
 	fill_insert(position, n, value);
 }
 
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class InputIterator>
-void deque<T, Alloc>::insert(iterator position, InputIterator first, InputIterator last) {
+void deque<T, Alloc, BufSiz>::insert(iterator position, InputIterator first, InputIterator last) {
 	typedef typename Is_integer<InputIterator>::value Integer;
 	insert_dispatch(position, first, last, Integer());
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::insert(iterator position, const value_type* first, const value_type* last) {
-	difference_type n = distance(first, last);
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::insert(iterator position, const value_type* first, const value_type* last) {
+	difference_type n = mystl::distance(first, last);
 	if (position.cur == start.cur) {
 		iterator new_start = reserve_elements_at_front(n);
 		try {
@@ -863,9 +1005,9 @@ void deque<T, Alloc>::insert(iterator position, const value_type* first, const v
 		insert_aux(position, first, last, n);
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::insert(iterator position, const_iterator first, const_iterator last) {
-	difference_type n = distance(first, last);
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::insert(iterator position, const_iterator first, const_iterator last) {
+	difference_type n = mystl::distance(first, last);
 	if (position.cur == start.cur) {
 		iterator new_start = reserve_elements_at_front(n);
 		try {
@@ -890,9 +1032,9 @@ void deque<T, Alloc>::insert(iterator position, const_iterator first, const_iter
 		insert_aux(position, first, last, n);
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::iterator
-deque<T, Alloc>::erase(iterator position) {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::iterator
+deque<T, Alloc, BufSiz>::erase(iterator position) {
 	iterator next = position;
 	++next;
 	size_type index = position - start;
@@ -907,9 +1049,9 @@ deque<T, Alloc>::erase(iterator position) {
 	return start + index;
 }
 
-template<class T, class Alloc>
-typename deque<T, Alloc>::iterator
-deque<T, Alloc>::erase(iterator first, iterator last) {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::iterator
+deque<T, Alloc, BufSiz>::erase(iterator first, iterator last) {
 	if (first.cur == start.cur && last.cur == finish.cur) {
 		clear();
 		return finish;
@@ -933,16 +1075,16 @@ deque<T, Alloc>::erase(iterator first, iterator last) {
 	return start + elems_before;
 }
 
-template<class T, class Alloc>
-void deque<T, Alloc>::clear() {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::clear() {
 	for (map_pointer node = start.node + 1; node < finish.node; ++node) {
 		mystl::destroy(*node, *node + buffer_size);
-		data_allocator::deallocate(*node, buffer_size);
+		deallocate_node(*node);
 	}
 	if (start.node != finish.node) {
 		mystl::destroy(start.cur, start.last);
 		mystl::destroy(finish.first, finish.cur);
-		data_allocator::deallocate(finish.first, buffer_size);
+		deallocate_node(finish.first);
 	}
 	else
 		mystl::destroy(start.cur, finish.cur);
@@ -953,38 +1095,38 @@ void deque<T, Alloc>::clear() {
 //-------------------------------------------------------------------------------------------------------------
 // ʼdeque(ֻǷռ)
 // úǹ캯
-template<class T, class Alloc>
-void deque<T, Alloc>::initialize_map(size_type num_elements) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::initialize_map(size_type num_elements) {
 	// һnode
-	size_type num_nodes = num_elements / buffer_size + 1;
+	size_type num_nodes = (num_elements >> buffer_shift) + 1;
 	// ǰԤһʱʹ
 	map_size = mystl::max(num_nodes + 2, initial_map_size);
-	map = map_allocator::allocate(map_size);
+	map = map_alloc().allocate(map_size);
 	map_pointer nstart = map + (map_size - num_nodes) / 2;
 	map_pointer nfinish = nstart + num_nodes;
 	try {
 		create_nodes(nstart, nfinish);
 	}
 	catch (...) {
-		map_allocator::deallocate(map, map_size);
+		map_alloc().deallocate(map, map_size);
 		map = nullptr;
 		map_size = 0;
 	}
 	start.set_node(nstart);
 	finish.set_node(nfinish - 1);
 	start.cur = start.first;
-	finish.cur = finish.first + num_elements % buffer_size;
+	finish.cur = finish.first + (num_elements & buffer_mask);
 }
 
 // ʼ(ֻǷռ)
 // úУ
 // 1. initialize_map(num_elements) -> create_nodes
-template<class T, class Alloc>
-void deque<T, Alloc>::create_nodes(map_pointer first, map_pointer last) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::create_nodes(map_pointer first, map_pointer last) {
 	map_pointer cur = first;
 	try {
 		for (; cur < last; ++cur)
-			*cur = data_allocator::allocate(buffer_size);
+			*cur = allocate_node();
 	}
 	catch (...) {
 		destroy_nodes(first, cur);
@@ -994,17 +1136,17 @@ void deque<T, Alloc>::create_nodes(map_pointer first, map_pointer last) {
 // 
 // úУ
 // 1. initialize_map(num_elements) -> create_nodes(first, last) -> destroy_nodes
-template<class T, class Alloc>
-void deque<T, Alloc>::destroy_nodes(map_pointer first, map_pointer last) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::destroy_nodes(map_pointer first, map_pointer last) {
 	for (map_pointer cur = first; cur != last; ++cur)
-		data_allocator::deallocate(*cur, buffer_size);
+		deallocate_node(*cur);
 }
 
 // Ԫؽиֵ
 // úУ
 // 1. 캯
-template<class T, class Alloc>
-void deque<T, Alloc>::fill_initialize(const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::fill_initialize(const value_type& value) {
 	map_pointer cur = start.node;
 	try {
 		for (; cur < finish.node; ++cur) {
@@ -1020,9 +1162,9 @@ void deque<T, Alloc>::fill_initialize(const value_type& value) {
 // ģ幹캯ģΪʱô˺
 // úУ
 // 1. deque(n, value) -> initialize_dispatch
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class Integer>
-void deque<T, Alloc>::initialize_dispatch(Integer n, Integer value, true_type) {
+void deque<T, Alloc, BufSiz>::initialize_dispatch(Integer n, Integer value, true_type) {
 	initialize_map(n);
 	fill_initialize(value);
 }
@@ -1030,9 +1172,9 @@ void deque<T, Alloc>::initialize_dispatch(Integer n, Integer value, true_type) {
 // input iterator汾ĸ캯
 // úУ
 // 1. deque(first, last) -> initialize_dispatch(first, last, false_type) -> range_initialize
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class InputIterator>
-void deque<T, Alloc>::range_initialize(InputIterator first, InputIterator last, input_iterator_tag) {
+void deque<T, Alloc, BufSiz>::range_initialize(InputIterator first, InputIterator last, input_iterator_tag) {
 	initialize_map(0);
 	try {
 		for (; first != last; ++first)
@@ -1046,32 +1188,32 @@ void deque<T, Alloc>::range_initialize(InputIterator first, InputIterator last,
 // forward iterator汾ĸ캯
 // úУ
 // 1. deque(first, last) -> initialize_dispatch(first, last, false_type) -> range_initialize
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class ForwardIterator>
-void deque<T, Alloc>::range_initialize(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
-	size_type n = distance(first, last);
+void deque<T, Alloc, BufSiz>::range_initialize(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type n = mystl::distance(first, last);
 	initialize_map(n);
 	map_pointer cur = start.node;
 	try {
 		iterator mid = start;
 		for (; cur < finish.node; ++cur) {
-			advance(mid, buffer_size);
+			mystl::advance(mid, buffer_size);
 			mystl::uninitialized_copy(first, mid, *cur);
 			first = mid;
 		}
 		mystl::uninitialized_copy(first, last, finish.first);
 	}
 	catch (...) {
-		destroy(start, iterator(*cur, cur));
+		mystl::destroy(start, iterator(*cur, cur));
 	}
 }
 
 // ģ幹캯ģʱô˺
 // úУ
 // 1. deque(first, last) -> initialize_dispatch 
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class InputIterator>
-void deque<T, Alloc>::initialize_dispatch(InputIterator first, InputIterator last, false_type) {
+void deque<T, Alloc, BufSiz>::initialize_dispatch(InputIterator first, InputIterator last, false_type) {
 	range_initialize(first, last, iterator_category(first));
 }
 
@@ -1079,16 +1221,11 @@ void deque<T, Alloc>::initialize_dispatch(InputIterator first, InputIterator las
 // úУ
 // 1. assign(n, value) -> fill_assign
 // 2. assign(first, last) -> assign_dispatch(n, value, true_type) -> fill_assign
-template<class T, class Alloc>
-void deque<T, Alloc>::fill_assign(size_type n, const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::fill_assign(size_type n, const value_type& value) {
 	if (n > size()) {
 		mystl::fill(begin(), end(), value);
 		insert(end(), n - size(), value);
-		std::cout << "After insert: ";
-		for (auto it = begin(); it != end(); ++it) {
-			std::cout << *it << " ";
-		}
-		std::cout << std::endl;
 	}
 	else {
 		mystl::fill(begin(), begin() + n, value);
@@ -1099,27 +1236,27 @@ void deque<T, Alloc>::fill_assign(size_type n, const value_type& value) {
 // ģʱģ庯assignõĺ
 // úУ
 // 1. assign(first, last) -> assign_dispatch
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class Integer>
-void deque<T, Alloc>::assign_dispatch(Integer n, Integer value, true_type) {
+void deque<T, Alloc, BufSiz>::assign_dispatch(Integer n, Integer value, true_type) {
 	fill_assign(n, value);
 }
 
 // ģʱģ庯assignõĺ
 // úУ
 // 1. assign(first, last) -> assign_dispatch
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class InputIterator>
-void deque<T, Alloc>::assign_dispatch(InputIterator first, InputIterator last, false_type) {
+void deque<T, Alloc, BufSiz>::assign_dispatch(InputIterator first, InputIterator last, false_type) {
 	assign_aux(first, last, iterator_category(first));
 }
 
 // ģʱõĺ(input iterator汾)
 // úУ
 // 1. assign(first, last) -> assign_dispatch(first, last, false_type) -> assign_aux
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class InputIterator>
-void deque<T, Alloc>::assign_aux(InputIterator first, InputIterator last, input_iterator_tag) {
+void deque<T, Alloc, BufSiz>::assign_aux(InputIterator first, InputIterator last, input_iterator_tag) {
 	iterator cur = begin();
 	for (; first != last && cur != end(); ++first, ++cur)
 		*cur = *first;
@@ -1134,13 +1271,13 @@ void deque<T, Alloc>::assign_aux(InputIterator first, InputIterator last, input_
 // ģʱõĺ(forward iterator汾)
 // úУ
 // 1. assign(first, last) -> assign_dispatch(first, last, false_type) -> assign_aux
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class ForwardIterator>
-void deque<T, Alloc>::assign_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
-	size_type n = distance(first, last);
+void deque<T, Alloc, BufSiz>::assign_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type n = mystl::distance(first, last);
 	if (n > size()) {
 		ForwardIterator mid = first;
-		advance(mid, size());
+		mystl::advance(mid, size());
 		mystl::copy(first, mid, begin());
 		insert(end(), mid, last);
 	}
@@ -1152,44 +1289,46 @@ void deque<T, Alloc>::assign_aux(ForwardIterator first, ForwardIterator last, fo
 // push_backĸ(ֻеfinish.cur == finish.last - 1ʱ)
 // úУ
 // 1. push_back(value) -> push_back_aux
-template<class T, class Alloc>
-void deque<T, Alloc>::push_back_aux(const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::push_back_aux(const value_type& value) {
 	reserve_map_at_back();
-	*(finish.node + 1) = data_allocator::allocate(buffer_size);
+	*(finish.node + 1) = allocate_node();
 	try {
 		mystl::construct(finish.cur, value);
 		finish.set_node(finish.node + 1);
 		finish.cur = finish.first;
 	}
 	catch (...) {
-		mystl::destroy(*(finish.node + 1));
+		deallocate_node(*(finish.node + 1));
+		throw;
 	}
 }
 
 // push_backĸ(ֻеfinish.cur == finish.last - 1ʱ)
 // úУ
 // 1. push_back() -> push_back_aux
-template<class T, class Alloc>
-void deque<T, Alloc>::push_back_aux() {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::push_back_aux() {
 	reserve_map_at_back();
-	*(finish.node + 1) = data_allocator::allocate(buffer_size);
+	*(finish.node + 1) = allocate_node();
 	try {
 		mystl::construct(finish.cur);
 		finish.set_node(finish.node + 1);
 		finish.cur = finish.first;
 	}
 	catch (...) {
-		mystl::destroy(*(finish.node + 1));
+		deallocate_node(*(finish.node + 1));
+		throw;
 	}
 }
 
 // push_frontĸ(ֻеstart.cur == start.firstʱ)
 // úУ
 // 1. push_front(value) -> push_front_aux
-template<class T, class Alloc>
-void deque<T, Alloc>::push_front_aux(const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::push_front_aux(const value_type& value) {
 	reserve_map_at_front();
-	*(start.node - 1) = data_allocator::allocate(buffer_size);
+	*(start.node - 1) = allocate_node();
 	try {
 		start.set_node(start.node - 1);
 		start.cur = start.last - 1;
@@ -1197,17 +1336,18 @@ void deque<T, Alloc>::push_front_aux(const value_type& value) {
 	}
 	catch (...) {
 		++start;
-		mystl::destroy(*(start.node - 1));
+		deallocate_node(*(start.node - 1));
+		throw;
 	}
 }
 
 // push_frontĸ(ֻеstart.cur == start.firstʱ)
 // úУ
 // 1. push_front() -> push_front_aux
-template<class T, class Alloc>
-void deque<T, Alloc>::push_front_aux() {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::push_front_aux() {
 	reserve_map_at_front();
-	*(start.node - 1) = data_allocator::allocate(buffer_size);
+	*(start.node - 1) = allocate_node();
 	try {
 		start.set_node(start.node - 1);
 		start.cur = start.last - 1;
@@ -1215,7 +1355,8 @@ void deque<T, Alloc>::push_front_aux() {
 	}
 	catch (...) {
 		++start;
-		mystl::destroy(*(start.node - 1));
+		deallocate_node(*(start.node - 1));
+		throw;
 	}
 }
 
@@ -1224,8 +1365,8 @@ void deque<T, Alloc>::push_front_aux() {
 // 1. push_back(value) -> push_back_aux(value) -> reserve_map_at_back
 // 2. push_back() -> push_back_aux() -> reserve_map_at_back
 // 3. insert(n, value) -> fill_insert(n, value) -> reverse_elements_at_back(new_elements) -> new_elements_at_back(new_elements) -> reserve_map_at_back
-template<class T, class Alloc>
-void deque<T, Alloc>::reserve_map_at_back(size_type nodes_to_add) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::reserve_map_at_back(size_type nodes_to_add) {
 	if (nodes_to_add + 1 > map_size - (finish.node - map))
 		reallocate_map(nodes_to_add, false);
 }
@@ -1235,8 +1376,8 @@ void deque<T, Alloc>::reserve_map_at_back(size_type nodes_to_add) {
 // 1. push_front(value) -> push_front_aux(value) -> reserve_map_at_front
 // 2. push_front() -> push_front_aux() -> reserve_map_at_front
 // 3. insert(n, value) -> fill_insert(n, value) -> reverse_elements_at_front(new_elements) -> new_elements_at_front(new_elements) -> reserve_map_at_front
-template<class T, class Alloc>
-void deque<T, Alloc>::reserve_map_at_front(size_type nodes_to_add) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::reserve_map_at_front(size_type nodes_to_add) {
 	if (nodes_to_add > static_cast<size_type>(start.node - map))
 		reallocate_map(nodes_to_add, true);
 }
@@ -1249,8 +1390,8 @@ void deque<T, Alloc>::reserve_map_at_front(size_type nodes_to_add) {
 // 4. push_front() -> push_front_aux() -> reserve_map_at_front(nodes_to_add, true) -> reallocate_map
 // 5. insert(n, value) -> fill_insert(n, value) -> reverse_elements_at_back(new_elements) -> new_elements_at_back(new_elements) -> reserve_map_at_back(nodes_to_add) -> reallocate_map
 // 3. insert(n, value) -> fill_insert(n, value) -> reverse_elements_at_front(new_elements) -> new_elements_at_front(new_elements) -> reserve_map_at_front(nodes_to_add) -> reallocate_map
-template<class T, class Alloc>
-void deque<T, Alloc>::reallocate_map(size_type nodes_to_add, bool add_at_front) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::reallocate_map(size_type nodes_to_add, bool add_at_front) {
 	size_type old_num_nodes = finish.node - start.node + 1;
 	size_type new_num_nodes = old_num_nodes + nodes_to_add;
 	map_pointer new_start;
@@ -1263,12 +1404,18 @@ void deque<T, Alloc>::reallocate_map(size_type nodes_to_add, bool add_at_front)
 			mystl::copy_backward(start.node, finish.node + 1, new_start + old_num_nodes);
 		}
 	}
+	// mapбָ룬ʹreallocateչ
+	// mapԭչȻֻҪѽָƶmapм
 	else {
 		size_type new_map_size = map_size + mystl::max(map_size, new_num_nodes ) + 2;
-		map_pointer new_map = map_allocator::allocate(new_map_size);
+		size_type offset = start.node - map;
+		map_pointer new_map = map_alloc().reallocate(map, map_size, new_map_size);
+		map_pointer old_start = new_map + offset;
 		new_start = new_map + (new_map_size - new_num_nodes) / 2 + (add_at_front ? nodes_to_add : 0);
-		mystl::copy(start.node, finish.node + 1, new_start);
-		map_allocator::deallocate(map, map_size);
+		if (new_start < old_start)
+			mystl::copy(old_start, old_start + old_num_nodes, new_start);
+		else
+			mystl::copy_backward(old_start, old_start + old_num_nodes, new_start + old_num_nodes);
 		map = new_map;
 		map_size = new_map_size;
 	}
@@ -1279,9 +1426,9 @@ void deque<T, Alloc>::reallocate_map(size_type nodes_to_add, bool add_at_front)
 // pop_backĸ(ֻfinish.cur == finish.firstʱ)
 // úУ
 // 1. pop_back() -> pop_back_aux()
-template<class T, class Alloc>
-void deque<T, Alloc>::pop_back_aux() {
-	data_allocator::deallocate(finish.first, buffer_size);
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::pop_back_aux() {
+	deallocate_node(finish.first);
 	finish.set_node(finish.node - 1);
 	finish.cur = finish.last - 1;
 	mystl::destroy(finish.cur);
@@ -1290,10 +1437,10 @@ void deque<T, Alloc>::pop_back_aux() {
 // pop_frontĸ(ֻstart.cur == start.firstʱ)
 // úУ
 // 1. pop_front() -> pop_front_aux()
-template<class T, class Alloc>
-void deque<T, Alloc>::pop_front_aux() {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::pop_front_aux() {
 	mystl::destroy(start.cur);
-	data_allocator::deallocate(start.cur, buffer_size);
+	deallocate_node(start.first);
 	start.set_node(start.node + 1);
 	start.cur = start.first;
 }
@@ -1301,9 +1448,9 @@ void deque<T, Alloc>::pop_front_aux() {
 // һԪصĸ
 // úУ
 // 1. insert(position, value) -> insert_aux
-template<class T, class Alloc>
-typename deque<T, Alloc>::iterator
-deque<T, Alloc>::insert_aux(iterator position, const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::iterator
+deque<T, Alloc, BufSiz>::insert_aux(iterator position, const value_type& value) {
 	size_type index = position - start;
 	if (index < size() / 2) {
 		push_front(front());
@@ -1332,8 +1479,8 @@ deque<T, Alloc>::insert_aux(iterator position, const value_type& value) {
 // ͬԪصĸ
 // úУ
 // 1. insert(position, n, value) -> fill_insert
-template<class T, class Alloc>
-void deque<T, Alloc>::fill_insert(iterator position, size_type n, const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::fill_insert(iterator position, size_type n, const value_type& value) {
 	if (position.cur == start.cur) {
 		iterator new_start = reserve_elements_at_front(n);
 		try {
@@ -1361,68 +1508,70 @@ void deque<T, Alloc>::fill_insert(iterator position, size_type n, const value_ty
 // ͷԪصĸ
 // úУ
 // 1. insert(n, value) -> fill_insert(n, value) -> reverse_elements_at_front
-template<class T, class Alloc>
-typename deque<T, Alloc>::iterator
-deque<T, Alloc>::reserve_elements_at_front(size_type new_elements) {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::iterator
+deque<T, Alloc, BufSiz>::reserve_elements_at_front(size_type new_elements) {
 	size_type vacancies = static_cast<size_type>(start.cur - start.first);
 	if (vacancies < new_elements)
-		new_elements_at_front(new_elements);
+		new_elements_at_front(new_elements - vacancies);
 	return start - static_cast<difference_type>(new_elements);
 }
 
 // β˲Ԫصĸ
 // úУ
 // 1. insert(n, value) -> fill_insert(n, value) -> reverse_elements_at_back
-template<class T, class Alloc>
-typename deque<T, Alloc>::iterator
-deque<T, Alloc>::reserve_elements_at_back(size_type new_elements) {
+template<class T, class Alloc, size_t BufSiz>
+typename deque<T, Alloc, BufSiz>::iterator
+deque<T, Alloc, BufSiz>::reserve_elements_at_back(size_type new_elements) {
 	size_type vacancies = static_cast<size_type>(finish.last - finish.cur - 1);
 	if (vacancies < new_elements)
-		new_elements_at_back(new_elements);
+		new_elements_at_back(new_elements - vacancies);
 	return finish + static_cast<difference_type>(new_elements);
 }
 
 // ͷĸ
 // úУ
 // 1. insert(n, value) -> fill_insert(n, value) -> reverse_elements_at_front(new_elements) -> new_elements_at_front
-template<class T, class Alloc>
-void deque<T, Alloc>::new_elements_at_front(size_type new_elements) {
-	size_type new_nodes = (new_elements - 1) / buffer_size + 1;
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::new_elements_at_front(size_type new_elements) {
+	size_type new_nodes = ((new_elements - 1) >> buffer_shift) + 1;
 	reserve_map_at_front(new_nodes);
 	size_type i = 1;
 	try {
 		for (; i <= new_nodes; ++i)
-			*(start.node - i) = data_allocator::allocate(buffer_size);
+			*(start.node - i) = allocate_node();
 	}
 	catch (...) {
 		for (size_type j = 1; j < i; ++j)
-			data_allocator::deallocate(*(start.node - j), buffer_size);
+			deallocate_node(*(start.node - j));
+		throw;
 	}
 }
 
 // βĸ
 // úУ
 // 1. insert(n, value) -> fill_insert(n, value) -> reverse_elements_at_back(new_elements) -> new_elements_at_back
-template<class T, class Alloc>
-void deque<T, Alloc>::new_elements_at_back(size_type new_elements) {
-	size_type new_nodes = (new_elements - 1) / buffer_size + 1;
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::new_elements_at_back(size_type new_elements) {
+	size_type new_nodes = ((new_elements - 1) >> buffer_shift) + 1;
 	reserve_map_at_back(new_nodes);
 	size_type i = 1;
 	try {
 		for (; i <= new_nodes; ++i)
-			*(finish.node + i) = data_allocator::allocate(buffer_size);
+			*(finish.node + i) = allocate_node();
 	}
 	catch (...) {
-		for (size_type j = i; j < i; ++j)
-			data_allocator::deallocate(*(finish.node + j), buffer_size);
+		for (size_type j = 1; j < i; ++j)
+			deallocate_node(*(finish.node + j));
+		throw;
 	}
 }
 
 // вԪصĸ
 // úУ
 // 1. insert(n, value) -> fill_insert(n, value) -> insert_aux
-template<class T, class Alloc>
-void deque<T, Alloc>::insert_aux(iterator position, size_type n, const value_type& value) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::insert_aux(iterator position, size_type n, const value_type& value) {
 	size_type elems_before = position - start;
 	if (elems_before < static_cast<difference_type>(size() / 2)) {
 		iterator new_start = reserve_elements_at_front(n);
@@ -1476,37 +1625,37 @@ void deque<T, Alloc>::insert_aux(iterator position, size_type n, const value_typ
 // insertģ庯ģʱ
 // úУ
 // 1. insert(position, first, last) -> insert_dispatch
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class Integer>
-void deque<T, Alloc>::insert_dispatch(iterator position, Integer n, Integer value, true_type) {
+void deque<T, Alloc, BufSiz>::insert_dispatch(iterator position, Integer n, Integer value, true_type) {
 	fill_insert(position, n, value);
 }
 
 // insertģ庯ģʱ
 // úУ
 // 1. insert(position, first, last) -> insert_dispatch
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class InputIterator>
-void deque<T, Alloc>::insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
+void deque<T, Alloc, BufSiz>::insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
 	insert(position, first, last, iterator_category(first));
 }
 
 // ͬԪظ(input iterator汾)
 // úУ
 // 1. insert(position, first, last) -> insert_dispatch(position, first, last, false_type) -> insert
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class InputIterator>
-void deque<T, Alloc>::insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag) {
+void deque<T, Alloc, BufSiz>::insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag) {
 	mystl::copy(first, last, inserter(*this, position));
 }
 
 // ͬԪظ(forward iterator汾)
 // úУ
 // 1. insert(position, first, last) -> insert_dispatch(position, first, last, false_type) -> insert
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class ForwardIterator>
-void deque<T, Alloc>::insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
-	size_type n = distance(first, last);
+void deque<T, Alloc, BufSiz>::insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type n = mystl::distance(first, last);
 	if (position.cur == start.cur) {
 		iterator new_start = reserve_elements_at_front(n);
 		try {
@@ -1534,9 +1683,9 @@ void deque<T, Alloc>::insert(iterator position, ForwardIterator first, ForwardIt
 // insertвͬԪظ(ֻforward iteratorЧ)
 // úУ
 // 1. insert(position, first, last) -> insert_dispatch(position, first, last, false_type) -> insert(position, first, last, forward_iterator_tag) -> insert_aux(position, first, last, n)
-template<class T, class Alloc>
+template<class T, class Alloc, size_t BufSiz>
 template<class ForwardIterator>
-void deque<T, Alloc>::insert_aux(iterator position, ForwardIterator first, ForwardIterator last, size_type n) {
+void deque<T, Alloc, BufSiz>::insert_aux(iterator position, ForwardIterator first, ForwardIterator last, size_type n) {
 	size_type elems_before = position - start;
 	if (elems_before < size() / 2) {
 		iterator new_start = reserve_elements_at_front(n);
@@ -1553,7 +1702,7 @@ void deque<T, Alloc>::insert_aux(iterator position, ForwardIterator first, Forwa
 			else {
 				mystl::uninitialized_copy(start, position, new_start);
 				ForwardIterator mid = first;
-				advance(mid, n - elems_before);
+				mystl::advance(mid, n - elems_before);
 				mystl::uninitialized_copy(first, mid, new_start + elems_before);
 				mystl::copy(mid, last, start);
 				start = new_start;
@@ -1573,13 +1722,13 @@ void deque<T, Alloc>::insert_aux(iterator position, ForwardIterator first, Forwa
 				iterator mid = finish - n;
 				mystl::uninitialized_copy(mid, finish, finish);
 				mystl::copy_backward(position, mid, finish);
-				copy(first, last, position);
+				mystl::copy(first, last, position);
 				finish = new_finish;
 			}
 			else {
 				mystl::uninitialized_copy(position, finish, new_finish - elems_after);
 				ForwardIterator mid = first;
-				advance(mid, elems_after);
+				mystl::advance(mid, elems_after);
 				mystl::uninitialized_copy(mid, last, finish);
 				mystl::copy(first, mid, position);
 				finish = new_finish;
@@ -1594,8 +1743,8 @@ void deque<T, Alloc>::insert_aux(iterator position, ForwardIterator first, Forwa
 // insert_aux(const value_type*汾)
 // úУ
 // 1. insert(position, first, last) -> insert_aux
-template<class T, class Alloc>
-void deque<T, Alloc>::insert_aux(iterator position, const value_type* first, const value_type* last, size_type n) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::insert_aux(iterator position, const value_type* first, const value_type* last, size_type n) {
 	size_type elems_before = position - start;
 	if (elems_before < size() / 2) {
 		iterator new_start = reserve_elements_at_front(n);
@@ -1651,8 +1800,8 @@ void deque<T, Alloc>::insert_aux(iterator position, const value_type* first, con
 // insert_aux(const_iterator汾)
 // úУ
 // 1. insert(position, first, last) -> insert_aux
-template<class T, class Alloc>
-void deque<T, Alloc>::insert_aux(iterator position, const_iterator first, const_iterator last, size_type n) {
+template<class T, class Alloc, size_t BufSiz>
+void deque<T, Alloc, BufSiz>::insert_aux(iterator position, const_iterator first, const_iterator last, size_type n) {
 	size_type elems_before = position - start;
 	if (elems_before < size() / 2) {
 		iterator new_start = reserve_elements_at_front(n);
@@ -1708,38 +1857,38 @@ void deque<T, Alloc>::insert_aux(iterator position, const_iterator first, const_
 
 
 //------------------------------------------------------ú-------------------------------------------------------
-template<class T, class Alloc>
-bool operator==(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template<class T, class Alloc, size_t BufSiz>
+bool operator==(const deque<T, Alloc, BufSiz>& lhs, const deque<T, Alloc, BufSiz>& rhs) {
 	return lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
 }
 
-template<class T, class Alloc>
-bool operator!=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template<class T, class Alloc, size_t BufSiz>
+bool operator!=(const deque<T, Alloc, BufSiz>& lhs, const deque<T, Alloc, BufSiz>& rhs) {
 	return !(lhs == rhs);
 }
 
-template<class T, class Alloc>
-bool operator<(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template<class T, class Alloc, size_t BufSiz>
+bool operator<(const deque<T, Alloc, BufSiz>& lhs, const deque<T, Alloc, BufSiz>& rhs) {
 	return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template<class T, class Alloc>
-bool operator>(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template<class T, class Alloc, size_t BufSiz>
+bool operator>(const deque<T, Alloc, BufSiz>& lhs, const deque<T, Alloc, BufSiz>& rhs) {
 	return rhs < lhs;
 }
 
-template<class T, class Alloc>
-bool operator<=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template<class T, class Alloc, size_t BufSiz>
+bool operator<=(const deque<T, Alloc, BufSiz>& lhs, const deque<T, Alloc, BufSiz>& rhs) {
 	return !(rhs < lhs);
 }
 
-template<class T, class Alloc>
-bool operator>=(const deque<T, Alloc>& lhs, const deque<T, Alloc>& rhs) {
+template<class T, class Alloc, size_t BufSiz>
+bool operator>=(const deque<T, Alloc, BufSiz>& lhs, const deque<T, Alloc, BufSiz>& rhs) {
 	return !(lhs < rhs);
 }
 
-template<class T, class Alloc>
-void swap(deque<T, Alloc>& lhs, deque<T, Alloc>& rhs) {
+template<class T, class Alloc, size_t BufSiz>
+void swap(deque<T, Alloc, BufSiz>& lhs, deque<T, Alloc, BufSiz>& rhs) {
 	lhs.swap(rhs);	
 }
 
@@ -2,13 +2,190 @@
 #define MTSTL_DEQUE_TEST_H
 
 #include "deque.h"
+#include "vector.h"
+#include "algorithm.h"
 #include "test.h"
 #include <iostream>
+#include <string>
+#include <deque>
+#include <vector>
+#include <algorithm>
 
 namespace mystl {
 
 namespace deque_test {
 
+// push_backpop_front, ᱻϵͷ
+// malloc_allocӦֱӽmalloc, ںallocĴСԱ
+#define DEQUE_CHURN_DO_TEST(Alloc, count) do {								\
+	clock_t start, end;														\
+	mystl::deque<int, Alloc> d;												\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++) {									\
+		d.push_back(static_cast<int>(i));									\
+		if (d.size() > 4096)												\
+			d.pop_front();													\
+	}																		\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define DEQUE_CHURN_TEST(len1, len2, len3) do {								\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|    malloc_alloc     |";									\
+	DEQUE_CHURN_DO_TEST(mystl::malloc_alloc, len1);							\
+	DEQUE_CHURN_DO_TEST(mystl::malloc_alloc, len2);							\
+	DEQUE_CHURN_DO_TEST(mystl::malloc_alloc, len3);							\
+	std::cout << "\n|        alloc        |";								\
+	DEQUE_CHURN_DO_TEST(mystl::alloc, len1);								\
+	DEQUE_CHURN_DO_TEST(mystl::alloc, len2);								\
+	DEQUE_CHURN_DO_TEST(mystl::alloc, len3);								\
+	std::cout << "\n";														\
+} while(0)
+
+// countԪصns::copy / ns::fill / ns::find
+// dequeĵǷֶε, 㷨ȡԭָ봦, Ӧӽvector
+#define DEQUE_COPY_DO_TEST(con, ns, count) do {								\
+	con a(count, 1), b(count, 0);											\
+	clock_t start, end;														\
+	start = clock();														\
+	ns::copy(a.begin(), a.end(), b.begin());								\
+	end = clock();															\
+	if (b[count - 1] != 1)													\
+		std::cout << "wrong copy";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define DEQUE_FILL_DO_TEST(con, ns, count) do {								\
+	con a(count, 1);														\
+	clock_t start, end;														\
+	start = clock();														\
+	ns::fill(a.begin(), a.end(), 2);										\
+	end = clock();															\
+	if (a[count - 1] != 2)													\
+		std::cout << "wrong fill";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define DEQUE_FIND_DO_TEST(con, ns, count) do {								\
+	con a(count, 1);														\
+	a[count - 1] = 2;														\
+	clock_t start, end;														\
+	start = clock();														\
+	auto it = ns::find(a.begin(), a.end(), 2);								\
+	end = clock();															\
+	if (static_cast<size_t>(it - a.begin()) != count - 1)					\
+		std::cout << "wrong find";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define DEQUE_ALGO_TEST(TEST, len1, len2, len3) do {						\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|      std::deque     |";									\
+	TEST(std::deque<int>, std, len1);										\
+	TEST(std::deque<int>, std, len2);										\
+	TEST(std::deque<int>, std, len3);										\
+	std::cout << "\n|    mystl::vector    |";								\
+	TEST(mystl::vector<int>, mystl, len1);									\
+	TEST(mystl::vector<int>, mystl, len2);									\
+	TEST(mystl::vector<int>, mystl, len3);									\
+	std::cout << "\n|     mystl::deque    |";								\
+	TEST(mystl::deque<int>, mystl, len1);									\
+	TEST(mystl::deque<int>, mystl, len2);									\
+	TEST(mystl::deque<int>, mystl, len3);									\
+	std::cout << "\n";														\
+} while(0)
+
+// ˳push_back countԪ, ٰα±countoperator[]
+// 512B(128int)ӦɵĻС, ĬϻΪ4KB
+#define DEQUE_PUSH_DO_TEST(con, count) do {									\
+	clock_t start, end;														\
+	con d;																	\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++)										\
+		d.push_back(static_cast<int>(i));									\
+	end = clock();															\
+	if (d.size() != count)													\
+		std::cout << "wrong size";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define DEQUE_INDEX_DO_TEST(con, count) do {								\
+	con d;																	\
+	for (size_t i = 0; i < count; i++)										\
+		d.push_back(static_cast<int>(i));									\
+	clock_t start, end;														\
+	size_t sum = 0, k = 1;													\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++) {									\
+		k = k * 6364136223846793005ULL + 1442695040888963407ULL;			\
+		sum += d[(k >> 17) % count];										\
+	}																		\
+	end = clock();															\
+	if (0 == sum)															\
+		std::cout << "wrong sum";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define DEQUE_BUF_TEST(TEST, len1, len2, len3) do {							\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|      std::deque     |";									\
+	TEST(std::deque<int>, len1);											\
+	TEST(std::deque<int>, len2);											\
+	TEST(std::deque<int>, len3);											\
+	std::cout << "\n|   512B buffer deque |";								\
+	TEST(DEQUE_INT_512B, len1);												\
+	TEST(DEQUE_INT_512B, len2);												\
+	TEST(DEQUE_INT_512B, len3);												\
+	std::cout << "\n|     mystl::deque    |";								\
+	TEST(mystl::deque<int>, len1);											\
+	TEST(mystl::deque<int>, len2);											\
+	TEST(mystl::deque<int>, len3);											\
+	std::cout << "\n";														\
+} while(0)
+
+typedef mystl::deque<int, mystl::alloc, 128> DEQUE_INT_512B;
+
+// ͳķ, ռalloc
+class count_alloc {
+public:
+	static void* allocate(size_t n) {
+		++allocations();
+		return alloc::allocate(n);
+	}
+
+	static void deallocate(void* p, size_t n) {
+		alloc::deallocate(p, n);
+	}
+
+	static void* reallocate(void* p, size_t old_size, size_t new_size) {
+		++allocations();
+		return alloc::reallocate(p, old_size, new_size);
+	}
+
+	static size_t& allocations() {
+		static size_t n = 0;
+		return n;
+	}
+};
+
+// Ϊʹ: ȷlenԪ, push_back/pop_frontcount
+// ǰһ뽻Ԥ(mapλ, һл), غһ뽻ڼ
+template<class Deque>
+size_t deque_queue_allocations(size_t len, size_t count) {
+	Deque d;
+	for (size_t i = 0; i < len; i++)
+		d.push_back(static_cast<int>(i));
+	size_t before = 0;
+	for (size_t i = 0; i < count; i++) {
+		if (i == count / 2)
+			before = count_alloc::allocations();
+		d.push_back(static_cast<int>(i));
+		d.pop_front();
+	}
+	return count_alloc::allocations() - before;
+}
+
 void deque_test() {
 	std::cout << "[===============================================================]\n";
 	std::cout << "[----------------- Run container test : deque ------------------]\n";
@@ -73,6 +250,23 @@ void deque_test() {
 
 	FUN_VALUE(d1.size());
 	FUN_VALUE(d1.max_size());
+
+	// СΪ2, ͨģָ
+	FUN_VALUE((deque_buf_size<int>::value));
+	FUN_VALUE((deque_buf_size<std::string>::value));
+	FUN_VALUE((deque_buf_size<char[1000]>::value));
+	mystl::deque<int, mystl::alloc, 4> d11{ 1,2,3,4,5,6,7,8,9 };
+	FUN_AFTER(d11, d11.push_front(0));
+	FUN_AFTER(d11, d11.insert(d11.begin() + 5, 3, 5));
+	FUN_AFTER(d11, d11.erase(d11.begin() + 2, d11.begin() + 7));
+	FUN_VALUE(d11[6]);
+
+	// ʽʹʱ֮临, mapԭؾ, ȶ״̬²ռ
+	FUN_VALUE((deque_queue_allocations<mystl::deque<int, count_alloc>>(3000, 100000)));
+	FUN_VALUE((deque_queue_allocations<mystl::deque<int, count_alloc, 4>>(30, 100000)));
+	mystl::deque<int> d12(10000, 1);
+	FUN_AFTER(d12, d12.erase(d12.begin() + 10, d12.end()));
+	FUN_AFTER(d12, d12.shrink_to_fit());
 	PASSED;
 
 #if PERFORMANCE_TEST_ON
@@ -91,6 +285,28 @@ void deque_test() {
 #else
 	CON_TEST_P1(deque<int>, push_back, rand(), XL(LEN1), XL(LEN2), XL(LEN3));
 #endif
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|   push/pop churn    |";
+#if LARGER_TEST_DATA_ON
+	DEQUE_CHURN_TEST(XXL(LEN1), XXL(LEN2), XXL(LEN3));
+#else
+	DEQUE_CHURN_TEST(XL(LEN1), XL(LEN2), XL(LEN3));
+#endif
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|   push_back (buf)   |";
+	DEQUE_BUF_TEST(DEQUE_PUSH_DO_TEST, M(LEN2), L(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|   random operator[] |";
+	DEQUE_BUF_TEST(DEQUE_INDEX_DO_TEST, M(LEN2), L(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|        copy         |";
+	DEQUE_ALGO_TEST(DEQUE_COPY_DO_TEST, M(LEN3), L(LEN3), XL(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|        fill         |";
+	DEQUE_ALGO_TEST(DEQUE_FILL_DO_TEST, M(LEN3), L(LEN3), XL(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|        find         |";
+	DEQUE_ALGO_TEST(DEQUE_FIND_DO_TEST, M(LEN3), L(LEN3), XL(LEN3));
 	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
 	PASSED;
 #endif
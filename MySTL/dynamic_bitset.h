@@ -0,0 +1,677 @@
+#ifndef MYSTL_DYNAMIC_BITSET_H
+#define MYSTL_DYNAMIC_BITSET_H
+
+// ļdynamic_bitset
+// ȿʱıλ, ÿbitֻռһλ, 64λֱ
+// find_first/find_nextһһ, count, &, |, ^, -ּ, ֧SSE2/AVX2ʱ128/256λ
+
+#include <cstring>								// memset, memcmp
+#include <cassert>								// assert
+#include <utility>								// move
+#include "mystl_alloc.h"
+#include "iterator.h"
+#include "algobase.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define MYSTL_BITSET_AVX2 1
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define MYSTL_BITSET_SSE2 1
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>								// _BitScanForward
+#endif
+
+namespace mystl {
+
+typedef unsigned long long bitset_word;
+
+enum { BITSET_WORD_BITS = 64 };				// ÿֵλ
+
+// һ1ĸ
+inline size_t popcount_word(bitset_word w) {
+#if defined(__GNUC__)
+	return static_cast<size_t>(__builtin_popcountll(w));
+#elif defined(_MSC_VER) && defined(_M_X64) && defined(__AVX__)
+	return static_cast<size_t>(__popcnt64(w));
+#else
+	w = w - ((w >> 1) & 0x5555555555555555ULL);
+	w = (w & 0x3333333333333333ULL) + ((w >> 2) & 0x3333333333333333ULL);
+	w = (w + (w >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+	return static_cast<size_t>((w * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// һλ1λ, wΪ0
+inline size_t lowest_bit(bitset_word w) {
+	assert(w != 0);
+#if defined(__GNUC__)
+	return static_cast<size_t>(__builtin_ctzll(w));
+#elif defined(_MSC_VER) && defined(_M_X64)
+	unsigned long index;
+	_BitScanForward64(&index, w);
+	return index;
+#elif defined(_MSC_VER)
+	unsigned long index;
+	if (_BitScanForward(&index, static_cast<unsigned long>(w)))
+		return index;
+	_BitScanForward(&index, static_cast<unsigned long>(w >> 32));
+	return index + 32;
+#else
+	size_t index = 0;
+	while (0 == (w & 1)) {
+		w >>= 1;
+		++index;
+	}
+	return index;
+#endif
+}
+
+// , ֧SIMDʱͬʱ汾
+struct bitset_and {
+	static bitset_word apply(bitset_word a, bitset_word b) {
+		return a & b;
+	}
+#if MYSTL_BITSET_AVX2
+	static __m256i apply(__m256i a, __m256i b) {
+		return _mm256_and_si256(a, b);
+	}
+#elif MYSTL_BITSET_SSE2
+	static __m128i apply(__m128i a, __m128i b) {
+		return _mm_and_si128(a, b);
+	}
+#endif
+};
+
+struct bitset_or {
+	static bitset_word apply(bitset_word a, bitset_word b) {
+		return a | b;
+	}
+#if MYSTL_BITSET_AVX2
+	static __m256i apply(__m256i a, __m256i b) {
+		return _mm256_or_si256(a, b);
+	}
+#elif MYSTL_BITSET_SSE2
+	static __m128i apply(__m128i a, __m128i b) {
+		return _mm_or_si128(a, b);
+	}
+#endif
+};
+
+struct bitset_xor {
+	static bitset_word apply(bitset_word a, bitset_word b) {
+		return a ^ b;
+	}
+#if MYSTL_BITSET_AVX2
+	static __m256i apply(__m256i a, __m256i b) {
+		return _mm256_xor_si256(a, b);
+	}
+#elif MYSTL_BITSET_SSE2
+	static __m128i apply(__m128i a, __m128i b) {
+		return _mm_xor_si128(a, b);
+	}
+#endif
+};
+
+// a & ~b
+struct bitset_andnot {
+	static bitset_word apply(bitset_word a, bitset_word b) {
+		return a & ~b;
+	}
+#if MYSTL_BITSET_AVX2
+	static __m256i apply(__m256i a, __m256i b) {
+		return _mm256_andnot_si256(b, a);
+	}
+#elif MYSTL_BITSET_SSE2
+	static __m128i apply(__m128i a, __m128i b) {
+		return _mm_andnot_si128(b, a);
+	}
+#endif
+};
+
+// dst[i] = Op(dst[i], src[i]), i < n
+template<class Op>
+inline void transform_words(bitset_word* dst, const bitset_word* src, size_t n) {
+	size_t i = 0;
+#if MYSTL_BITSET_AVX2
+	for (; i + 4 <= n; i += 4) {
+		__m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i));
+		__m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), Op::apply(a, b));
+	}
+#elif MYSTL_BITSET_SSE2
+	for (; i + 2 <= n; i += 2) {
+		__m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i));
+		__m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), Op::apply(a, b));
+	}
+#endif
+	for (; i < n; i++)
+		dst[i] = Op::apply(dst[i], src[i]);
+}
+
+// dynamic_bitset
+// һгsize()λʼΪ0, count, findͱȽ϶һ
+template<class Alloc = alloc>
+class dynamic_bitset : private simple_alloc<bitset_word, Alloc> {
+public:
+	typedef simple_alloc<bitset_word, Alloc>			data_allocator;
+	typedef Alloc										allocator_type;
+
+	typedef bitset_word									word_type;
+	typedef size_t										size_type;
+	typedef ptrdiff_t									difference_type;
+	typedef bool										value_type;
+	typedef bool										const_reference;
+
+	static const size_type npos = static_cast<size_type>(-1);	// findûҵʱķֵ
+
+	// ָһλĴ
+	class reference {
+		friend class dynamic_bitset;
+	private:
+		word_type* word;
+		word_type mask;
+
+		reference(word_type* w, size_type pos) : word(w), mask(word_type(1) << pos) {};
+
+	public:
+		operator bool() const {
+			return (*word & mask) != 0;
+		}
+
+		bool operator~() const {
+			return (*word & mask) == 0;
+		}
+
+		reference& operator=(bool value) {
+			if (value)
+				*word |= mask;
+			else
+				*word &= ~mask;
+			return *this;
+		}
+
+		reference& operator=(const reference& rhs) {
+			return *this = static_cast<bool>(rhs);
+		}
+
+		reference& flip() {
+			*word ^= mask;
+			return *this;
+		}
+	};
+
+	// ֻ, õõbool
+	class const_iterator {
+	public:
+		typedef random_iterator_tag			iterator_category;
+		typedef bool						value_type;
+		typedef ptrdiff_t					difference_type;
+		typedef const bool*					pointer;
+		typedef bool						reference;
+
+	private:
+		const word_type* words;
+		size_type pos;
+
+	public:
+		const_iterator() : words(nullptr), pos(0) {};
+		const_iterator(const word_type* w, size_type p) : words(w), pos(p) {};
+
+		bool operator*() const {
+			return ((words[pos / BITSET_WORD_BITS] >> (pos % BITSET_WORD_BITS)) & 1) != 0;
+		}
+
+		bool operator[](difference_type n) const {
+			return *(*this + n);
+		}
+
+		const_iterator& operator++() {
+			++pos;
+			return *this;
+		}
+
+		const_iterator operator++(int) {
+			const_iterator tmp = *this;
+			++pos;
+			return tmp;
+		}
+
+		const_iterator& operator--() {
+			--pos;
+			return *this;
+		}
+
+		const_iterator operator--(int) {
+			const_iterator tmp = *this;
+			--pos;
+			return tmp;
+		}
+
+		const_iterator& operator+=(difference_type n) {
+			pos += n;
+			return *this;
+		}
+
+		const_iterator& operator-=(difference_type n) {
+			pos -= n;
+			return *this;
+		}
+
+		const_iterator operator+(difference_type n) const {
+			return const_iterator(words, pos + n);
+		}
+
+		const_iterator operator-(difference_type n) const {
+			return const_iterator(words, pos - n);
+		}
+
+		difference_type operator-(const const_iterator& rhs) const {
+			return static_cast<difference_type>(pos) - static_cast<difference_type>(rhs.pos);
+		}
+
+		bool operator==(const const_iterator& rhs) const {
+			return pos == rhs.pos;
+		}
+
+		bool operator!=(const const_iterator& rhs) const {
+			return pos != rhs.pos;
+		}
+
+		bool operator<(const const_iterator& rhs) const {
+			return pos < rhs.pos;
+		}
+	};
+
+	typedef const_iterator								iterator;
+
+	// õʹõķ
+	allocator_type get_allocator() const {
+		return data_allocator::resource();
+	}
+
+private:
+	word_type* words;			// λ
+	size_type nbits;			// λ
+	size_type cap;				// Ѿ
+
+public:
+	//-----------------------------------------------------졢ƺ---------------------------------------------------
+	dynamic_bitset() : words(nullptr), nbits(0), cap(0) {};
+
+	explicit dynamic_bitset(const Alloc& a) : data_allocator(a), words(nullptr), nbits(0), cap(0) {};
+
+	explicit dynamic_bitset(size_type n, bool value = false, const Alloc& a = Alloc())
+		: data_allocator(a), words(nullptr), nbits(0), cap(0) {
+		resize(n, value);
+	}
+
+	// ķselect_on_container_copy_construction
+	dynamic_bitset(const dynamic_bitset& rhs)
+		: data_allocator(data_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())),
+		words(nullptr), nbits(0), cap(0) {
+		copy_words(rhs);
+	}
+
+	dynamic_bitset(dynamic_bitset&& rhs) noexcept
+		: data_allocator(rhs.get_allocator()), words(rhs.words), nbits(rhs.nbits), cap(rhs.cap) {
+		rhs.words = nullptr;
+		rhs.nbits = 0;
+		rhs.cap = 0;
+	}
+
+	dynamic_bitset& operator=(const dynamic_bitset& rhs);
+
+	dynamic_bitset& operator=(dynamic_bitset&& rhs);
+
+	~dynamic_bitset() {
+		data_allocator::deallocate(words, cap);
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	const_iterator begin() const {
+		return const_iterator(words, 0);
+	}
+
+	const_iterator end() const {
+		return const_iterator(words, nbits);
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	size_type size() const {
+		return nbits;
+	}
+
+	bool empty() const {
+		return 0 == nbits;
+	}
+
+	// ѾĿռܷµλ
+	size_type capacity() const {
+		return cap * BITSET_WORD_BITS;
+	}
+
+	size_type num_words() const {
+		return word_count(nbits);
+	}
+
+	void reserve(size_type n) {
+		if (word_count(n) > cap)
+			grow_to(word_count(n));
+	}
+
+	//-----------------------------------------------------Ԫغ---------------------------------------------------------
+	reference operator[](size_type pos) {
+		assert(pos < nbits);
+		return reference(words + pos / BITSET_WORD_BITS, pos % BITSET_WORD_BITS);
+	}
+
+	bool operator[](size_type pos) const {
+		return test(pos);
+	}
+
+	bool test(size_type pos) const {
+		assert(pos < nbits);
+		return ((words[pos / BITSET_WORD_BITS] >> (pos % BITSET_WORD_BITS)) & 1) != 0;
+	}
+
+	// ֱӷʱλ, һгsize()λ뱣Ϊ0
+	word_type* data() {
+		return words;
+	}
+
+	const word_type* data() const {
+		return words;
+	}
+
+	//-------------------------------------------------޸ز----------------------------------------------------------
+	// 1. õλ
+	dynamic_bitset& set(size_type pos, bool value = true) {
+		(*this)[pos] = value;
+		return *this;
+	}
+
+	dynamic_bitset& reset(size_type pos) {
+		return set(pos, false);
+	}
+
+	dynamic_bitset& flip(size_type pos) {
+		(*this)[pos].flip();
+		return *this;
+	}
+
+	// 2. λ
+	dynamic_bitset& set() {
+		if (nbits != 0)
+			std::memset(words, 0xff, num_words() * sizeof(word_type));
+		clear_tail();
+		return *this;
+	}
+
+	dynamic_bitset& reset() {
+		if (nbits != 0)
+			std::memset(words, 0, num_words() * sizeof(word_type));
+		return *this;
+	}
+
+	dynamic_bitset& flip() {
+		for (size_type i = 0, n = num_words(); i < n; i++)
+			words[i] = ~words[i];
+		clear_tail();
+		return *this;
+	}
+
+	// 3. β˲ɾ
+	void push_back(bool value) {
+		if (nbits == capacity())
+			grow_to(cap == 0 ? 1 : cap * 2);
+		size_type pos = nbits++;
+		if (0 == pos % BITSET_WORD_BITS)
+			words[pos / BITSET_WORD_BITS] = 0;
+		if (value)
+			words[pos / BITSET_WORD_BITS] |= word_type(1) << (pos % BITSET_WORD_BITS);
+	}
+
+	void pop_back() {
+		assert(nbits > 0);
+		--nbits;
+		clear_tail();
+	}
+
+	// 4. С, µλΪvalue
+	void resize(size_type n, bool value = false);
+
+	// 5. ɾλ, ѾĿռ䱣
+	void clear() {
+		nbits = 0;
+	}
+
+	// 6. 
+	void swap(dynamic_bitset& rhs) {
+		data_allocator::propagate_swap(rhs);
+		mystl::swap(words, rhs.words);
+		mystl::swap(nbits, rhs.nbits);
+		mystl::swap(cap, rhs.cap);
+	}
+
+	//-------------------------------------------------ֲ----------------------------------------------------------
+	// 1ĸ
+	size_type count() const {
+		size_type res = 0;
+		for (size_type i = 0, n = num_words(); i < n; i++)
+			res += popcount_word(words[i]);
+		return res;
+	}
+
+	bool any() const {
+		for (size_type i = 0, n = num_words(); i < n; i++) {
+			if (words[i] != 0)
+				return true;
+		}
+		return false;
+	}
+
+	bool none() const {
+		return !any();
+	}
+
+	bool all() const {
+		return count() == nbits;
+	}
+
+	// һ1λ, ûʱnpos
+	size_type find_first() const {
+		return find_from(0);
+	}
+
+	// pos֮һ1λ, ûʱnpos
+	size_type find_next(size_type pos) const {
+		if (pos == npos || pos + 1 >= nbits)
+			return npos;
+		++pos;
+		size_type i = pos / BITSET_WORD_BITS;
+		word_type w = words[i] & (~word_type(0) << (pos % BITSET_WORD_BITS));
+		if (w != 0)
+			return i * BITSET_WORD_BITS + lowest_bit(w);
+		return find_from(i + 1);
+	}
+
+	// λͬ
+	dynamic_bitset& operator&=(const dynamic_bitset& rhs) {
+		assert(nbits == rhs.nbits);
+		transform_words<bitset_and>(words, rhs.words, num_words());
+		return *this;
+	}
+
+	dynamic_bitset& operator|=(const dynamic_bitset& rhs) {
+		assert(nbits == rhs.nbits);
+		transform_words<bitset_or>(words, rhs.words, num_words());
+		return *this;
+	}
+
+	dynamic_bitset& operator^=(const dynamic_bitset& rhs) {
+		assert(nbits == rhs.nbits);
+		transform_words<bitset_xor>(words, rhs.words, num_words());
+		return *this;
+	}
+
+	// : ȥrhsΪ1λ
+	dynamic_bitset& operator-=(const dynamic_bitset& rhs) {
+		assert(nbits == rhs.nbits);
+		transform_words<bitset_andnot>(words, rhs.words, num_words());
+		return *this;
+	}
+
+	dynamic_bitset operator~() const {
+		dynamic_bitset res(*this);
+		res.flip();
+		return res;
+	}
+
+	bool operator==(const dynamic_bitset& rhs) const {
+		return nbits == rhs.nbits && (0 == nbits ||
+			0 == std::memcmp(words, rhs.words, num_words() * sizeof(word_type)));
+	}
+
+	bool operator!=(const dynamic_bitset& rhs) const {
+		return !(*this == rhs);
+	}
+
+private:
+	//-------------------------------------------------------------------------------------------------------------------
+	static size_type word_count(size_type n) {
+		return (n + BITSET_WORD_BITS - 1) / BITSET_WORD_BITS;
+	}
+
+	// һгsize()λ
+	void clear_tail() {
+		size_type r = nbits % BITSET_WORD_BITS;
+		if (r != 0)
+			words[nbits / BITSET_WORD_BITS] &= (word_type(1) << r) - 1;
+	}
+
+	// ֿ԰ֽڰ, ֱʹreallocate
+	void grow_to(size_type n) {
+		words = data_allocator::reallocate(words, cap, n);
+		cap = n;
+	}
+
+	// ӵiֿʼҵһ1
+	size_type find_from(size_type i) const {
+		for (size_type n = num_words(); i < n; i++) {
+			if (words[i] != 0)
+				return i * BITSET_WORD_BITS + lowest_bit(words[i]);
+		}
+		return npos;
+	}
+
+	// rhsλƹ, ֮ǰѾͷžɵĿռ߿ռ㹻
+	void copy_words(const dynamic_bitset& rhs) {
+		size_type n = rhs.num_words();
+		if (n > cap)
+			grow_to(n);
+		if (n != 0)
+			std::memcpy(words, rhs.words, n * sizeof(word_type));
+		nbits = rhs.nbits;
+	}
+};
+
+template<class Alloc>
+const typename dynamic_bitset<Alloc>::size_type dynamic_bitset<Alloc>::npos;
+
+// Ƹֵ
+template<class Alloc>
+dynamic_bitset<Alloc>& dynamic_bitset<Alloc>::operator=(const dynamic_bitset& rhs) {
+	if (this != &rhs) {
+		// Ҫɲȵķ, þɵķͷſռ
+		if (data_allocator::replaced_on_copy(rhs)) {
+			data_allocator::deallocate(words, cap);
+			words = nullptr;
+			nbits = cap = 0;
+		}
+		data_allocator::propagate_copy(rhs);
+		copy_words(rhs);
+	}
+	return *this;
+}
+
+// ƶֵ
+// ԴʱӹrhsĿռ, 
+template<class Alloc>
+dynamic_bitset<Alloc>& dynamic_bitset<Alloc>::operator=(dynamic_bitset&& rhs) {
+	if (this == &rhs)
+		return *this;
+	if (data_allocator::traits::propagate_on_container_move_assignment::value || data_allocator::same_resource(rhs)) {
+		data_allocator::deallocate(words, cap);
+		data_allocator::propagate_move(rhs);
+		words = rhs.words;
+		nbits = rhs.nbits;
+		cap = rhs.cap;
+		rhs.words = nullptr;
+		rhs.nbits = rhs.cap = 0;
+	}
+	else {
+		copy_words(rhs);
+	}
+	return *this;
+}
+
+// С
+// ʱȲһ, ; Сʱѳλ
+template<class Alloc>
+void dynamic_bitset<Alloc>::resize(size_type n, bool value) {
+	size_type old_words = num_words();
+	size_type new_words = word_count(n);
+	if (new_words > cap)
+		grow_to(new_words > cap * 2 ? new_words : cap * 2);
+	if (n > nbits) {
+		size_type r = nbits % BITSET_WORD_BITS;
+		if (value && r != 0)
+			words[old_words - 1] |= ~word_type(0) << r;
+		if (new_words > old_words)
+			std::memset(words + old_words, value ? 0xff : 0, (new_words - old_words) * sizeof(word_type));
+	}
+	nbits = n;
+	clear_tail();
+}
+
+//--------------------------------------------------ú(dynamic_bitset)----------------------------------------------------------
+template<class Alloc>
+inline dynamic_bitset<Alloc> operator&(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+	dynamic_bitset<Alloc> res(lhs);
+	res &= rhs;
+	return res;
+}
+
+template<class Alloc>
+inline dynamic_bitset<Alloc> operator|(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+	dynamic_bitset<Alloc> res(lhs);
+	res |= rhs;
+	return res;
+}
+
+template<class Alloc>
+inline dynamic_bitset<Alloc> operator^(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+	dynamic_bitset<Alloc> res(lhs);
+	res ^= rhs;
+	return res;
+}
+
+template<class Alloc>
+inline dynamic_bitset<Alloc> operator-(const dynamic_bitset<Alloc>& lhs, const dynamic_bitset<Alloc>& rhs) {
+	dynamic_bitset<Alloc> res(lhs);
+	res -= rhs;
+	return res;
+}
+
+template<class Alloc>
+inline void swap(dynamic_bitset<Alloc>& lhs, dynamic_bitset<Alloc>& rhs) {
+	lhs.swap(rhs);
+}
+
+}	// mystl
+
+#endif
@@ -0,0 +1,176 @@
+#ifndef MYSTL_DYNAMIC_BITSET_TEST_H
+#define MYSTL_DYNAMIC_BITSET_TEST_H
+
+#include "test.h"
+#include "../MySTL/vector.h"
+#include "../MySTL/dynamic_bitset.h"
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+namespace mystl {
+namespace dynamic_bitset_test {
+
+// countλ, a3ıΪ1, b5ıΪ1
+// a & b1ĸ: vector<bool>ֻλ, dynamic_bitset(SIMD)
+#define BITSET_AND_DO_TEST(con, count) do {									\
+	con a(count), b(count);													\
+	for (size_t i = 0; i < count; i += 3)									\
+		a[i] = true;														\
+	for (size_t i = 0; i < count; i += 5)									\
+		b[i] = true;														\
+	clock_t start, end;														\
+	start = clock();														\
+	size_t n = bitset_and_count(a, b);										\
+	end = clock();															\
+	if (n != (count + 14) / 15)												\
+		std::cout << "wrong count";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+// countλļÿ1000λһ1, ҳе1
+#define BITSET_FIND_DO_TEST(con, count) do {								\
+	con a(count);															\
+	for (size_t i = 0; i < count; i += 1000)								\
+		a[i] = true;														\
+	clock_t start, end;														\
+	start = clock();														\
+	size_t n = bitset_scan(a);												\
+	end = clock();															\
+	if (n != (count + 999) / 1000)											\
+		std::cout << "wrong count";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define BITSET_TEST(TEST, len1, len2, len3) do {							\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|  std::vector<bool>  |";									\
+	TEST(std::vector<bool>, len1);											\
+	TEST(std::vector<bool>, len2);											\
+	TEST(std::vector<bool>, len3);											\
+	std::cout << "\n| mystl::vector<bool> |";								\
+	TEST(mystl::vector<bool>, len1);										\
+	TEST(mystl::vector<bool>, len2);										\
+	TEST(mystl::vector<bool>, len3);										\
+	std::cout << "\n|    dynamic_bitset   |";								\
+	TEST(mystl::dynamic_bitset<>, len1);									\
+	TEST(mystl::dynamic_bitset<>, len2);									\
+	TEST(mystl::dynamic_bitset<>, len3);									\
+	std::cout << "\n";														\
+} while(0)
+
+template<class Con>
+size_t bitset_and_count(Con& a, const Con& b) {
+	for (size_t i = 0; i < a.size(); i++)
+		a[i] = a[i] && b[i];
+	return std::count(a.begin(), a.end(), true);
+}
+
+inline size_t bitset_and_count(dynamic_bitset<>& a, const dynamic_bitset<>& b) {
+	a &= b;
+	return a.count();
+}
+
+template<class Con>
+size_t bitset_scan(const Con& a) {
+	size_t n = 0;
+	for (size_t i = 0; i < a.size(); i++) {
+		if (a[i])
+			++n;
+	}
+	return n;
+}
+
+inline size_t bitset_scan(const dynamic_bitset<>& a) {
+	size_t n = 0;
+	for (size_t i = a.find_first(); i != dynamic_bitset<>::npos; i = a.find_next(i))
+		++n;
+	return n;
+}
+
+void dynamic_bitset_test() {
+	std::cout << "[===============================================================]\n";
+	std::cout << "[------------- Run container test : dynamic_bitset -------------]\n";
+	std::cout << "[-------------------------- API test ---------------------------]\n";
+
+	dynamic_bitset<> b1;
+	dynamic_bitset<> b2(10);
+	dynamic_bitset<> b3(70, true);
+	dynamic_bitset<> b4(b3);
+	dynamic_bitset<> b5(std::move(b4));
+	dynamic_bitset<> b6, b7;
+	b6 = b3;
+	b7 = std::move(b5);
+
+	FUN_AFTER(b1, b1.push_back(true));
+	FUN_AFTER(b1, b1.push_back(false));
+	FUN_AFTER(b1, b1.push_back(true));
+	FUN_AFTER(b1, b1.pop_back());
+	FUN_AFTER(b1, b1.resize(8, true));
+	FUN_AFTER(b1, b1.set(1));
+	FUN_AFTER(b1, b1.reset(7));
+	FUN_AFTER(b1, b1.flip(0));
+	FUN_AFTER(b1, b1.flip());
+	FUN_AFTER(b2, b2[3] = true);
+	FUN_AFTER(b2, b2[5] = b2[3]);
+	FUN_AFTER(b2, b2.set());
+	FUN_AFTER(b2, b2.reset());
+
+	std::cout << std::boolalpha;
+	FUN_VALUE(b1.test(0));
+	FUN_VALUE(b1.any());
+	FUN_VALUE(b2.none());
+	FUN_VALUE(b3.all());
+	FUN_VALUE(b3 == b6);
+	std::cout << std::noboolalpha;
+	FUN_VALUE(b1.size());
+	FUN_VALUE(b3.count());
+	FUN_VALUE(b3.num_words());
+
+	// ֲҺͼ
+	dynamic_bitset<> x(200), y(200);
+	for (size_t i = 0; i < 200; i += 3)
+		x[i] = true;
+	for (size_t i = 0; i < 200; i += 5)
+		y[i] = true;
+	FUN_VALUE(x.count());
+	FUN_VALUE(y.count());
+	FUN_VALUE((x & y).count());
+	FUN_VALUE((x | y).count());
+	FUN_VALUE((x ^ y).count());
+	FUN_VALUE((x - y).count());
+	FUN_VALUE((~x).count());
+	FUN_VALUE((x & y).find_first());
+	FUN_VALUE((x & y).find_next(15));
+	std::cout << std::boolalpha;
+	FUN_VALUE((x & y).find_next(195) == dynamic_bitset<>::npos);
+	std::cout << std::noboolalpha;
+	std::cout << " x & y :";
+	dynamic_bitset<> z = x & y;
+	for (size_t i = z.find_first(); i != dynamic_bitset<>::npos; i = z.find_next(i))
+		std::cout << " " << i;
+	std::cout << "\n";
+
+	PASSED;
+
+#if PERFORMANCE_TEST_ON
+	std::cout << "[--------------------- Performance Testing ---------------------]\n";
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|     and + count     |";
+	BITSET_TEST(BITSET_AND_DO_TEST, M(LEN3), XL(LEN3), L(XL(LEN3)));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|    find_next scan   |";
+	BITSET_TEST(BITSET_FIND_DO_TEST, M(LEN3), XL(LEN3), L(XL(LEN3)));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	PASSED;
+#endif
+	std::cout << "[------------- End container test : dynamic_bitset -------------]\n";
+	std::cout << std::endl;
+	std::cout << std::endl;
+
+}
+
+}	// dynamic_bitset_test
+}	// mystl
+
+#endif
@@ -142,14 +142,14 @@ struct identity : public unary_function<T, T> {
 
 template<class Pair>
 struct Select1st : public unary_function<Pair, typename Pair::first_type> {
-	typename Pair::first_type operator()(const Pair& x) const {
+	const typename Pair::first_type& operator()(const Pair& x) const {
 		return x.first;
 	}
 };
 
 template<class Pair>
 struct Select2nd : public unary_function<Pair, typename Pair::second_type> {
-	typename Pair::first_type operator()(const Pair& x) const {
+	const typename Pair::second_type& operator()(const Pair& x) const {
 		return x.second;
 	}
 };
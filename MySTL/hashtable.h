@@ -274,7 +274,7 @@ inline unsigned long stl_next_prime(unsigned long n) {
 
 // hashtable
 template<class Value, class Key, class HashFcn, class ExtractKey, class EqualKey, class Alloc>
-class hashtable {
+class hashtable : private node_pool<hashtable_node<Value>, Alloc> {
 public:
 	// iteratorconst_iteratorΪ
 	friend struct hashtable_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>;
@@ -292,9 +292,9 @@ public:
 	typedef hashtable*																		container_ptr;
 	typedef const hashtable*																const_container_ptr;
 
-	typedef simple_alloc<Value, Alloc>														allocator_type;
+	typedef Alloc																			allocator_type;
 	typedef simple_alloc<Value, Alloc>														data_allocator;
-	typedef simple_alloc<node, Alloc>														node_allocator;
+	typedef node_pool<node, Alloc>															node_allocator;
 
 	typedef Value*																			pointer;
 	typedef const Value*																	const_pointer;
@@ -307,7 +307,7 @@ public:
 	typedef hashtable_const_iterator<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>		const_iterator;
 
 	allocator_type get_allocator() const {
-		return data_allocator();
+		return node_allocator::resource();
 	}
 
 	HashFcn hash_funct() const {
@@ -327,11 +327,11 @@ private:
 
 
 	node_ptr get_node() {
-		return node_allocator::allocate(1);
+		return node_allocator::allocate();
 	}
 
 	void put_node(node_ptr node) {
-		node_allocator::deallocate(node, 1);
+		node_allocator::deallocate(node);
 	}
 
 public:
@@ -345,20 +345,31 @@ public:
 		const hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>& rhs);
 
 // ƺ͹캯
-	hashtable(size_type n, HashFcn hf, EqualKey eql, ExtractKey ext) : hash(hf), equal(eql), get_key(ext), num_elements(0) {
+	// Ͱͽʹͬһ
+	hashtable(size_type n, HashFcn hf, EqualKey eql, ExtractKey ext, const Alloc& a = Alloc())
+		: node_allocator(a), hash(hf), equal(eql), get_key(ext), num_elements(0), buckets(a) {
 		initialize_buckets(n);
 	}
 
-	hashtable(size_type n, HashFcn hf, EqualKey eql) : hash(hf), equal(eql), get_key(ExtractKey()), num_elements(0) {
+	hashtable(size_type n, HashFcn hf, EqualKey eql, const Alloc& a = Alloc())
+		: node_allocator(a), hash(hf), equal(eql), get_key(ExtractKey()), num_elements(0), buckets(a) {
 		initialize_buckets(n);
 	}
 
-	hashtable(const hashtable& rhs) : hash(rhs.hash), equal(rhs.equal), get_key(rhs.get_key), num_elements(rhs.num_elements) {
+	// ķselect_on_container_copy_construction
+	hashtable(const hashtable& rhs)
+		: node_allocator(node_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())),
+		hash(rhs.hash), equal(rhs.equal), get_key(rhs.get_key), num_elements(rhs.num_elements), buckets(get_allocator()) {
 		copy_from(rhs);
 	}
 
 	hashtable& operator=(const hashtable& rhs) {
 		if (&rhs != this) {
+			clear();
+			// Ҫɲȵķ, ͰҲҪµķ
+			if (node_allocator::replaced_on_copy(rhs))
+				buckets = mystl::vector<node_ptr, Alloc>(rhs.get_allocator());
+			node_allocator::propagate_copy(rhs);
 			hash = rhs.hash;
 			equal = rhs.equal;
 			get_key = rhs.get_key;
@@ -415,6 +426,7 @@ public:
 	}
 
 	void swap(hashtable& rhs) {
+		node_allocator::propagate_swap(rhs);
 		mystl::swap(hash, rhs.hash);
 		mystl::swap(equal, rhs.equal);
 		mystl::swap(get_key, rhs.get_key);
@@ -662,6 +674,7 @@ template<class ForwardIterator>
 void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::insert_unique(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
 	size_type n = mystl::distance(first, last);
 	resize(num_elements + n);
+	node_allocator::reserve(n);
 	for (; n > 0; --n) {
 		insert_unique_noresize(*first);
 		++first;
@@ -690,6 +703,7 @@ template<class ForwardIterator>
 void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::insert_equal(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
 	size_type n = mystl::distance(first, last);
 	resize(num_elements + n);
+	node_allocator::reserve(n);
 	for (; n > 0; --n) {
 		insert_equal_noresize(*first);
 		++first;
@@ -701,6 +715,7 @@ template<class Value, class Key, class HashFcn, class ExtractKey, class EqualKey
 void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::insert_unique(const value_type* first, const value_type* last) {
 	size_type n = mystl::distance(first, last);
 	resize(num_elements + n);
+	node_allocator::reserve(n);
 	for (; n > 0; --n) {
 		insert_unique_noresize(*first);
 		++first;
@@ -712,6 +727,7 @@ template<class Value, class Key, class HashFcn, class ExtractKey, class EqualKey
 void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::insert_equal(const value_type* first, const value_type* last) {
 	size_type n = mystl::distance(first, last);
 	resize(num_elements + n);
+	node_allocator::reserve(n);
 	for (; n > 0; --n) {
 		insert_equal_noresize(*first);
 		++first;
@@ -723,6 +739,7 @@ template<class Value, class Key, class HashFcn, class ExtractKey, class EqualKey
 void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::insert_unique(const_iterator first, const_iterator last) {
 	size_type n = mystl::distance(first, last);
 	resize(num_elements + n);
+	node_allocator::reserve(n);
 	for (; n > 0; --n) {
 		insert_unique_noresize(*first);
 		++first;
@@ -735,6 +752,7 @@ template<class Value, class Key, class HashFcn, class ExtractKey, class EqualKey
 void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::insert_equal(const_iterator first, const_iterator last) {
 	size_type n = mystl::distance(first, last);
 	resize(num_elements + n);
+	node_allocator::reserve(n);
 	for (; n > 0; --n) {
 		insert_equal_noresize(*first);
 		++first;
@@ -835,7 +853,7 @@ void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::erase(const_it
 	erase(const_cast<iterator>(first), const_cast<iterator>(last));
 }
 
-// ȫ
+// ȫ, صslabҲһ𻹸
 template<class Value, class Key, class HashFcn, class ExtractKey, class EqualKey, class Alloc>
 void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::clear() {
 	for (size_type i = 0; i < buckets.size(); ++i) {
@@ -848,6 +866,7 @@ void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::clear() {
 		buckets[i] = nullptr;
 	}
 	num_elements = 0;
+	node_allocator::release();
 }
 
 
@@ -974,6 +993,7 @@ void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::copy_from(cons
 	buckets.clear();
 	buckets.reserve(ht.buckets.size());
 	buckets.assign(ht.buckets.size(), nullptr);
+	node_allocator::reserve(ht.num_elements);
 	try {
 		for (size_type bucket = 0; bucket < ht.buckets.size(); ++bucket) {
 			node_ptr cur = ht.buckets[bucket];
@@ -1025,7 +1045,7 @@ void hashtable<Value, Key, HashFcn, ExtractKey, EqualKey, Alloc>::resize(size_ty
 	if (n > old_n) {
 		size_type new_n = next_size(n);
 		if (new_n > old_n) {
-			vector<node_ptr, Alloc> temp(new_n, nullptr);
+			vector<node_ptr, Alloc> temp(new_n, nullptr, get_allocator());
 			try {
 				for (size_type i = 0; i < old_n; ++i) {
 					node_ptr first = buckets[i];
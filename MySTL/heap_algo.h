@@ -132,7 +132,7 @@ void pop_heap(RandomAccessIterator first, RandomAccessIterator last, Compare com
 template<class RandomAccessIterator>
 void sort_heap(RandomAccessIterator first, RandomAccessIterator last) {
 	while (last - first > 1)
-		pop_heap(first, last--);
+		mystl::pop_heap(first, last--);
 }
 
 // Զ
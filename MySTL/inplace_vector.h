@@ -0,0 +1,548 @@
+#ifndef MYSTL_INPLACE_VECTOR_H
+#define MYSTL_INPLACE_VECTOR_H
+
+// ļinplace_vector
+// ڱȷ, Ԫȫڶڲ, Ӳռ
+// ʱ׳bad_alloc, try_push_backtry_emplace_backʱnullptr
+// Tƽʱinplace_vectorҲƽ, ֱmemcpy
+// ӿںvectorͬ, ûз
+
+#include <new>									// bad_alloc
+#include "vector.h"
+
+namespace mystl {
+
+// inplace_vectorĴ洢
+// TƽʱơƶʹĬϰ汾, inplace_vectorҲƽ
+template<class T, size_t N, bool = std::is_trivially_copyable<T>::value>
+class inplace_vector_base {
+protected:
+	size_t len;
+	typename std::aligned_storage<sizeof(T), alignof(T)>::type buffer[N];
+
+	inplace_vector_base() : len(0) {};
+
+	T* ptr() {
+		return reinterpret_cast<T*>(buffer);
+	}
+
+	const T* ptr() const {
+		return reinterpret_cast<const T*>(buffer);
+	}
+};
+
+// ơƶԪ
+template<class T, size_t N>
+class inplace_vector_base<T, N, false> {
+protected:
+	size_t len;
+	typename std::aligned_storage<sizeof(T), alignof(T)>::type buffer[N];
+
+	inplace_vector_base() : len(0) {};
+
+	inplace_vector_base(const inplace_vector_base& rhs) : len(0) {
+		mystl::uninitialized_copy(rhs.ptr(), rhs.ptr() + rhs.len, ptr());
+		len = rhs.len;
+	}
+
+	// rhsԪرƶ, 
+	inplace_vector_base(inplace_vector_base&& rhs) noexcept(std::is_nothrow_move_constructible<T>::value) : len(0) {
+		mystl::uninitialized_move(rhs.ptr(), rhs.ptr() + rhs.len, ptr());
+		len = rhs.len;
+	}
+
+	inplace_vector_base& operator=(const inplace_vector_base& rhs) {
+		if (this != &rhs)
+			assign_elements(rhs.ptr(), rhs.len, std::false_type());
+		return *this;
+	}
+
+	inplace_vector_base& operator=(inplace_vector_base&& rhs) noexcept(std::is_nothrow_move_assignable<T>::value &&
+		std::is_nothrow_move_constructible<T>::value) {
+		if (this != &rhs)
+			assign_elements(rhs.ptr(), rhs.len, std::true_type());
+		return *this;
+	}
+
+	~inplace_vector_base() {
+		mystl::destroy(ptr(), ptr() + len);
+	}
+
+	T* ptr() {
+		return reinterpret_cast<T*>(buffer);
+	}
+
+	const T* ptr() const {
+		return reinterpret_cast<const T*>(buffer);
+	}
+
+private:
+	// ǰͬԪֱӸֵ, Ĺ
+	// MoveΪtrue_typeʱƶrhsԪ
+	template<class Move>
+	void assign_elements(const T* src, size_t n, Move) {
+		T* s = const_cast<T*>(src);
+		size_t common = len < n ? len : n;
+		if (Move::value)
+			mystl::move(s, s + common, ptr());
+		else
+			mystl::copy(src, src + common, ptr());
+		if (n > len) {
+			if (Move::value)
+				mystl::uninitialized_move(s + len, s + n, ptr() + len);
+			else
+				mystl::uninitialized_copy(src + len, src + n, ptr() + len);
+		}
+		else {
+			mystl::destroy(ptr() + n, ptr() + len);
+		}
+		len = n;
+	}
+};
+
+// inplace_vector
+template<class T, size_t N>
+class inplace_vector : private inplace_vector_base<T, N> {
+	static_assert(N > 0, "inplace_vector needs a positive capacity");
+
+	typedef inplace_vector_base<T, N>					base;
+
+public:
+	// 
+	typedef T											value_type;
+	typedef T*											pointer;
+	typedef const T*									const_pointer;
+	typedef T*											iterator;
+	typedef const T*									const_iterator;
+	typedef T&											reference;
+	typedef const T&									const_reference;
+	typedef size_t										size_type;
+	typedef ptrdiff_t									difference_type;
+	typedef mystl::reverse_iterator<iterator>			reverse_iterator;
+	typedef mystl::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+public:
+	//-----------------------------------------------------졢ƺ---------------------------------------------------
+	// ơƶʹinplace_vector_baseİ汾
+	inplace_vector() {};
+
+	explicit inplace_vector(size_type n) {
+		resize(n);
+	}
+
+	inplace_vector(size_type n, const T& value) {
+		fill_insert(end(), n, value);
+	}
+
+	template<class InputIterator>
+	inplace_vector(InputIterator first, InputIterator last) {
+		insert(end(), first, last);
+	}
+
+	inplace_vector(std::initializer_list<value_type> ilist) {
+		insert(end(), ilist.begin(), ilist.end());
+	}
+
+	inplace_vector& operator=(std::initializer_list<value_type> ilist) {
+		assign(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	iterator begin() {
+		return base::ptr();
+	}
+
+	const_iterator begin() const {
+		return base::ptr();
+	}
+
+	iterator end() {
+		return base::ptr() + base::len;
+	}
+
+	const_iterator end() const {
+		return base::ptr() + base::len;
+	}
+
+	reverse_iterator rbegin() {
+		return reverse_iterator(end());
+	}
+
+	const_reverse_iterator rbegin() const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend() {
+		return reverse_iterator(begin());
+	}
+
+	const_reverse_iterator rend() const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin() const {
+		return begin();
+	}
+
+	const_iterator cend() const {
+		return end();
+	}
+
+	const_reverse_iterator crbegin() const {
+		return rbegin();
+	}
+
+	const_reverse_iterator crend() const {
+		return rend();
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	size_type size() const {
+		return base::len;
+	}
+
+	static size_type max_size() {
+		return N;
+	}
+
+	static size_type capacity() {
+		return N;
+	}
+
+	bool empty() const {
+		return 0 == base::len;
+	}
+
+	bool full() const {
+		return N == base::len;
+	}
+
+	// ̶, ֻnǷ񳬹
+	void reserve(size_type n) {
+		check_capacity(n);
+	}
+
+	void shrink_to_fit() {};
+
+	//-----------------------------------------------------Ԫغ---------------------------------------------------------
+	reference operator[](size_type n) {
+		assert(n < size());
+		return *(begin() + n);
+	}
+
+	const_reference operator[](size_type n) const {
+		assert(n < size());
+		return *(begin() + n);
+	}
+
+	reference at(size_type n) {
+		if (!(n < size()))
+			throw std::out_of_range("inplace_vector<T>::at() subscript out of range");
+		return (*this)[n];
+	}
+
+	const_reference at(size_type n) const {
+		if (!(n < size()))
+			throw std::out_of_range("inplace_vector<T>::at() subscript out of range");
+		return (*this)[n];
+	}
+
+	reference front() {
+		assert(!empty());
+		return *begin();
+	}
+
+	const_reference front() const {
+		assert(!empty());
+		return *begin();
+	}
+
+	reference back() {
+		assert(!empty());
+		return *(end() - 1);
+	}
+
+	const_reference back() const {
+		assert(!empty());
+		return *(end() - 1);
+	}
+
+	pointer data() {
+		return begin();
+	}
+
+	const_pointer data() const {
+		return begin();
+	}
+
+	//-------------------------------------------------޸ز----------------------------------------------------------
+	// 1. ֵ
+	void assign(size_type n, const value_type& value) {
+		clear();
+		fill_insert(end(), n, value);
+	}
+
+	// 2. ֵ(ģʽ)
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last) {
+		clear();
+		insert(end(), first, last);
+	}
+
+	// 3. β˲Ԫ, ʱ׳bad_alloc
+	void push_back(const value_type& value) {
+		emplace_back(value);
+	}
+
+	void push_back(value_type&& value) {
+		emplace_back(std::move(value));
+	}
+
+	// 4. βֱӹԪ, ʱ׳bad_alloc
+	template<class... Args>
+	reference emplace_back(Args&&... args) {
+		check_capacity(size() + 1);
+		return unchecked_emplace_back(std::forward<Args>(args)...);
+	}
+
+	// 5. ʱʲôҲ, nullptr
+	pointer try_push_back(const value_type& value) {
+		return try_emplace_back(value);
+	}
+
+	pointer try_push_back(value_type&& value) {
+		return try_emplace_back(std::move(value));
+	}
+
+	template<class... Args>
+	pointer try_emplace_back(Args&&... args) {
+		if (full())
+			return nullptr;
+		return &unchecked_emplace_back(std::forward<Args>(args)...);
+	}
+
+	// 6. ֤߱û
+	template<class... Args>
+	reference unchecked_emplace_back(Args&&... args) {
+		assert(!full());
+		mystl::construct(end(), std::forward<Args>(args)...);
+		++base::len;
+		return back();
+	}
+
+	// 7. һԪ
+	void pop_back() {
+		assert(!empty());
+		--base::len;
+		mystl::destroy(end());
+	}
+
+	// 8. 뵥Ԫ
+	iterator insert(iterator position, const value_type& value) {
+		return emplace(position, value);
+	}
+
+	iterator insert(iterator position, value_type&& value) {
+		return emplace(position, std::move(value));
+	}
+
+	// 9. ָλֱӹԪ
+	template<class... Args>
+	iterator emplace(iterator position, Args&&... args);
+
+	// 10. Ԫ
+	void insert(iterator position, size_type n, const value_type& value) {
+		fill_insert(position, n, value);
+	}
+
+	// 11. ģ, Ԫ
+	template<class InputIterator>
+	void insert(iterator position, InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		insert_dispatch(position, first, last, Integer());
+	}
+
+	// 12. ɾԪ
+	iterator erase(iterator position) {
+		return erase(position, position + 1);
+	}
+
+	// 13. ɾԪ
+	iterator erase(iterator first, iterator last);
+
+	// 14. ɾԪ
+	void clear() {
+		mystl::destroy(begin(), end());
+		base::len = 0;
+	}
+
+	// 15. С, ֵ
+	void resize(size_type n, const value_type& value) {
+		check_capacity(n);
+		if (n < size())
+			erase(begin() + n, end());
+		else
+			fill_insert(end(), n - size(), value);
+	}
+
+	// 16. С, Ԫֵʼ
+	void resize(size_type n) {
+		check_capacity(n);
+		if (n < size())
+			erase(begin() + n, end());
+		while (size() < n)
+			unchecked_emplace_back();
+	}
+
+	// 17. , Ԫ, Ԫذᵽһ
+	void swap(inplace_vector& rhs);
+
+private:
+	//-------------------------------------------------------------------------------------------------------------------
+	static void check_capacity(size_type n) {
+		if (n > N)
+			throw std::bad_alloc();
+	}
+
+	// ɾʹmystl_uninitialized.hкvectorõĺ, ͨfinishָ¼õԪ
+	// ػ׳쳣ʱfinishдlen
+	class finish_guard {
+	private:
+		inplace_vector& v;
+
+	public:
+		iterator finish;
+
+		explicit finish_guard(inplace_vector& rhs) : v(rhs), finish(rhs.end()) {};
+
+		~finish_guard() {
+			v.base::len = finish - v.begin();
+		}
+	};
+
+	void fill_insert(iterator position, size_type n, const value_type& value);
+
+	template<class Integer>
+	void insert_dispatch(iterator position, Integer n, Integer value, true_type) {
+		fill_insert(position, static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	void insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
+		range_insert(position, first, last, iterator_category(first));
+	}
+
+	template<class InputIterator>
+	void range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag);
+
+	template<class ForwardIterator>
+	void range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+};
+
+//--------------------------------------------------޸ز--------------------------------------------------------------
+// ָλֱӹԪ
+template<class T, size_t N>
+template<class... Args>
+typename inplace_vector<T, N>::iterator inplace_vector<T, N>::emplace(iterator position, Args&&... args) {
+	check_capacity(size() + 1);
+	finish_guard guard(*this);
+	mystl::emplace_in_place(position, guard.finish, std::forward<Args>(args)...);
+	return position;
+}
+
+// ɾԪ
+template<class T, size_t N>
+typename inplace_vector<T, N>::iterator inplace_vector<T, N>::erase(iterator first, iterator last) {
+	finish_guard guard(*this);
+	mystl::erase_in_place(first, last, guard.finish);
+	return first;
+}
+
+// 
+template<class T, size_t N>
+void inplace_vector<T, N>::swap(inplace_vector& rhs) {
+	if (this == &rhs)
+		return;
+	inplace_vector& shorter = size() < rhs.size() ? *this : rhs;
+	inplace_vector& longer = size() < rhs.size() ? rhs : *this;
+	size_type n = shorter.size();
+	for (size_type i = 0; i < n; i++)
+		mystl::swap(shorter[i], longer[i]);
+	mystl::uninitialized_move(longer.begin() + n, longer.end(), shorter.end());
+	shorter.base::len = longer.size();
+	longer.erase(longer.begin() + n, longer.end());
+}
+
+//------------------------------------------------------------------------------------------------------------
+// ָλònԪ
+template<class T, size_t N>
+void inplace_vector<T, N>::fill_insert(iterator position, size_type n, const value_type& value) {
+	if (0 == n)
+		return;
+	check_capacity(size() + n);
+	finish_guard guard(*this);
+	mystl::fill_insert_in_place(position, guard.finish, n, value);
+}
+
+// ָλò[first, last), input iterator汾
+template<class T, size_t N>
+template<class InputIterator>
+void inplace_vector<T, N>::range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag) {
+	for (; first != last; ++first) {
+		position = emplace(position, *first);
+		++position;
+	}
+}
+
+// ָλò[first, last), forward iterator汾
+template<class T, size_t N>
+template<class ForwardIterator>
+void inplace_vector<T, N>::range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type n = mystl::distance(first, last);
+	if (0 == n)
+		return;
+	check_capacity(size() + n);
+	finish_guard guard(*this);
+	mystl::range_insert_in_place(position, guard.finish, first, last, n);
+}
+
+//--------------------------------------------------ú(inplace_vector)----------------------------------------------------------
+template<class T, size_t N>
+inline bool operator==(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+	return (lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template<class T, size_t N>
+inline bool operator!=(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+	return !(lhs == rhs);
+}
+
+template<class T, size_t N>
+inline bool operator<(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+	return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<class T, size_t N>
+inline bool operator>=(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+	return !(lhs < rhs);
+}
+
+template<class T, size_t N>
+inline bool operator>(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+	return rhs < lhs;
+}
+
+template<class T, size_t N>
+inline bool operator<=(const inplace_vector<T, N>& lhs, const inplace_vector<T, N>& rhs) {
+	return !(rhs < lhs);
+}
+
+template<class T, size_t N>
+inline void swap(inplace_vector<T, N>& lhs, inplace_vector<T, N>& rhs) {
+	lhs.swap(rhs);
+}
+
+}	// mystl
+
+#endif
@@ -0,0 +1,154 @@
+#ifndef MYSTL_INPLACE_VECTOR_TEST_H
+#define MYSTL_INPLACE_VECTOR_TEST_H
+
+#include "test.h"
+#include "../MySTL/vector.h"
+#include "../MySTL/small_vector.h"
+#include "../MySTL/inplace_vector.h"
+#include <iostream>
+#include <string>
+#include <memory>
+#include <type_traits>
+
+namespace mystl {
+namespace inplace_vector_test {
+
+// count8intļ¼, ÿ¼
+// vectorÿδ͸ƶҪռ, inplace_vector<int, 8>ƽ, ֻһmemcpy
+#define INPLACE_VECTOR_DO_TEST(con, count) do {								\
+	clock_t start, end;														\
+	size_t sum = 0;															\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++) {									\
+		con v;																\
+		for (int j = 0; j < 8; j++)											\
+			v.push_back(static_cast<int>(i) + j);							\
+		con c1(v);															\
+		con c2;																\
+		c2 = c1;															\
+		sum += c2.size() + c2[7];											\
+	}																		\
+	end = clock();															\
+	if (0 == sum)															\
+		std::cout << "wrong sum";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define INPLACE_VECTOR_TEST(len1, len2, len3) do {							\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|         std         |";									\
+	INPLACE_VECTOR_DO_TEST(std::vector<int>, len1);							\
+	INPLACE_VECTOR_DO_TEST(std::vector<int>, len2);							\
+	INPLACE_VECTOR_DO_TEST(std::vector<int>, len3);							\
+	std::cout << "\n|        vector       |";								\
+	INPLACE_VECTOR_DO_TEST(mystl::vector<int>, len1);						\
+	INPLACE_VECTOR_DO_TEST(mystl::vector<int>, len2);						\
+	INPLACE_VECTOR_DO_TEST(mystl::vector<int>, len3);						\
+	std::cout << "\n|     small_vector    |";								\
+	INPLACE_VECTOR_DO_TEST(SMALL_VECTOR_INT8, len1);						\
+	INPLACE_VECTOR_DO_TEST(SMALL_VECTOR_INT8, len2);						\
+	INPLACE_VECTOR_DO_TEST(SMALL_VECTOR_INT8, len3);						\
+	std::cout << "\n|    inplace_vector   |";								\
+	INPLACE_VECTOR_DO_TEST(INPLACE_VECTOR_INT8, len1);						\
+	INPLACE_VECTOR_DO_TEST(INPLACE_VECTOR_INT8, len2);						\
+	INPLACE_VECTOR_DO_TEST(INPLACE_VECTOR_INT8, len3);						\
+	std::cout << "\n";														\
+} while(0)
+
+typedef mystl::small_vector<int, 8> SMALL_VECTOR_INT8;
+typedef mystl::inplace_vector<int, 8> INPLACE_VECTOR_INT8;
+
+void inplace_vector_test() {
+	std::cout << "[===============================================================]\n";
+	std::cout << "[------------- Run container test : inplace_vector -------------]\n";
+	std::cout << "[-------------------------- API test ---------------------------]\n";
+
+	int test[] = { 1, 2, 3, 4, 5 };
+	inplace_vector<int, 16> v1;
+	inplace_vector<int, 16> v2(10);
+	inplace_vector<int, 16> v3(10, 1);
+	inplace_vector<int, 16> v4(test, test + 5);
+	inplace_vector<int, 16> v5(v2);
+	inplace_vector<int, 16> v6(std::move(v2));
+	inplace_vector<int, 16> v7{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	inplace_vector<int, 16> v8, v9, v10;
+	v8 = v3;
+	v9 = std::move(v3);
+	v10 = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	FUN_AFTER(v1, v1.assign(8, 8));
+	FUN_AFTER(v1, v1.assign(test, test + 5));
+	FUN_AFTER(v1, v1.emplace(v1.begin(), 0));
+	FUN_AFTER(v1, v1.emplace_back(6));
+	FUN_AFTER(v1, v1.push_back(6));
+	FUN_AFTER(v1, v1.insert(v1.end(), 7));
+	FUN_AFTER(v1, v1.insert(v1.begin() + 3, 2, 3));
+	FUN_AFTER(v1, v1.insert(v1.begin(), test, test + 5));
+	FUN_AFTER(v1, v1.pop_back());
+	FUN_AFTER(v1, v1.erase(v1.begin()));
+	FUN_AFTER(v1, v1.erase(v1.begin(), v1.begin() + 2));
+	FUN_AFTER(v1, v1.swap(v4));
+
+	FUN_VALUE(*v1.begin());
+	FUN_VALUE(*(v1.end() - 1));
+	FUN_VALUE(*v1.rbegin());
+	FUN_VALUE(*(v1.rend() - 1));
+	FUN_VALUE(v1.front());
+	FUN_VALUE(v1.back());
+	FUN_VALUE(v1[0]);
+	FUN_VALUE(v1.at(1));
+
+	std::cout << std::boolalpha;
+	FUN_VALUE(v1.empty());
+	FUN_VALUE(v1.full());
+	FUN_VALUE((std::is_trivially_copyable<inplace_vector<int, 16>>::value));
+	FUN_VALUE((std::is_trivially_copyable<inplace_vector<std::string, 16>>::value));
+	std::cout << std::noboolalpha;
+
+	FUN_VALUE(v1.size());
+	FUN_VALUE(v1.capacity());
+	FUN_VALUE(sizeof(v1));
+
+	FUN_AFTER(v1, v1.resize(16, 9));
+	FUN_AFTER(v1, v1.resize(3));
+
+	// ʱ׳bad_alloc, try_push_backnullptr
+	inplace_vector<int, 2> full{ 1, 2 };
+	std::cout << std::boolalpha;
+	FUN_VALUE(full.try_push_back(3) == nullptr);
+	std::cout << std::noboolalpha;
+	try {
+		full.push_back(3);
+	}
+	catch (std::bad_alloc&) {
+		std::cout << " full.push_back(3) : bad_alloc\n";
+	}
+
+	inplace_vector<std::string, 4> vs;
+	vs.push_back(std::string(32, 'a'));
+	FUN_AFTER(vs, vs.emplace_back(3, 'b'));
+	FUN_AFTER(vs, vs.emplace(vs.begin(), "c"));
+	inplace_vector<std::string, 4> vs2(vs);
+	FUN_AFTER(vs2, vs2.erase(vs2.begin()));
+	FUN_AFTER(vs, vs.swap(vs2));
+
+	PASSED;
+
+#if PERFORMANCE_TEST_ON
+	std::cout << "[--------------------- Performance Testing ---------------------]\n";
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|  build + copy x 2   |";
+	INPLACE_VECTOR_TEST(M(LEN2), L(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	PASSED;
+#endif
+	std::cout << "[------------- End container test : inplace_vector -------------]\n";
+	std::cout << std::endl;
+	std::cout << std::endl;
+
+}
+
+}	// inplace_vector_test
+}	// mystl
+
+#endif
@@ -2,6 +2,7 @@
 #define MYSTL_ITERATOR_BASE_H
 
 #include <cstdlib>
+#include "type_traits.h"
 
 namespace mystl {
 
@@ -131,6 +132,26 @@ namespace mystl {
 		first += n;
 	}
 
+	// ֶε(segmented iterator)
+	// dequeɶĻ, ÿƶҪǷԽ
+	// 㷨ͨsegmented_iterator_traitsɶ, ÿһֱʹԭָ
+	// ĬϵĵǷֶε, ֶεҪƫػṩ:
+	//   segment_iterator / local_iterator : εͺͶڵ
+	//   segment(it) / local(it)           : ڵĶԼڶڵλ
+	//   begin(seg) / end(seg)             : һεֹλ
+	//   compose(seg, local)               : ɶκͶλúϳɵ, Ҫlocal != end(seg)
+	template<class Iterator>
+	struct segmented_iterator_traits {
+		typedef false_type is_segmented_iterator;
+	};
+
+	template<class Iterator>
+	inline typename segmented_iterator_traits<Iterator>::is_segmented_iterator
+	is_segmented(const Iterator&) {
+		typedef typename segmented_iterator_traits<Iterator>::is_segmented_iterator is_segmented_iterator;
+		return is_segmented_iterator();
+	}
+
 }	// mystl
 
 #endif
\ No newline at end of file
@@ -1,14 +1,17 @@
 #ifndef MYSTL_LIST_H
-#define MTSTL_LIST_H
+#define MYSTL_LIST_H
 
 #include "iterator.h"
 #include "memory.h"
 #include "type_traits.h"
+#include "algorithm.h"
 #include <cstddef>
 #include <cassert>
 
 namespace mystl {
 
+enum { LIST_CHAIN_NODES = BATCH_OBJS };		// ԪʱÿĽ, Ƿһ
+
 template<class T>
 struct list_node_base;
 
@@ -62,6 +65,18 @@ struct list_node : public list_node_base<T> {
 	}
 };
 
+// ȽеԪ, ڶԽָ
+template<class T, class Compare>
+struct list_node_compare {
+	Compare comp;
+
+	list_node_compare(const Compare& c) : comp(c) {};
+
+	bool operator()(const list_node<T>* x, const list_node<T>* y) {
+		return comp(x->data, y->data);
+	}
+};
+
 //-----------------------------------------------listĵ---------------------------------------------------------------
 // list_iterator_baseṹ
 template<class T>
@@ -239,14 +254,14 @@ struct list_const_iterator : public list_iterator_base<T> {
 //-----------------------------------------------list---------------------------------------------------------------
 // listĽṹ
 template<class T, class Alloc = alloc>
-class list {
+class list : private simple_alloc<list_node<T>, Alloc> {
 public:
 // ָ
 	typedef list_node_base<T>*										base_ptr;
 	typedef list_node<T>*											node_ptr;
 
 // 
-	typedef simple_alloc<T, Alloc>									allocator_type;
+	typedef Alloc													allocator_type;
 	typedef simple_alloc<T, Alloc>									data_allocator;
 	typedef simple_alloc<list_node_base<T>, Alloc>					base_allocator;
 	typedef simple_alloc<list_node<T>, Alloc>						node_allocator;
@@ -267,34 +282,40 @@ public:
 	typedef reverse_iterator<iterator>								reverse_iterator;
 
 // 
-	allocator_type get_allocator() {
-		return data_allocator();
+	allocator_type get_allocator() const {
+		return node_allocator::resource();
 	}
 
 private:
-// άһͷ
+// άһͷԪظ
+// Ԫظ롢ɾsplice, size()O(1)
 	node_ptr node;
+	size_type len;
 
 public:
 // 졢ƺ
 	list() ;
 
+	explicit list(const Alloc& a);
+
 	explicit list(size_type n);
 	
-	list(size_type n, const value_type& value);
+	list(size_type n, const value_type& value, const Alloc& a = Alloc());
 
 	template<class InputIterator>
-	list(InputIterator first, InputIterator last);
+	list(InputIterator first, InputIterator last, const Alloc& a = Alloc());
 
-	list(std::initializer_list<T> ilist);
+	list(std::initializer_list<T> ilist, const Alloc& a = Alloc());
 
-	list(const_pointer first, const_pointer last);
+	list(const_pointer first, const_pointer last, const Alloc& a = Alloc());
 
-	list(const_iterator first, const_iterator last);
+	list(const_iterator first, const_iterator last, const Alloc& a = Alloc());
 
 	list(const list<T, Alloc>& rhs);
 
-	list<T, Alloc>& operator=(list<T, Alloc>& rhs);
+	list(const list<T, Alloc>& rhs, const Alloc& a);
+
+	list<T, Alloc>& operator=(const list<T, Alloc>& rhs);
 
 	list<T, Alloc>& operator=(std::initializer_list<value_type> ilist);
 
@@ -431,6 +452,8 @@ private:
 
 	void put_node(node_ptr p);
 
+	void put_nodes(void* chain);
+
 	node_ptr create_node();
 
 	node_ptr create_node(const value_type& value);
@@ -443,6 +466,28 @@ private:
 	template<class InputIterator>
 	void insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type);
 
+	template<class InputIterator>
+	void range_insert(iterator position, InputIterator first, InputIterator last);
+
+	template<class InputIterator>
+	void range_insert_aux(iterator position, InputIterator first, InputIterator last, input_iterator_tag);
+
+	template<class ForwardIterator>
+	void range_insert_aux(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+	template<class ValueSource>
+	void chain_insert(iterator position, size_type n, ValueSource next_value);
+
+	void link_chain(iterator position, node_ptr first, node_ptr last, size_type n);
+
+	template<class StrictWeakOrdering>
+	bool pointer_sort(StrictWeakOrdering comp);
+
+	template<class StrictWeakOrdering>
+	void merge_sort(StrictWeakOrdering comp);
+
+	void destroy_chain(node_ptr first, size_type n);
+
 	void transfer(iterator position, iterator first, iterator last);
 
 };
@@ -453,6 +498,11 @@ list<T, Alloc>::list() {
 	allocate_and_init();
 }
 
+template<class T, class Alloc>
+list<T, Alloc>::list(const Alloc& a) : node_allocator(a) {
+	allocate_and_init();
+}
+
 template<class T, class Alloc>
 list<T, Alloc>::list(size_type n) {
 	allocate_and_init();
@@ -460,45 +510,63 @@ list<T, Alloc>::list(size_type n) {
 }
 
 template<class T, class Alloc>
-list<T, Alloc>::list(size_type n, const value_type& value) {
+list<T, Alloc>::list(size_type n, const value_type& value, const Alloc& a) : node_allocator(a) {
 	allocate_and_init();
 	insert(begin(), n, value);
 }
 
 template<class T, class Alloc>
 template<class InputIterator>
-list<T, Alloc>::list(InputIterator first, InputIterator last) {
+list<T, Alloc>::list(InputIterator first, InputIterator last, const Alloc& a) : node_allocator(a) {
 	allocate_and_init();
 	insert(begin(), first, last);
 }
 
 template<class T, class Alloc>
-list<T, Alloc>::list(std::initializer_list<T> ilist) {
+list<T, Alloc>::list(std::initializer_list<T> ilist, const Alloc& a) : node_allocator(a) {
 	allocate_and_init();
 	insert(begin(), ilist.begin(), ilist.end());
 }
 
 template<class T, class Alloc>
-list<T, Alloc>::list(const_pointer first, const_pointer last) {
+list<T, Alloc>::list(const_pointer first, const_pointer last, const Alloc& a) : node_allocator(a) {
 	allocate_and_init();
 	insert(begin(), first, last);
 }
 
 template<class T, class Alloc>
-list<T, Alloc>::list(const_iterator first, const_iterator last) {
+list<T, Alloc>::list(const_iterator first, const_iterator last, const Alloc& a) : node_allocator(a) {
 	allocate_and_init();
 	insert(begin(), first, last);
 }
 
+// ķselect_on_container_copy_construction
 template<class T, class Alloc>
-list<T, Alloc>::list(const list<T, Alloc>& rhs) {
+list<T, Alloc>::list(const list<T, Alloc>& rhs)
+	: node_allocator(node_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())) {
 	allocate_and_init();
 	insert(begin(), rhs.begin(), rhs.end());
 }
 
 template<class T, class Alloc>
-list<T, Alloc>& list<T, Alloc>::operator=(list<T, Alloc>& rhs) {
-	if (rhs != *this) {
+list<T, Alloc>::list(const list<T, Alloc>& rhs, const Alloc& a) : node_allocator(a) {
+	allocate_and_init();
+	insert(begin(), rhs.begin(), rhs.end());
+}
+
+template<class T, class Alloc>
+list<T, Alloc>& list<T, Alloc>::operator=(const list<T, Alloc>& rhs) {
+	if (this != &rhs) {
+		// Ҫɲȵķ, þɵķͷнͷ
+		if (node_allocator::replaced_on_copy(rhs)) {
+			clear();
+			node_allocator::deallocate(node);
+			node_allocator::propagate_copy(rhs);
+			allocate_and_init();
+		}
+		else {
+			node_allocator::propagate_copy(rhs);
+		}
 		iterator first1 = begin();
 		iterator last1 = end();
 		const_iterator first2 = rhs.cbegin();
@@ -512,8 +580,8 @@ list<T, Alloc>& list<T, Alloc>::operator=(list<T, Alloc>& rhs) {
 		else {
 			erase(first1, last1);
 		}
-		return *this;
 	}
+	return *this;
 }
 
 template<class T, class Alloc>
@@ -627,8 +695,7 @@ bool list<T, Alloc>::empty() const {
 template<class T, class Alloc>
 typename list<T, Alloc>::size_type 
 list<T, Alloc>::size() const {
-	size_type n = distance(begin(), end());
-	return n;
+	return len;
 }
 
 template<class T, class Alloc>
@@ -696,7 +763,7 @@ void list<T, Alloc>::assign(std::initializer_list<T>& ilist) {
 		insert(last1, first2, last2);
 	}
 	else {
-		erase(first2, last2);
+		erase(first1, last1);
 	}
 }
 
@@ -710,6 +777,7 @@ list<T, Alloc>::insert(iterator position, const value_type& value) {
 	temp->prev = position.node->prev;
 	position.node->prev->next = temp;
 	position.node->prev = temp;
+	++len;
 	return temp;
 }
 
@@ -717,7 +785,7 @@ list<T, Alloc>::insert(iterator position, const value_type& value) {
 template<class T, class Alloc>
 typename list<T, Alloc>::iterator 
 list<T, Alloc>::insert(iterator position) {
-	insert(position, T());
+	return insert(position, T());
 }
 
 // ָλǰֵܲΪnvalue
@@ -737,17 +805,13 @@ void list<T, Alloc>::insert(iterator position, InputIterator first, InputIterato
 // ָλǰֵܲΪfirstlast
 template<class T, class Alloc>
 void list<T, Alloc>::insert(iterator position, const T* first, const T* last) {
-	for (; first != last; ++first) {
-		insert(position, *first);
-	}
+	range_insert(position, first, last);
 }
 
 // ָλǰֵܲΪfirstlast
 template<class T, class Alloc>
 void list<T, Alloc>::insert(iterator position, const_iterator first, const_iterator last) {
-	for (; first != last; ++first) {
-		insert(position, *first);
-	}
+	range_insert(position, first, last);
 }
 
 // ͷһԪأһvalue
@@ -796,6 +860,7 @@ list<T, Alloc>::erase(iterator position) {
 	node_ptr n = static_cast<node_ptr>(position.node);
 	mystl::destroy(&n->data);
 	put_node(n);
+	--len;
 	return iterator(next_node);
 }
 
@@ -821,21 +886,29 @@ void list<T, Alloc>::clear() {
 	}
 	node->prev = node;
 	node->next = node;
+	len = 0;
 }
 
 // ָlistĴСnew_sizevalue(²ԪصֵԭԪصֵ)
+// Ԫظ֪, ʱɾλýϽһ߹ȥ
 template<class T, class Alloc>
 void list<T, Alloc>::resize(size_type new_size, const value_type& value) {
-	size_type len = 0;
-	iterator i = begin();
-	for (; i != end() && len < new_size; ++len, ++i)
-		;
-	if (len == new_size) {
-		erase(i, end());
+	if (new_size >= len) {
+		insert(end(), new_size - len, value);
+		return;
+	}
+	iterator i;
+	if (new_size < len / 2) {
+		i = begin();
+		for (size_type k = 0; k < new_size; ++k)
+			++i;
 	}
 	else {
-		insert(i, new_size - len, value);
+		i = end();
+		for (size_type k = len; k > new_size; --k)
+			--i;
 	}
+	erase(i, end());
 }
 
 // ָlistĴСһnew_size
@@ -847,7 +920,9 @@ void list<T, Alloc>::resize(size_type new_size) {
 // list
 template<class T, class Alloc>
 void list<T, Alloc>::swap(list<T, Alloc>& rhs) {
+	node_allocator::propagate_swap(rhs);
 	mystl::swap(node, rhs.node);
+	mystl::swap(len, rhs.len);
 }
 
 
@@ -857,6 +932,8 @@ template<class T, class Alloc>
 void list<T, Alloc>::splice(iterator position, list<T, Alloc>& other) {
 	if (other.node->next != other.node) {
 		transfer(position, other.begin(), other.end());
+		len += other.len;
+		other.len = 0;
 	}
 }
 
@@ -867,13 +944,23 @@ void list<T, Alloc>::splice(iterator position, list<T, Alloc>& other, iterator i
 	if (i == position || j == position)
 		return;
 	transfer(position, i, j);
+	++len;
+	--other.len;
 }
 
 // һв뵽position֮ǰ(ͬһlistҲܲͬһlist)
+// һlistƶһֽʱҪ, ΨһO(n)splice
 template<class T, class Alloc>
 void list<T, Alloc>::splice(iterator position, list<T, Alloc>& other, iterator first, iterator last) {
-	if (first != last)
-		transfer(position, first, last);
+	if (first == last)
+		return;
+	if (this != &other) {
+		size_type n = (first == other.begin() && last == other.end()) ? other.len
+			: static_cast<size_type>(mystl::distance(first, last));
+		len += n;
+		other.len -= n;
+	}
+	transfer(position, first, last);
 }
 
 // listнֵvalueĽ
@@ -910,6 +997,8 @@ void list<T, Alloc>::unique() {
 // listϲһlist
 template<class T, class Alloc>
 void list<T, Alloc>::merge(list<T, Alloc>& other) {
+	if (this == &other)
+		return;
 	iterator first1 = begin();
 	iterator last1 = end();
 	iterator first2 = other.begin();
@@ -926,6 +1015,8 @@ void list<T, Alloc>::merge(list<T, Alloc>& other) {
 	if (first2 != last2) {
 		transfer(last1, first2, last2);
 	}
+	len += other.len;
+	other.len = 0;
 }
 
 // list
@@ -943,28 +1034,9 @@ void list<T, Alloc>::reverse() {
 }
 
 // list(stlsortlistãΪҪΪrandom access)
-// 㷨˼ƹ鲢ͶƼӷ
 template<class T, class Alloc>
 void list<T, Alloc>::sort() {
-	if (node->next == node || node->next->next == node)
-		return;
-	list<T, Alloc> carry;
-	list<T, Alloc> counter[64];
-	int fill = 0;
-	while (!empty()) {
-		carry.splice(carry.begin(), *this, begin());
-		int i = 0;
-		while (i < fill && !counter[i].empty()) {
-			counter[i].merge(carry);
-			carry.swap(counter[i++]);
-		}
-		carry.swap(counter[i]);
-		if (i == fill)
-			++fill;
-	}
-	for (int i = 1; i < fill; ++i)
-		counter[i].merge(counter[i - 1]);
-	swap(counter[fill - 1]);
+	sort(mystl::less<T>());
 }
 
 // ģ庯removeĸĽԭֵȵΪģ
@@ -1006,6 +1078,8 @@ void list<T, Alloc>::unique(BinaryPredicate binary_pred) {
 template<class T, class Alloc>
 template<class StrictWeakOrdering>
 void list<T, Alloc>::merge(list<T, Alloc>& other, StrictWeakOrdering comp) {
+	if (this == &other)
+		return;
 	iterator first1 = begin();
 	iterator last1 = end();
 	iterator first2 = other.begin();
@@ -1021,31 +1095,19 @@ void list<T, Alloc>::merge(list<T, Alloc>& other, StrictWeakOrdering comp) {
 	}
 	if (first2 != last2)
 		transfer(last1, first2, last2);
+	len += other.len;
+	other.len = 0;
 }
 
 // ģ庯sortĸĽ棬ԭСڹϵΪģ
+// ʹpointer_sort, 벻ʱʹmerge_sort, ߶ȶ
 template<class T, class Alloc>
 template<class StrictWeakOrdering>
 void list<T, Alloc>::sort(StrictWeakOrdering comp) {
 	if (node->next == node || node->next->next == node)
 		return;
-	list<T, Alloc> carry;
-	list<T, Alloc> counter[64];
-	int fill = 0;
-	while (!empty()) {
-		splice(carry.begin(), *this, begin());
-		int i = 0;
-		while (i < fill && !counter[i].empty()) {
-			counter[i].merge(carry, comp);
-			carry.swap(counter[i++]);
-		}
-		carry.swap(counter[i]);
-		if (i == fill)
-			fill++;
-	}
-	for (int i = 1; i < fill; ++i)
-		counter[i].merge(counter[i - 1], comp);
-	swap(counter[fill - 1]);
+	if (!pointer_sort(comp))
+		merge_sort(comp);
 }
 
 
@@ -1057,6 +1119,7 @@ void list<T, Alloc>::allocate_and_init() {
 	node = node_allocator::allocate(1);
 	node->prev = node;
 	node->next = node;
+	len = 0;
 }
 
 // listֵ
@@ -1124,6 +1187,18 @@ void list<T, Alloc>::put_node(node_ptr p) {
 	node_allocator::deallocate(p, 1);
 }
 
+// allocate_chainõĻûйĽռ
+// ú:
+// 1. chain_insert() -> put_nodes
+template<class T, class Alloc>
+void list<T, Alloc>::put_nodes(void* chain) {
+	while (chain != nullptr) {
+		void* next = *static_cast<void**>(chain);
+		put_node(static_cast<node_ptr>(chain));
+		chain = next;
+	}
+}
+
 // һ㲢cֵ
 // ú:
 // 1. insert(iterator position, const value_type& value) -> create_node
@@ -1135,8 +1210,8 @@ list<T, Alloc>::create_node() {
 		mystl::construct(p, T());
 	}
 	catch (...) {
-		mystl::destroy(p);
 		put_node(p);
+		throw;
 	}
 	return p;
 }
@@ -1152,8 +1227,8 @@ list<T, Alloc>::create_node(const value_type& value) {
 		mystl::construct(p, value);
 	}
 	catch (...) {
-		mystl::destroy(p);
 		put_node(p);
+		throw;
 	}
 	return p;
 }
@@ -1164,8 +1239,7 @@ list<T, Alloc>::create_node(const value_type& value) {
 // 2. insert(n, value) -> fill_insert
 template<class T, class Alloc>
 void list<T, Alloc>::fill_insert(iterator position, size_type n, const value_type& value) {
-	for (; n > 0; --n)
-		insert(position, value);
+	chain_insert(position, n, [&]() -> const value_type& { return value; });
 }
 
 // ģ庯ģΪʱinsert
@@ -1183,8 +1257,175 @@ void list<T, Alloc>::insert_dispatch(iterator position, Integer n, Integer value
 template<class T, class Alloc>
 template<class InputIterator>
 void list<T, Alloc>::insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
-	for (; first != last; ++first)
-		insert(position, *first);
+	range_insert(position, first, last);
+}
+
+// ú:
+// 1. insert(first, last) -> insert_dispatch -> range_insert
+// 2. insert(const T*, const T*) -> range_insert
+// 3. insert(const_iterator, const_iterator) -> range_insert
+template<class T, class Alloc>
+template<class InputIterator>
+void list<T, Alloc>::range_insert(iterator position, InputIterator first, InputIterator last) {
+	range_insert_aux(position, first, last, iterator_category(first));
+}
+
+// Ȳ֪Ԫظ, 㴮һ, һνӵposition֮ǰ
+// ʱѾĽ, listֲ
+template<class T, class Alloc>
+template<class InputIterator>
+void list<T, Alloc>::range_insert_aux(iterator position, InputIterator first, InputIterator last, input_iterator_tag) {
+	if (first == last)
+		return;
+	node_ptr head = create_node(*first);
+	node_ptr tail = head;
+	size_type count = 1;
+	try {
+		for (++first; first != last; ++first, ++count) {
+			node_ptr p = create_node(*first);
+			tail->next = p;
+			p->prev = tail;
+			tail = p;
+		}
+	}
+	catch (...) {
+		destroy_chain(head, count);
+		throw;
+	}
+	link_chain(position, head, tail, count);
+}
+
+// ǰԪظ, fill_insertһ
+template<class T, class Alloc>
+template<class ForwardIterator>
+void list<T, Alloc>::range_insert_aux(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type n = static_cast<size_type>(mystl::distance(first, last));
+	chain_insert(position, n, [&]() -> decltype(*first) {
+		decltype(*first) value = *first;
+		++first;
+		return value;
+	});
+}
+
+// allocate_chainÿLIST_CHAIN_NODESĿռ, ι첢һ, һνӵposition֮ǰ
+// һȫnʱҪȰn鴮ٻͷ, nܴʱڰڴһ, 
+// next_value()θÿĳֵ
+// ʱѾĽ㲢ȫռ, listֲ
+// ú:
+// 1. fill_insert() -> chain_insert
+// 2. range_insert() -> range_insert_aux(forward_iterator_tag) -> chain_insert
+template<class T, class Alloc>
+template<class ValueSource>
+void list<T, Alloc>::chain_insert(iterator position, size_type n, ValueSource next_value) {
+	if (0 == n)
+		return;
+	void* rest = nullptr;
+	node_ptr first = nullptr;
+	node_ptr last = nullptr;
+	node_ptr p = nullptr;
+	size_type count = 0;
+	try {
+		for (; count < n; ++count) {
+			p = nullptr;
+			if (nullptr == rest)
+				rest = node_allocator::allocate_chain(mystl::min(n - count, static_cast<size_type>(LIST_CHAIN_NODES)));
+			p = static_cast<node_ptr>(rest);
+			rest = *static_cast<void**>(rest);
+			mystl::construct(p, next_value());
+			if (nullptr == first) {
+				first = p;
+			}
+			else {
+				last->next = p;
+				p->prev = last;
+			}
+			last = p;
+		}
+	}
+	catch (...) {
+		destroy_chain(first, count);
+		if (p != nullptr)
+			put_node(p);
+		put_nodes(rest);
+		throw;
+	}
+	link_chain(position, first, last, n);
+}
+
+// һfirstlastnӵposition֮ǰ
+template<class T, class Alloc>
+void list<T, Alloc>::link_chain(iterator position, node_ptr first, node_ptr last, size_type n) {
+	base_ptr prev = position.node->prev;
+	prev->next = first;
+	first->prev = prev;
+	last->next = position.node;
+	position.node->prev = last;
+	len += n;
+}
+
+// ѽָռһĻ, stable_sort֮˳
+// 鲢ָϽ, ת, listĻʸߵö
+// ȽϺ׳쳣ʱlistûиĶ; ʱfalse
+// ú:
+// 1. sort(comp) -> pointer_sort
+template<class T, class Alloc>
+template<class StrictWeakOrdering>
+bool list<T, Alloc>::pointer_sort(StrictWeakOrdering comp) {
+	temporary_buffer<node_ptr*, node_ptr> buf(static_cast<ptrdiff_t>(len));
+	if (buf.size() < static_cast<ptrdiff_t>(len))
+		return false;
+	node_ptr* nodes = buf.begin();
+	base_ptr cur = node->next;
+	for (size_type i = 0; i < len; ++i, cur = cur->next)
+		nodes[i] = static_cast<node_ptr>(cur);
+	mystl::stable_sort(nodes, nodes + len, list_node_compare<T, StrictWeakOrdering>(comp));
+	base_ptr prev = node;
+	for (size_type i = 0; i < len; ++i) {
+		prev->next = nodes[i];
+		nodes[i]->prev = prev;
+		prev = nodes[i];
+	}
+	prev->next = node;
+	node->prev = prev;
+	return true;
+}
+
+// ҪռĹ鲢
+// 㷨˼ƹ鲢ͶƼӷ
+// ʱlistֻ֮spliceƶ㣬ͷ㣬ÿͷʼɷķ
+// ú:
+// 1. sort(comp) -> merge_sort
+template<class T, class Alloc>
+template<class StrictWeakOrdering>
+void list<T, Alloc>::merge_sort(StrictWeakOrdering comp) {
+	list<T, Alloc> carry(get_allocator());
+	list<T, Alloc> counter[64];
+	int fill = 0;
+	while (!empty()) {
+		carry.splice(carry.begin(), *this, begin());
+		int i = 0;
+		while (i < fill && !counter[i].empty()) {
+			counter[i].merge(carry, comp);
+			carry.splice(carry.end(), counter[i++]);
+		}
+		counter[i].splice(counter[i].end(), carry);
+		if (i == fill)
+			++fill;
+	}
+	for (int i = 1; i < fill; ++i)
+		counter[i].merge(counter[i - 1], comp);
+	splice(end(), counter[fill - 1]);
+}
+
+// һûнlistĽ
+template<class T, class Alloc>
+void list<T, Alloc>::destroy_chain(node_ptr first, size_type n) {
+	for (; n > 0; --n) {
+		node_ptr next = static_cast<node_ptr>(first->next);
+		mystl::destroy(&first->data);
+		put_node(first);
+		first = next;
+	}
 }
 
 // firstlast뵽positionλô
@@ -1214,6 +1455,8 @@ void list<T, Alloc>::transfer(iterator position, iterator first, iterator last)
 template<class T, class Alloc>
 bool operator==(const list<T, Alloc>& lhs, const list<T, Alloc>& rhs) {
 	typedef typename list<T, Alloc>::const_iterator const_iterator;
+	if (lhs.size() != rhs.size())
+		return false;
 	const_iterator first1 = lhs.begin();
 	const_iterator last1 = lhs.end();
 	const_iterator first2 = rhs.begin();
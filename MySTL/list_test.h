@@ -2,6 +2,8 @@
 #define MYSTL_LIST_TEST_H
 
 #include <list>
+#include <vector>
+#include <string>
 
 #include "test.h"
 #include "list.h"
@@ -12,6 +14,44 @@ namespace mystl {
 
 namespace list_test {
 
+// ѭеsize(), size()O(n)ʱѭO(n^2)
+#define LIST_SIZE_DO_TEST(NameSpace, count) do {							\
+	clock_t start, end;														\
+	NameSpace::list<int> l;													\
+	start = clock();														\
+	while (l.size() < count)												\
+		l.push_back(static_cast<int>(l.size()));							\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+// һβcountԪ: insert(pos, n, value)insert(pos, first, last)
+#define LIST_BULK_INSERT_DO_TEST(NameSpace, count) do {						\
+	clock_t start, end;														\
+	std::vector<int> v(count, 1);											\
+	NameSpace::list<int> l;													\
+	start = clock();														\
+	l.insert(l.end(), count, 1);											\
+	l.insert(l.begin(), v.data(), v.data() + v.size());						\
+	end = clock();															\
+	if (l.size() != 2 * count)												\
+		std::cout << "wrong size";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define LIST_TEST(TEST, len1, len2, len3) do {								\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|         std         |";									\
+	TEST(std, len1);														\
+	TEST(std, len2);														\
+	TEST(std, len3);														\
+	std::cout << "\n|        mystl        |";								\
+	TEST(mystl, len1);														\
+	TEST(mystl, len2);														\
+	TEST(mystl, len3);														\
+	std::cout << "\n";														\
+} while(0)
+
 void list_test() {
 	std::cout << "[===============================================================]\n";
 	std::cout << "[------------------ Run container test : list ------------------]\n";
@@ -62,6 +102,13 @@ void list_test() {
 	FUN_AFTER(l1, l1.splice(l1.begin(), l5, l5.begin()));
 	FUN_AFTER(l1, l1.splice(l1.end(), l6, l6.begin(), ++l6.begin()));
 	FUN_VALUE(l1.size());
+	FUN_VALUE(l6.size());
+	FUN_AFTER(l6, l6.splice(l6.begin(), l1, l1.begin(), l1.end()));
+	FUN_VALUE(l1.size());
+	FUN_VALUE(l6.size());
+	FUN_AFTER(l1, l1.splice(l1.begin(), l6));
+	FUN_VALUE(l1.size());
+	FUN_VALUE(l6.size());
 
 	FUN_AFTER(l1, l1.remove(0));
 	FUN_AFTER(l1, l1.remove_if([&](int a) {return a & 1;}));
@@ -72,10 +119,20 @@ void list_test() {
 	FUN_AFTER(l1, l1.unique());
 	FUN_AFTER(l1, l1.unique([&](int a, int b) {return b == a + 1; }));
 	FUN_AFTER(l1, l1.merge(l7));
+	FUN_VALUE(l1.size());
+	FUN_VALUE(l7.size());
 
 	FUN_AFTER(l1, l1.assign(l10.begin(), l10.end()));
 	FUN_AFTER(l1, l1.sort(mystl::greater<int>()));
 	FUN_AFTER(l1, l1.merge(l8, mystl::greater<int>()));
+	FUN_VALUE(l1.size());
+	FUN_VALUE(l8.size());
+
+	// sortȶ: ֻȽʮλʱ, ʮλͬԪرԭ˳
+	mystl::list<int> l11{ 31, 12, 35, 17, 33, 11, 24 };
+	FUN_AFTER(l11, l11.sort([](int a, int b) {return a / 10 < b / 10; }));
+	mystl::list<std::string> l12{ "bb", "a", "ccc", "ab" };
+	FUN_AFTER(l12, l12.sort());
 
 	FUN_AFTER(l1, l1.reverse());
 	FUN_AFTER(l1, l1.clear());
@@ -112,6 +169,12 @@ void list_test() {
 #endif
 	std::cout << std::endl;
 	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|  size() in the loop |";
+	LIST_TEST(LIST_SIZE_DO_TEST, M(LEN1), M(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|     bulk insert     |";
+	LIST_TEST(LIST_BULK_INSERT_DO_TEST, M(LEN1), M(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
 	PASSED;
 #endif
 	std::cout << "[------------------ End container test : list ------------------]" << std::endl;
@@ -55,7 +55,9 @@ public:
 	// ͸ƺ
 	map() : tree(Compare()) {};
 
-	explicit map(Compare comp) : tree(comp) {};
+	explicit map(Compare comp, const Alloc& a = Alloc()) : tree(comp, a) {};
+
+	explicit map(const Alloc& a) : tree(Compare(), a) {};
 
 	template<class InputIterator>
 	map(InputIterator first, InputIterator last) : tree(Compare()) {
@@ -63,7 +65,7 @@ public:
 	}
 
 	template<class InputIterator>
-	map(InputIterator first, InputIterator last, Compare comp) : tree(comp) {
+	map(InputIterator first, InputIterator last, Compare comp, const Alloc& a = Alloc()) : tree(comp, a) {
 		tree.insert_unique(first, last);
 	}
 
@@ -352,7 +354,9 @@ public:
 	// ͸ƺ
 	multimap() : tree(Compare()) {};
 
-	explicit multimap(Compare comp) : tree(comp) {};
+	explicit multimap(Compare comp, const Alloc& a = Alloc()) : tree(comp, a) {};
+
+	explicit multimap(const Alloc& a) : tree(Compare(), a) {};
 
 	template<class InputIterator>
 	multimap(InputIterator first, InputIterator last) : tree(Compare()) {
@@ -360,7 +364,7 @@ public:
 	}
 
 	template<class InputIterator>
-	multimap(InputIterator first, InputIterator last, Compare comp) : tree(comp) {
+	multimap(InputIterator first, InputIterator last, Compare comp, const Alloc& a = Alloc()) : tree(comp, a) {
 		tree.insert_equal(first, last);
 	}
 
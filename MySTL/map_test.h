@@ -6,6 +6,7 @@
 #include "mystl_pair.h"
 #include "map.h"
 #include <iostream>
+#include <string>
 
 namespace mystl {
 
@@ -34,6 +35,34 @@ namespace map_test {
 	std::cout << green << fun_name << ": <" << it.first << ", " << it.second << ">\n";		\
 } while(0)
 
+// stringֵ
+// malloc_allocӦȫֱӽmalloc, ںallocĴСԱ
+#define MAP_STRING_INSERT_DO_TEST(Alloc, count) do {						\
+	srand(static_cast<int>(time(0)));										\
+	clock_t start, end;														\
+	mystl::map<std::string, std::string, mystl::less<std::string>, Alloc> m;	\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++) {									\
+		std::string key = std::to_string(rand()) + std::to_string(i);		\
+		m.insert(mystl::make_pair(key, key));								\
+	}																		\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define MAP_STRING_INSERT_TEST(len1, len2, len3) do {						\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|    malloc_alloc     |";									\
+	MAP_STRING_INSERT_DO_TEST(mystl::malloc_alloc, len1);					\
+	MAP_STRING_INSERT_DO_TEST(mystl::malloc_alloc, len2);					\
+	MAP_STRING_INSERT_DO_TEST(mystl::malloc_alloc, len3);					\
+	std::cout << "\n|        alloc        |";								\
+	MAP_STRING_INSERT_DO_TEST(mystl::alloc, len1);							\
+	MAP_STRING_INSERT_DO_TEST(mystl::alloc, len2);							\
+	MAP_STRING_INSERT_DO_TEST(mystl::alloc, len3);							\
+	std::cout << "\n";														\
+} while(0)
+
 void map_test() {
 	std::cout << "[===============================================================]" << std::endl;
 	std::cout << "[------------------ Run container test : map -------------------]" << std::endl;
@@ -120,6 +149,21 @@ void map_test() {
 	MAP_INSERT_TEST(map, M(LEN1), M(LEN2), M(LEN3));
 #endif
 	std::cout << std::endl;
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|      iterate        |";
+#if LARGER_TEST_DATA_ON
+	MAP_ITERATE_TEST(map, XL(LEN1), XL(LEN2), XL(LEN3));
+#else
+	MAP_ITERATE_TEST(map, M(LEN1), M(LEN2), M(LEN3));
+#endif
+	std::cout << std::endl;
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|   string insert     |";
+#if LARGER_TEST_DATA_ON
+	MAP_STRING_INSERT_TEST(M(LEN1), M(LEN2), M(LEN3));
+#else
+	MAP_STRING_INSERT_TEST(S(LEN1), S(LEN2), S(LEN3));
+#endif
 	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
 	PASSED;
 #endif
@@ -2,25 +2,31 @@
 #define MYSTL_MEMORY_H
 
 #include "mystl_alloc.h"
+#include "mystl_arena.h"
 #include "mystl_construct.h"
 #include "mystl_uninitialized.h"
 
 namespace mystl {
 
 // ʱͷ
+// ʹõǰ̵߳scratch_arena, Ųʱϵͳ
 template<class ForwardIterator, class T>
 class temporary_buffer {
 private:
 	ptrdiff_t	original_len;
 	ptrdiff_t	len;
 	T*			buffer;
+	bool		from_scratch;	// bufferǷscratch_arena
 
 public:
 	temporary_buffer(ForwardIterator first, ForwardIterator last);
 
+	// ֱӸԪظ, Ҫ, Ԫزʼ(ָֻƽĬϹ)
+	explicit temporary_buffer(ptrdiff_t n);
+
 	~temporary_buffer() {
 		mystl::destroy(buffer, buffer + len);
-		free(buffer);
+		release_buffer();
 	}
 
 	T* begin() const {
@@ -47,6 +53,8 @@ private:
 private:
 	void allocate_buffer();
 
+	void release_buffer();
+
 	void initialize_buffer(const T&, std::true_type) {};
 
 	void initialize_buffer(const T& value, std::false_type) {
@@ -55,7 +63,8 @@ private:
 };
 
 template<class ForwardIterator, class T>
-temporary_buffer<ForwardIterator, T>::temporary_buffer(ForwardIterator first, ForwardIterator last) {
+temporary_buffer<ForwardIterator, T>::temporary_buffer(ForwardIterator first, ForwardIterator last)
+	: original_len(0), len(0), buffer(nullptr), from_scratch(false) {
 	try {
 		len = mystl::distance(first, last);
 		allocate_buffer();
@@ -64,17 +73,33 @@ temporary_buffer<ForwardIterator, T>::temporary_buffer(ForwardIterator first, Fo
 		}
 	}
 	catch (...) {
-		free(buffer);
-		buffer = nullptr;
-		len = 0;
+		release_buffer();
 	}
 }
 
+template<class ForwardIterator, class T>
+temporary_buffer<ForwardIterator, T>::temporary_buffer(ptrdiff_t n)
+	: original_len(0), len(n), buffer(nullptr), from_scratch(false) {
+	static_assert(std::is_trivially_default_constructible<T>::value,
+		"temporary_buffer(n) leaves the elements uninitialized");
+	allocate_buffer();
+}
+
+// 벻ռʱlenΪ0, ׳쳣
 template<class ForwardIterator, class T>
 void temporary_buffer<ForwardIterator, T>::allocate_buffer() {
 	original_len = len;
+	buffer = nullptr;
+	from_scratch = false;
 	if (len > static_cast<ptrdiff_t>(INT_MAX / sizeof(T)))
 		len = INT_MAX / sizeof(T);
+	if (len > 0 && alignof(T) <= SCRATCH_ALIGN) {
+		buffer = static_cast<T*>(scratch_arena::local().allocate(len * sizeof(T)));
+		if (buffer) {
+			from_scratch = true;
+			return;
+		}
+	}
 	while (len > 0) {
 		buffer = static_cast<T*>(malloc(len * sizeof(T)));
 		if (buffer)
@@ -83,6 +108,18 @@ void temporary_buffer<ForwardIterator, T>::allocate_buffer() {
 	}
 }
 
+// ͷ֮صջ״̬, ظ(繹ʧ֮)ͷһ
+template<class ForwardIterator, class T>
+void temporary_buffer<ForwardIterator, T>::release_buffer() {
+	if (from_scratch)
+		scratch_arena::local().deallocate(buffer, len * sizeof(T));
+	else
+		free(buffer);
+	buffer = nullptr;
+	len = 0;
+	from_scratch = false;
+}
+
 
 // ָauto_ptrģ
 template<class T>
@@ -0,0 +1,237 @@
+#ifndef MYSTL_MEMORY_RESOURCE_H
+#define MYSTL_MEMORY_RESOURCE_H
+
+// ļ˶̬ڴԴmemory_resource, Լʹķpolymorphic_alloc
+// ʱmemory_resource, ģ
+// ʹpolymorphic_allocͬһ, ʱлarenaڴ
+// ӿںstd::pmrͬ, reallocate, ڴغarenaԭչ
+
+#include <cstddef>								// max_align_t
+#include <cstring>								// memcpy
+#include <new>									// operator new
+#include <atomic>								// atomic
+#include <cassert>								// assert
+#include "mystl_alloc.h"
+#include "mystl_arena.h"
+
+namespace mystl {
+
+	// ڴԴĳӿ
+	// ʵdo_allocate, do_deallocatedo_is_equal, ѡʵdo_reallocate
+	class memory_resource {
+	public:
+		virtual ~memory_resource() {};
+
+		void* allocate(size_t bytes, size_t alignment = ALIGN) {
+			return do_allocate(bytes, alignment);
+		}
+
+		void deallocate(void* p, size_t bytes, size_t alignment = ALIGN) {
+			do_deallocate(p, bytes, alignment);
+		}
+
+		void* reallocate(void* p, size_t old_size, size_t new_size, size_t alignment = ALIGN) {
+			return do_reallocate(p, old_size, new_size, alignment);
+		}
+
+		bool is_equal(const memory_resource& rhs) const {
+			return do_is_equal(rhs);
+		}
+
+	protected:
+		virtual void* do_allocate(size_t bytes, size_t alignment) = 0;
+		virtual void do_deallocate(void* p, size_t bytes, size_t alignment) = 0;
+		virtual bool do_is_equal(const memory_resource& rhs) const = 0;
+
+		// Ĭ·һٸƹȥ
+		virtual void* do_reallocate(void* p, size_t old_size, size_t new_size, size_t alignment) {
+			void* res = do_allocate(new_size, alignment);
+			if (p != nullptr) {
+				std::memcpy(res, p, old_size < new_size ? old_size : new_size);
+				do_deallocate(p, old_size, alignment);
+			}
+			return res;
+		}
+	};
+
+	inline bool operator==(const memory_resource& lhs, const memory_resource& rhs) {
+		return &lhs == &rhs || lhs.is_equal(rhs);
+	}
+
+	inline bool operator!=(const memory_resource& lhs, const memory_resource& rhs) {
+		return !(lhs == rhs);
+	}
+
+	// ֱʹoperator newoperator delete
+	// ֲֻ֧max_align_tĶ
+	class new_delete_memory_resource : public memory_resource {
+	protected:
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			assert(alignment <= alignof(std::max_align_t));
+			(void)alignment;
+			return ::operator new(bytes);
+		}
+
+		void do_deallocate(void* p, size_t, size_t) override {
+			::operator delete(p);
+		}
+
+		bool do_is_equal(const memory_resource& rhs) const override {
+			return this == &rhs;
+		}
+	};
+
+	// ʹmystl::allocĴСڴ, ̰߳ȫ
+	// allocֻ֤ALIGN, Ҫʱoperator new
+	class pool_memory_resource : public memory_resource {
+	protected:
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			if (alignment > ALIGN) {
+				assert(alignment <= alignof(std::max_align_t));
+				return ::operator new(bytes);
+			}
+			return alloc::allocate(bytes);
+		}
+
+		void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+			if (alignment > ALIGN)
+				::operator delete(p);
+			else
+				alloc::deallocate(p, bytes);
+		}
+
+		// ڴmremapչ, Ҫ
+		void* do_reallocate(void* p, size_t old_size, size_t new_size, size_t alignment) override {
+			if (alignment > ALIGN)
+				return memory_resource::do_reallocate(p, old_size, new_size, alignment);
+			return alloc::reallocate(p, old_size, new_size);
+		}
+
+		bool do_is_equal(const memory_resource& rhs) const override {
+			return this == &rhs;
+		}
+	};
+
+	// ȫֵڴԴ, ڼһֱЧ
+	inline memory_resource* new_delete_resource() {
+		static new_delete_memory_resource res;
+		return &res;
+	}
+
+	inline memory_resource* pool_resource() {
+		static pool_memory_resource res;
+		return &res;
+	}
+
+	// ڴԴ, ռmonotonic_buffer
+	// ʲôҲ, release֮зһ, ̰߳ȫ
+	class monotonic_buffer_resource : public memory_resource {
+	private:
+		monotonic_buffer buf;
+
+	public:
+		explicit monotonic_buffer_resource(size_t block_bytes = ARENA_BLOCK_BYTES) : buf(block_bytes) {};
+
+		monotonic_buffer_resource(const monotonic_buffer_resource&) = delete;
+		monotonic_buffer_resource& operator=(const monotonic_buffer_resource&) = delete;
+
+		// з, ѾĿ
+		void reset() {
+			buf.reset();
+		}
+
+		// з, п黹ϵͳ
+		void release() {
+			buf.release();
+		}
+
+		size_t capacity() const {
+			return buf.capacity();
+		}
+
+	protected:
+		// monotonic_bufferALIGN, ҪʱһЩȡ
+		void* do_allocate(size_t bytes, size_t alignment) override {
+			if (alignment <= ALIGN)
+				return buf.allocate(bytes);
+			size_t p = reinterpret_cast<size_t>(buf.allocate(bytes + alignment - ALIGN));
+			return reinterpret_cast<void*>((p + alignment - 1) & ~(alignment - 1));
+		}
+
+		void do_deallocate(void*, size_t, size_t) override {};
+
+		// һηĿռԭչ
+		void* do_reallocate(void* p, size_t old_size, size_t new_size, size_t alignment) override {
+			if (alignment > ALIGN)
+				return memory_resource::do_reallocate(p, old_size, new_size, alignment);
+			return buf.reallocate(p, old_size, new_size);
+		}
+
+		bool do_is_equal(const memory_resource& rhs) const override {
+			return this == &rhs;
+		}
+	};
+
+	inline std::atomic<memory_resource*>& default_resource_ref() {
+		static std::atomic<memory_resource*> res(pool_resource());
+		return res;
+	}
+
+	// ĬϹpolymorphic_allocʹõڴԴ, Ĭpool_resource
+	inline memory_resource* get_default_resource() {
+		return default_resource_ref().load(std::memory_order_acquire);
+	}
+
+	// ԭڴԴ, nullptrʱָΪpool_resource
+	inline memory_resource* set_default_resource(memory_resource* r) {
+		if (nullptr == r)
+			r = pool_resource();
+		return default_resource_ref().exchange(r, std::memory_order_acq_rel);
+	}
+
+	// ΪmystlAllocķ, ֻһmemory_resourceָ
+	// std::pmr::polymorphic_allocatorͬ: Ƹֵ, ƶֵͽʱ,
+	// ƹʹĬڴԴ, ʹȵڴԴ
+	class polymorphic_alloc {
+	private:
+		memory_resource* res;
+
+	public:
+		polymorphic_alloc() : res(get_default_resource()) {};
+
+		polymorphic_alloc(memory_resource* r) : res(r) {
+			assert(r != nullptr);
+		}
+
+		void* allocate(size_t n) {
+			return res->allocate(n);
+		}
+
+		void deallocate(void* p, size_t n) {
+			res->deallocate(p, n);
+		}
+
+		void* reallocate(void* p, size_t old_size, size_t new_size) {
+			return res->reallocate(p, old_size, new_size);
+		}
+
+		memory_resource* resource() const {
+			return res;
+		}
+
+		polymorphic_alloc select_on_container_copy_construction() const {
+			return polymorphic_alloc();
+		}
+
+		bool operator==(const polymorphic_alloc& rhs) const {
+			return *res == *rhs.res;
+		}
+
+		bool operator!=(const polymorphic_alloc& rhs) const {
+			return !(*this == rhs);
+		}
+	};
+
+}	// mystl
+
+#endif
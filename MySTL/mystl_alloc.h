@@ -3,12 +3,60 @@
 
 #include <cstdlib>								// malloc
 #include <exception>							// bad_alloc
+#include <new>									// bad_alloc
+#include <mutex>								// mutex
+#include <cstring>								// memmove
+#include <cstdio>								// snprintf
+#include <climits>								// INT_MAX
+#include <ostream>								// ostream
+#include <cassert>								// assert
+#include <type_traits>							// false_type, is_empty
+#include <utility>								// swap
+
+// ǷͳÿСķͻմ
+// رʱͳƴȫֻslabͲֿЩҪάϢ
+#ifndef MYSTL_ALLOC_STATS
+#define MYSTL_ALLOC_STATS 0
+#endif
+
+#if MYSTL_ALLOC_STATS
+#include <atomic>								// atomic
+#define MYSTL_ALLOC_STAT(...) __VA_ARGS__
+#else
+#define MYSTL_ALLOC_STAT(...)
+#endif
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>							// mmap, munmap, mremap
+#define MYSTL_ALLOC_USE_MMAP 1
+#else
+#define MYSTL_ALLOC_USE_MMAP 0
+#endif
+
+// ֻLinuxṩmremap, Բݾչһӳڴ
+#if MYSTL_ALLOC_USE_MMAP && defined(__linux__) && defined(MREMAP_MAYMOVE)
+#define MYSTL_ALLOC_USE_MREMAP 1
+#else
+#define MYSTL_ALLOC_USE_MREMAP 0
+#endif
 
 namespace mystl {
 
 	enum { ALIGN = 8 };								// ڴ8ֽڶ
-	enum { MAX_TYTES = 128 };							// ĿռΪ128ֽ
-	enum { NFREELISTS = MAX_TYTES / ALIGN };			// freelistsһ16ָ
+	enum { SMALL_BYTES = 128 };						// 128ֽڰ8ֽڵִС
+	enum { MAX_TYTES = 32768 };						// ĿռΪ32KB, ֱӽmalloc
+	enum { MMAP_BYTES = 262144 };						// 256KBϵĴڴֱʹmmapӳ
+	enum { PAGE_BYTES = 4096 };						// ӳڴʱҳ
+	enum { NSMALL = SMALL_BYTES / ALIGN };				// Сһ16С
+	enum { CLASS_STEPS = 4 };							// 128ֽÿһ4С
+	enum { NFREELISTS = NSMALL + 8 * CLASS_STEPS };		// 128B~32KBһ8, freelistsһ48ָ
+	enum { BATCH_OBJS = 32 };							// ̻߳͹ֿ֮һ˵
+	enum { BATCH_BYTES = 16384 };						// һܴС(һĸ)
+	enum { MAX_BATCHES = 64 };							// ֿÿfreelistౣ
+	enum { SLAB_BYTES = 65536 };						// ÿСһϵͳslabС
+	enum { SLAB_MIN_OBJS = 8 };						// һslabг
+	enum { POOL_MIN_NODES = 16 };						// صһslabĽ, ֮ÿη
+	enum { POOL_SLAB_BYTES = MAX_TYTES };				// طС֮, ĴС
 
 	// free_listṹ
 	union freelist {
@@ -16,158 +64,1173 @@ namespace mystl {
 		char user_data[1];
 	};
 
+	// slabĵǼϢ
+	// slabʼַ򱣴棬ҵһĸslab
+	struct slab_info {
+		char* base;						// slabʼλ
+		size_t bytes;					// slabĴС
+		size_t free_bytes;				// trimʱͳƵĿֽ
+		size_t index;					// slabĴС
+	};
+
+	// һСͳϢ
+	struct alloc_class_stats {
+		size_t block_size;				// С
+		size_t allocations;				// (ҪMYSTL_ALLOC_STATS)
+		size_t deallocations;			// մ(ҪMYSTL_ALLOC_STATS)
+		size_t free_bytes;				// ֿ͵ǰ̻߳еĿֽ
+		size_t slabs;					// slab
+		size_t slab_bytes;				// slabֽ
+	};
+
+	// allocͳƿ
+	// ̻߳лûлܵļڿУԷͻմǽֵ
+	struct alloc_stats {
+		bool counters_enabled;			// ʱǷMYSTL_ALLOC_STATS
+		size_t heap_size;				// ϵͳһûй黹Ŀռ
+		size_t slabs;					// slabܸ
+		size_t free_bytes;				// дСĿֽ
+		size_t large_allocations;		// MAX_TYTESֱӽmallocĴ
+		size_t large_deallocations;		// MAX_TYTESֱӽfreeĴ
+		alloc_class_stats classes[NFREELISTS];
+	};
+
+	// ̻߳״̬
+	enum { CACHE_UNINIT = 0, CACHE_ACTIVE = 1, CACHE_DEAD = 2 };
+
+	// ̻߳
+	// ÿ̳߳һԼfreelistͻնҪ
+	// ֻƽͣthread_localʱҪĳʼ
+	struct thread_cache {
+		freelist* list[NFREELISTS];
+		size_t count[NFREELISTS];
+		int state;
+#if MYSTL_ALLOC_STATS
+		size_t allocs[NFREELISTS];				// ûлܵȫֵķ
+		size_t frees[NFREELISTS];				// ûлܵȫֵĻմ
+#endif
+	};
+
+	// ߳˳ʱ̻߳е黹ֿ
+	struct thread_cache_guard {
+		~thread_cache_guard();
+	};
+
 	// allocʵ
+	// С: 8, 16, ..., 128, 160, 192, 224, 256, 320, ..., 24576, 32768
+	// ÿСԼslab, ͬһslabֻгͬС
+	// ֿ(free_listbatch_list)slabdepot_mutex
+	// ̻߳ΪʱӲֿһȡһ飬ʱ黹
 	class alloc {
+		friend struct thread_cache_guard;
 	private:
-		static char* start_free;					// ڴؿʼλ
-		static char* end_free;						// ڴؽλ
-		static size_t heap_size;					// ѿռĿռ
-		static freelist* free_list[NFREELISTS];			// free_list
+		static char* slab_free[NFREELISTS];				// ÿСǰslabĿʼλ
+		static char* slab_end[NFREELISTS];				// ÿСǰslabĽλ
+		static size_t heap_size;					// ϵͳһûй黹Ŀռ
+		static slab_info* slabs;						// slabĵǼǱ(ʼַ)
+		static size_t nslabs;							// slabĸ
+		static size_t slabs_capacity;					// ǼǱ
+		static size_t depot_bytes;						// ֿпֽ
+		static size_t depot_objs[NFREELISTS];			// ֿÿfreelistĿ
+		static size_t class_slabs[NFREELISTS];			// ÿСslab
+#if MYSTL_ALLOC_STATS
+		static size_t class_allocs[NFREELISTS];			// ÿСܺķ
+		static size_t class_frees[NFREELISTS];			// ÿСܺĻմ
+		static std::atomic<size_t> large_allocs;		// ֱӽmallocķ
+		static std::atomic<size_t> large_frees;			// ֱӽfreeĻմ
+#endif
+		static size_t release_threshold;				// Զ黹ֵ, 0ʾԶ黹
+		static size_t release_trigger;					// depot_bytesֵʱԶ黹
+		static freelist* free_list[NFREELISTS];			// free_list(ֿɢ)
+		static freelist* batch_list[NFREELISTS][MAX_BATCHES];	// ֿ, ÿbatch_objs
+		static size_t batch_top[NFREELISTS];			// ÿfreelistǰ
+		static std::mutex depot_mutex;					// ֿslab
+		static thread_local thread_cache cache;			// ̻߳
+		static thread_local thread_cache_guard guard;	// ̻߳
+
+		static const unsigned short class_bytes[NFREELISTS];	// ÿСС
+		static const unsigned char class_batch[NFREELISTS];	// ÿСһ
 
-		static size_t round_up(size_t size);		// С8ı
 		static size_t freelist_index(size_t size);		// ѰҶӦСfreelist±
-		static void* refill(size_t size);				// freelist
-		static char* chunk_alloc(size_t size, int& n_objs);		// ڴط
+		static size_t class_size(size_t index);			// СӦС
+		static int batch_objs(size_t index);			// Сһ
+		static void* refill(size_t index);				// ̻߳
+		static char* chunk_alloc(size_t index, int& n_objs);	// slabз
+		static void activate_cache();					// һʹ̻߳ʱע
+		static void release_batch(size_t index);		// ̻߳ʱ黹ֿ
+		static void deallocate_slow(void* p, size_t size);		// ̻߳治ʱĻ
+		static void flush_cache();						// ̻߳ȫ黹ֿ
+		static void drain_cache(thread_cache& tc);		// ̻߳Żزֿ(߳)
+		static char* system_alloc(size_t bytes);		// ϵͳһslab
+		static void system_free(char* p, size_t bytes);	// һslab黹ϵͳ
+		static void register_slab(char* base, size_t bytes, size_t index);	// Ǽһµslab
+		static slab_info* find_slab(void* p);			// ҵڵslab
+		static size_t trim_locked();					// trimʵ(߳)
+		static void maybe_release();					// ֿʱԶ黹(߳)
+		static bool is_mapped(size_t size);				// СڴǷֱӳ
+		static size_t page_round(size_t size);			// ҳСı
+		static void* large_allocate(size_t size);		// MAX_TYTESķ
+		static void large_deallocate(void* p, size_t size);		// MAX_TYTESĻ
+		static void depot_add(size_t index, size_t n);	// ֿn(߳)
+		static void depot_sub(size_t index, size_t n);	// ֿn(߳)
+		static void fold_stats(thread_cache& tc, size_t index);	// ̵߳ļ(߳)
 
 
 	public:
 		static void* allocate(size_t size);
 		static void deallocate(void* p, size_t size);
+		// һnsizeֽڵ, ÿ鿪ͷָ봮ɵ
+		// ÿ鶼Եdeallocate
+		static void* allocate_chain(size_t size, size_t n);
+		// ·䲢ԭ(min(old_size, new_size)ֽ)
+		// ڴLinuxmremapչҪ
 		static void* reallocate(void* p, size_t old_size, size_t new_size);
+		// sizeֽʱʵʵõĴС: ڴСС, ӳڴʱҳСı
+		static size_t good_size(size_t size);
+
+		// ȫеslab黹ϵͳع黹ֽ
+		// ֻֿܿ͵ǰ̵߳Ļ棬̻߳еڵslabᱻ黹
+		static size_t trim();
+		// ֿеĿ鳬bytesֽʱԶtrim, 0ʾر
+		static void set_release_threshold(size_t bytes);
+
+		// ͳϢ
+		static alloc_stats stats();
+		static void dump_stats(std::ostream& os);
+		static void dump_stats_json(std::ostream& os);
 	};
 
-	char* alloc::start_free = nullptr;
-	char* alloc::end_free = nullptr;
+	char* alloc::slab_free[NFREELISTS] = {};
+	char* alloc::slab_end[NFREELISTS] = {};
 	size_t alloc::heap_size = 0;
-	freelist* alloc::free_list[NFREELISTS] = { nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
-							nullptr, nullptr, nullptr, nullptr, nullptr, nullptr,
-							nullptr, nullptr, nullptr, nullptr, };
+	slab_info* alloc::slabs = nullptr;
+	size_t alloc::nslabs = 0;
+	size_t alloc::slabs_capacity = 0;
+	size_t alloc::depot_bytes = 0;
+	size_t alloc::depot_objs[NFREELISTS] = {};
+	size_t alloc::class_slabs[NFREELISTS] = {};
+#if MYSTL_ALLOC_STATS
+	size_t alloc::class_allocs[NFREELISTS] = {};
+	size_t alloc::class_frees[NFREELISTS] = {};
+	std::atomic<size_t> alloc::large_allocs(0);
+	std::atomic<size_t> alloc::large_frees(0);
+#endif
+	size_t alloc::release_threshold = 0;
+	size_t alloc::release_trigger = 0;
+	freelist* alloc::free_list[NFREELISTS] = {};
+	freelist* alloc::batch_list[NFREELISTS][MAX_BATCHES] = {};
+	const unsigned short alloc::class_bytes[NFREELISTS] = {
+		8, 16, 24, 32, 40, 48, 56, 64, 72, 80, 88, 96, 104, 112, 120, 128,
+		160, 192, 224, 256, 320, 384, 448, 512, 640, 768, 896, 1024,
+		1280, 1536, 1792, 2048, 2560, 3072, 3584, 4096, 5120, 6144, 7168, 8192,
+		10240, 12288, 14336, 16384, 20480, 24576, 28672, 32768 };
+	// СһBATCH_OBJS, һBATCH_BYTES, 2
+	const unsigned char alloc::class_batch[NFREELISTS] = {
+		32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+		32, 32, 32, 32, 32, 32, 32, 32, 25, 21, 18, 16,
+		12, 10, 9, 8, 6, 5, 4, 4, 3, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2 };
+	size_t alloc::batch_top[NFREELISTS] = {};
+	std::mutex alloc::depot_mutex;
+	thread_local thread_cache alloc::cache = {};
+	thread_local thread_cache_guard alloc::guard;
+
 
+	// 128ֽڰ8ֽڶ
+	// 128ֽҵsize - 1λ, λλһеĵڼ
+	// : size = 300, size - 1 = 299 = 100101011b, λΪ8λ, λΪ00, Ӧ320ֽ
+	size_t alloc::freelist_index(size_t size) {
+		if (size <= static_cast<size_t>(SMALL_BYTES))
+			return (size + ALIGN - 1) / ALIGN - 1;
+		size_t s = size - 1;
+		size_t msb = 7;
+		while ((s >> (msb + 1)) != 0)
+			++msb;
+		return NSMALL + (msb - 7) * CLASS_STEPS + ((s >> (msb - 2)) & (CLASS_STEPS - 1));
+	}
 
-	// ԭĴС +7 ٽλ(ʵʹλʵ)
-	size_t alloc::round_up(size_t size) {
-		return (size + ALIGN - 1) & ~(ALIGN - 1);
+	size_t alloc::class_size(size_t index) {
+		return class_bytes[index];
 	}
 
-	size_t alloc::freelist_index(size_t size) {
-		return (size + ALIGN - 1) / ALIGN - 1;
+	int alloc::batch_objs(size_t index) {
+		return class_batch[index];
 	}
 
+	// ·ֻ̻߳棬
 	void* alloc::allocate(size_t size) {
 		if (size > static_cast<size_t>(MAX_TYTES))
-			return std::malloc(size);
-		freelist** my_freelist = free_list + freelist_index(size);
-		freelist* res = *my_freelist;
-		if (nullptr == res) {
-			void* r = refill(round_up(size));
-			return r;
-		}
-		*my_freelist = res->next;
+			return large_allocate(size);
+		thread_cache& tc = cache;
+		size_t index = freelist_index(size);
+		freelist* res = tc.list[index];
+		if (nullptr == res)
+			return refill(index);
+		tc.list[index] = res->next;
+		--tc.count[index];
+		MYSTL_ALLOC_STAT(++tc.allocs[index]);
 		return res;
 	}
 
 	void alloc::deallocate(void* p, size_t size) {
 		if (size > static_cast<size_t>(MAX_TYTES)) {
-			std::free(p);
+			large_deallocate(p, size);
 			return;
 		}
-		freelist** my_freelist = free_list + freelist_index(size);
-		static_cast<freelist*>(p)->next = *my_freelist;
-		*my_freelist = static_cast<freelist*>(p);
+		thread_cache& tc = cache;
+		if (tc.state != CACHE_ACTIVE) {
+			deallocate_slow(p, size);
+			return;
+		}
+		size_t index = freelist_index(size);
+		static_cast<freelist*>(p)->next = tc.list[index];
+		tc.list[index] = static_cast<freelist*>(p);
+		MYSTL_ALLOC_STAT(++tc.frees[index]);
+		if (++tc.count[index] > static_cast<size_t>(batch_objs(index) * 2))
+			release_batch(index);
+	}
+
+	// ȡ̻߳е, ʱֻһ, ӲֿȡֱӴslabг
+	// ʧʱѾȡȫ黹, Ȼ׳bad_alloc
+	void* alloc::allocate_chain(size_t size, size_t n) {
+		freelist* head = nullptr;
+		freelist** link = &head;
+		size_t got = 0;
+		if (size > static_cast<size_t>(MAX_TYTES)) {
+			try {
+				for (; got < n; ++got) {
+					*link = static_cast<freelist*>(large_allocate(size));
+					link = &(*link)->next;
+					*link = nullptr;
+				}
+			}
+			catch (...) {
+				while (head != nullptr) {
+					freelist* next = head->next;
+					large_deallocate(head, size);
+					head = next;
+				}
+				throw;
+			}
+			return head;
+		}
+		thread_cache& tc = cache;
+		if (CACHE_UNINIT == tc.state)
+			activate_cache();
+		size_t index = freelist_index(size);
+		// ̻߳е
+		freelist* p = tc.list[index];
+		for (; got < n && p != nullptr; ++got) {
+			*link = p;
+			link = &p->next;
+			p = p->next;
+		}
+		tc.list[index] = p;
+		tc.count[index] -= got;
+		*link = nullptr;
+		MYSTL_ALLOC_STAT(tc.allocs[index] += got);
+		if (got == n)
+			return head;
+		size_t csize = class_size(index);
+		size_t batch = batch_objs(index);
+		try {
+			std::lock_guard<std::mutex> lock(depot_mutex);
+			MYSTL_ALLOC_STAT(size_t from_depot = got);
+			// ʣµһʱֱӽ
+			while (n - got >= batch && batch_top[index] > 0) {
+				*link = batch_list[index][--batch_top[index]];
+				for (size_t i = 0; i < batch; i++)
+					link = &(*link)->next;
+				got += batch;
+				depot_sub(index, batch);
+			}
+			// ɢ
+			size_t taken = 0;
+			for (p = free_list[index]; got < n && p != nullptr; ++got, ++taken) {
+				*link = p;
+				link = &p->next;
+				p = p->next;
+			}
+			free_list[index] = p;
+			*link = nullptr;
+			depot_sub(index, taken);
+			// ֿҲʱslabг
+			while (got < n) {
+				size_t rest = n - got;
+				int n_objs = rest < static_cast<size_t>(INT_MAX) ? static_cast<int>(rest) : INT_MAX;
+				char* chunk = chunk_alloc(index, n_objs);
+				for (int i = 0; i < n_objs; i++) {
+					*link = reinterpret_cast<freelist*>(chunk + i * csize);
+					link = &(*link)->next;
+				}
+				*link = nullptr;
+				got += n_objs;
+			}
+			MYSTL_ALLOC_STAT(class_allocs[index] += got - from_depot);
+		}
+		catch (...) {
+			while (head != nullptr) {
+				freelist* next = head->next;
+				deallocate(head, size);
+				head = next;
+			}
+			throw;
+		}
+		return head;
 	}
 
+	// 1. ¾ɴСͬһСʱֱӷԭ
+	// 2. ¾ɴСӳĴڴʱʹmremap
+	// 3. ¾ɴСmallocʱʹrealloc
+	// 4. µĿռ䣬֮ԭĿռ
+	// ʧʱ׳bad_allocԭĿռ䲻Ӱ
 	void* alloc::reallocate(void* p, size_t old_size, size_t new_size) {
+		if (nullptr == p)
+			return allocate(new_size);
+		const size_t max_bytes = MAX_TYTES;
+		if (old_size <= max_bytes && new_size <= max_bytes
+			&& freelist_index(old_size) == freelist_index(new_size))
+			return p;
+		if (old_size > max_bytes && new_size > max_bytes) {
+			bool old_mapped = is_mapped(old_size);
+			bool new_mapped = is_mapped(new_size);
+#if MYSTL_ALLOC_USE_MREMAP
+			if (old_mapped && new_mapped) {
+				void* res = mremap(p, page_round(old_size), page_round(new_size), MREMAP_MAYMOVE);
+				if (MAP_FAILED == res)
+					throw std::bad_alloc();
+				return res;
+			}
+#endif
+			if (!old_mapped && !new_mapped) {
+				void* res = std::realloc(p, new_size);
+				if (nullptr == res)
+					throw std::bad_alloc();
+				return res;
+			}
+		}
+		void* res = allocate(new_size);
+		std::memcpy(res, p, old_size < new_size ? old_size : new_size);
 		deallocate(p, old_size);
-		p = allocate(new_size);
+		return res;
+	}
+
+	size_t alloc::good_size(size_t size) {
+		if (0 == size)
+			return 0;
+		if (size <= static_cast<size_t>(MAX_TYTES))
+			return class_size(freelist_index(size));
+		if (is_mapped(size))
+			return page_round(size);
+		return size;
+	}
+
+	bool alloc::is_mapped(size_t size) {
+		return MYSTL_ALLOC_USE_MMAP && size >= static_cast<size_t>(MMAP_BYTES);
+	}
+
+	size_t alloc::page_round(size_t size) {
+		return (size + PAGE_BYTES - 1) & ~static_cast<size_t>(PAGE_BYTES - 1);
+	}
+
+	// 256KBֱӳ䣬ʱϵͳmallocĿ
+	void* alloc::large_allocate(size_t size) {
+		MYSTL_ALLOC_STAT(large_allocs.fetch_add(1, std::memory_order_relaxed));
+#if MYSTL_ALLOC_USE_MMAP
+		if (is_mapped(size)) {
+			void* p = mmap(nullptr, page_round(size), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (MAP_FAILED == p)
+				throw std::bad_alloc();
+			return p;
+		}
+#endif
+		void* p = std::malloc(size);
+		if (nullptr == p)
+			throw std::bad_alloc();
 		return p;
 	}
 
-	void* alloc::refill(size_t size) {
-		int n_objs = 20;
-		char* chunk = chunk_alloc(size, n_objs);
-		if (1 == n_objs)
-			return chunk;
-		freelist* res = reinterpret_cast<freelist*>(chunk);
-		freelist** my_freelist = free_list + freelist_index(size);
-		*my_freelist = reinterpret_cast<freelist*>(chunk + size);
-		freelist* p = *my_freelist;
-		for (int i = 1; i < n_objs - 1; i++) {
-			p->next = reinterpret_cast<freelist*>(reinterpret_cast<char*>(p) + size);
-			p = p->next;
+	void alloc::large_deallocate(void* p, size_t size) {
+		MYSTL_ALLOC_STAT(large_frees.fetch_add(1, std::memory_order_relaxed));
+#if MYSTL_ALLOC_USE_MMAP
+		if (is_mapped(size)) {
+			munmap(p, page_round(size));
+			return;
+		}
+#endif
+		std::free(p);
+	}
+
+	// ̻߳Ϊʱ
+	// ȴӲֿȡһûȡɢ飬ûвڴ
+	void* alloc::refill(size_t index) {
+		thread_cache& tc = cache;
+		if (CACHE_UNINIT == tc.state)
+			activate_cache();
+		size_t size = class_size(index);
+		int batch = batch_objs(index);
+		freelist* chain = nullptr;
+		int n_objs = batch;
+		{
+			std::lock_guard<std::mutex> lock(depot_mutex);
+			MYSTL_ALLOC_STAT(++class_allocs[index]);
+			// ߳Ѿ˳ʹ̻߳
+			if (CACHE_DEAD == tc.state) {
+				freelist* res = free_list[index];
+				if (res != nullptr) {
+					free_list[index] = res->next;
+					depot_sub(index, 1);
+					return res;
+				}
+				n_objs = 1;
+				return chunk_alloc(index, n_objs);
+			}
+			if (batch_top[index] > 0) {
+				chain = batch_list[index][--batch_top[index]];
+				depot_sub(index, batch);
+			}
+			else if (free_list[index] != nullptr) {
+				chain = free_list[index];
+				freelist* p = chain;
+				for (n_objs = 1; n_objs < batch && p->next != nullptr; n_objs++)
+					p = p->next;
+				free_list[index] = p->next;
+				p->next = nullptr;
+				depot_sub(index, n_objs);
+			}
+			else {
+				char* chunk = chunk_alloc(index, n_objs);
+				if (1 == n_objs)
+					return chunk;
+				// 鴮
+				chain = reinterpret_cast<freelist*>(chunk);
+				n_objs = -n_objs;
+			}
+		}
+		// n_objsΪʾһ¿ռ䣬ûд
+		if (n_objs < 0) {
+			n_objs = -n_objs;
+			freelist* p = chain;
+			for (int i = 1; i < n_objs; i++) {
+				p->next = reinterpret_cast<freelist*>(reinterpret_cast<char*>(p) + size);
+				p = p->next;
+			}
+			p->next = nullptr;
 		}
-		p->next = nullptr;
+		tc.list[index] = chain->next;
+		tc.count[index] = n_objs - 1;
+		return chain;
+	}
+
+	// ӴСindexslabгn_objs
+	// slabĴСС, ֮󲻻Ŀռ
+	char* alloc::chunk_alloc(size_t index, int& n_objs) {
+		size_t size = class_size(index);
+		size_t bytes_left = slab_end[index] - slab_free[index];
+		// slabʣĴСһ鶼䣬һµslab
+		if (bytes_left < size) {
+			size_t slab_objs = SLAB_BYTES / size;
+			if (slab_objs < static_cast<size_t>(SLAB_MIN_OBJS))
+				slab_objs = SLAB_MIN_OBJS;
+			size_t bytes_alloc = slab_objs * size;
+			char* slab = system_alloc(bytes_alloc);
+			try {
+				register_slab(slab, bytes_alloc, index);
+			}
+			catch (...) {
+				system_free(slab, bytes_alloc);
+				throw;
+			}
+			slab_free[index] = slab;
+			slab_end[index] = slab + bytes_alloc;
+			bytes_left = bytes_alloc;
+		}
+		// slabʣĴСn_objsʱжٷ
+		if (bytes_left < size * n_objs)
+			n_objs = static_cast<int>(bytes_left / size);
+		char* res = slab_free[index];
+		slab_free[index] += size * n_objs;
 		return res;
 	}
 
-	char* alloc::chunk_alloc(size_t size, int& n_objs) {
-		size_t bytes_need = size * n_objs;
-		size_t bytes_left = end_free - start_free;
-		// ڴʣĴС20
-		if (bytes_left >= bytes_need) {
-			char* res = start_free;
-			start_free += bytes_need;
-			return res;
+	// guardõǰ߳˳ʱ
+	void alloc::activate_cache() {
+		thread_cache_guard* g = &guard;
+		(void)g;
+		cache.state = CACHE_ACTIVE;
+	}
+
+	// ̻߳ıͷһ()Żزֿ
+	void alloc::release_batch(size_t index) {
+		thread_cache& tc = cache;
+		int batch = batch_objs(index);
+		freelist* chain = tc.list[index];
+		freelist* tail = chain;
+		for (int i = 1; i < batch; i++)
+			tail = tail->next;
+		tc.list[index] = tail->next;
+		tc.count[index] -= batch;
+		tail->next = nullptr;
+		std::lock_guard<std::mutex> lock(depot_mutex);
+		if (batch_top[index] < static_cast<size_t>(MAX_BATCHES)) {
+			batch_list[index][batch_top[index]++] = chain;
 		}
-		// ڴʣĴС1
-		if (bytes_left >= size) {
-			n_objs = bytes_left / size;
-			char* res = start_free;
-			start_free += n_objs * size;
-			return res;
+		else {
+			tail->next = free_list[index];
+			free_list[index] = chain;
 		}
-		// ڴʣĴСһ鶼
-		// ȽڴʣĿռӵӦfreelist(ʣĿռһ8ı)
-		if (bytes_left > 0) {
-			freelist** my_freelist = free_list + freelist_index(bytes_left);
-			reinterpret_cast<freelist*>(start_free)->next = *my_freelist;
-			*my_freelist = reinterpret_cast<freelist*>(start_free);
-		}
-		// ҪĴС
-		size_t bytes_alloc = size * (20 + 20) + round_up(heap_size >> 4);
-		start_free = static_cast<char*>(std::malloc(bytes_alloc));
-		// ռʧ
-		// ûʣ˴ηfreelistоͽз䣬ûо׳쳣
-		if (nullptr == start_free) {
-			size_t index = freelist_index(size);
-			for (; index < NFREELISTS; index++) {
-				if (free_list[index] != nullptr) {
-					free_list[index] = free_list[index]->next;
-					start_free = reinterpret_cast<char*>(free_list[index]);
-					end_free = reinterpret_cast<char*>(free_list[index]) + (index + 1) * 8;
-					return chunk_alloc(size, n_objs);
-				}
+		depot_add(index, batch);
+		fold_stats(tc, index);
+		maybe_release();
+	}
+
+	// ̻߳滹ûû߳Ѿ˳ʱֱӹ黹ֿ
+	void alloc::deallocate_slow(void* p, size_t size) {
+		thread_cache& tc = cache;
+		if (CACHE_UNINIT == tc.state) {
+			activate_cache();
+			deallocate(p, size);
+			return;
+		}
+		size_t index = freelist_index(size);
+		std::lock_guard<std::mutex> lock(depot_mutex);
+		static_cast<freelist*>(p)->next = free_list[index];
+		free_list[index] = static_cast<freelist*>(p);
+		depot_add(index, 1);
+		MYSTL_ALLOC_STAT(++class_frees[index]);
+		maybe_release();
+	}
+
+	// ߳˳ʱ̻߳еŻزֿɢ
+	void alloc::flush_cache() {
+		thread_cache& tc = cache;
+		std::lock_guard<std::mutex> lock(depot_mutex);
+		drain_cache(tc);
+		tc.state = CACHE_DEAD;
+		maybe_release();
+	}
+
+	void alloc::drain_cache(thread_cache& tc) {
+		for (size_t index = 0; index < NFREELISTS; index++) {
+			freelist* chain = tc.list[index];
+			if (chain != nullptr) {
+				freelist* tail = chain;
+				while (tail->next != nullptr)
+					tail = tail->next;
+				tail->next = free_list[index];
+				free_list[index] = chain;
+				depot_add(index, tc.count[index]);
 			}
-			end_free = nullptr;
+			tc.list[index] = nullptr;
+			tc.count[index] = 0;
+			fold_stats(tc, index);
+		}
+	}
+
+	// Linuxϵͳslabֱʹmmap룬黹ʱmunmapRSS
+	// ϵͳʹmalloc/free
+	char* alloc::system_alloc(size_t bytes) {
+#if MYSTL_ALLOC_USE_MMAP
+		void* p = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (MAP_FAILED == p)
+			throw std::bad_alloc();
+		return static_cast<char*>(p);
+#else
+		void* p = std::malloc(bytes);
+		if (nullptr == p)
 			throw std::bad_alloc();
+		return static_cast<char*>(p);
+#endif
+	}
+
+	void alloc::system_free(char* p, size_t bytes) {
+#if MYSTL_ALLOC_USE_MMAP
+		munmap(p, bytes);
+#else
+		(void)bytes;
+		std::free(p);
+#endif
+	}
+
+	// ǼǱְʼַ
+	void alloc::register_slab(char* base, size_t bytes, size_t index) {
+		if (nslabs == slabs_capacity) {
+			size_t new_capacity = 0 == slabs_capacity ? 64 : slabs_capacity * 2;
+			slab_info* new_slabs = static_cast<slab_info*>(std::realloc(slabs, new_capacity * sizeof(slab_info)));
+			if (nullptr == new_slabs)
+				throw std::bad_alloc();
+			slabs = new_slabs;
+			slabs_capacity = new_capacity;
+		}
+		size_t i = nslabs;
+		while (i > 0 && slabs[i - 1].base > base)
+			--i;
+		std::memmove(slabs + i + 1, slabs + i, (nslabs - i) * sizeof(slab_info));
+		slabs[i].base = base;
+		slabs[i].bytes = bytes;
+		slabs[i].free_bytes = 0;
+		slabs[i].index = index;
+		++nslabs;
+		++class_slabs[index];
+		heap_size += bytes;
+	}
+
+	// ֲʼַpһslab
+	slab_info* alloc::find_slab(void* p) {
+		char* c = static_cast<char*>(p);
+		size_t lo = 0, hi = nslabs;
+		while (lo < hi) {
+			size_t mid = (lo + hi) / 2;
+			if (slabs[mid].base <= c)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		return slabs + lo - 1;
+	}
+
+	size_t alloc::trim() {
+		std::lock_guard<std::mutex> lock(depot_mutex);
+		thread_cache& tc = cache;
+		if (CACHE_ACTIVE == tc.state)
+			drain_cache(tc);
+		return trim_locked();
+	}
+
+	void alloc::set_release_threshold(size_t bytes) {
+		std::lock_guard<std::mutex> lock(depot_mutex);
+		release_threshold = bytes;
+		release_trigger = bytes;
+	}
+
+	// ֵʱ黹һΣһҪȲֿһֵŻᴥ
+	// ޷黹ռÿλնȥɨֿ
+	void alloc::maybe_release() {
+		if (release_threshold != 0 && depot_bytes > release_trigger) {
+			trim_locked();
+			release_trigger = depot_bytes + release_threshold;
+		}
+	}
+
+	// 1. ͳÿslabĿֽ(ֿеslabлûгĲ)
+	// 2. ֽslabСslabԹ黹
+	// 3. ЩslabӲֿժȻ黹slab
+	size_t alloc::trim_locked() {
+		if (0 == nslabs)
+			return 0;
+		for (size_t i = 0; i < nslabs; i++)
+			slabs[i].free_bytes = 0;
+		for (size_t index = 0; index < NFREELISTS; index++) {
+			size_t size = class_size(index);
+			if (slab_free[index] != slab_end[index])
+				find_slab(slab_free[index])->free_bytes += slab_end[index] - slab_free[index];
+			for (size_t b = 0; b < batch_top[index]; b++)
+				for (freelist* p = batch_list[index][b]; p != nullptr; p = p->next)
+					find_slab(p)->free_bytes += size;
+			for (freelist* p = free_list[index]; p != nullptr; p = p->next)
+				find_slab(p)->free_bytes += size;
+		}
+		bool any = false;
+		for (size_t i = 0; i < nslabs && !any; i++)
+			any = slabs[i].free_bytes == slabs[i].bytes;
+		if (!any)
+			return 0;
+
+		// ʣµȫŻɢ
+		depot_bytes = 0;
+		for (size_t index = 0; index < NFREELISTS; index++) {
+			size_t size = class_size(index);
+			freelist* keep = nullptr;
+			depot_objs[index] = 0;
+			for (size_t b = 0; b <= batch_top[index]; b++) {
+				freelist* p = b < batch_top[index] ? batch_list[index][b] : free_list[index];
+				while (p != nullptr) {
+					freelist* next = p->next;
+					slab_info* slab = find_slab(p);
+					if (slab->free_bytes != slab->bytes) {
+						p->next = keep;
+						keep = p;
+						++depot_objs[index];
+						depot_bytes += size;
+					}
+					p = next;
+				}
+			}
+			batch_top[index] = 0;
+			free_list[index] = keep;
+			if (slab_free[index] != slab_end[index]) {
+				slab_info* slab = find_slab(slab_free[index]);
+				if (slab->free_bytes == slab->bytes)
+					slab_free[index] = slab_end[index] = nullptr;
+			}
 		}
-		// ѿռɹ
-		end_free = start_free + bytes_alloc;
-		heap_size += bytes_alloc;
-		return chunk_alloc(size, n_objs);
+
+		size_t released = 0;
+		size_t n = 0;
+		for (size_t i = 0; i < nslabs; i++) {
+			if (slabs[i].free_bytes == slabs[i].bytes) {
+				system_free(slabs[i].base, slabs[i].bytes);
+				released += slabs[i].bytes;
+				--class_slabs[slabs[i].index];
+			}
+			else {
+				slabs[n++] = slabs[i];
+			}
+		}
+		nslabs = n;
+		heap_size -= released;
+		return released;
+	}
+
+	void alloc::depot_add(size_t index, size_t n) {
+		depot_objs[index] += n;
+		depot_bytes += class_size(index) * n;
+	}
+
+	void alloc::depot_sub(size_t index, size_t n) {
+		depot_objs[index] -= n;
+		depot_bytes -= class_size(index) * n;
 	}
 
-	// stl淶ķ
+	void alloc::fold_stats(thread_cache& tc, size_t index) {
+#if MYSTL_ALLOC_STATS
+		class_allocs[index] += tc.allocs[index];
+		class_frees[index] += tc.frees[index];
+		tc.allocs[index] = 0;
+		tc.frees[index] = 0;
+#else
+		(void)tc;
+		(void)index;
+#endif
+	}
+
+	alloc_stats alloc::stats() {
+		alloc_stats res;
+		std::lock_guard<std::mutex> lock(depot_mutex);
+		thread_cache& tc = cache;
+		res.counters_enabled = MYSTL_ALLOC_STATS != 0;
+		res.heap_size = heap_size;
+		res.slabs = nslabs;
+		res.free_bytes = 0;
+#if MYSTL_ALLOC_STATS
+		res.large_allocations = large_allocs.load(std::memory_order_relaxed);
+		res.large_deallocations = large_frees.load(std::memory_order_relaxed);
+#else
+		res.large_allocations = 0;
+		res.large_deallocations = 0;
+#endif
+		for (size_t index = 0; index < NFREELISTS; index++) {
+			alloc_class_stats& c = res.classes[index];
+			fold_stats(tc, index);
+			c.block_size = class_size(index);
+#if MYSTL_ALLOC_STATS
+			c.allocations = class_allocs[index];
+			c.deallocations = class_frees[index];
+#else
+			c.allocations = 0;
+			c.deallocations = 0;
+#endif
+			c.free_bytes = (depot_objs[index] + tc.count[index]) * c.block_size;
+			c.slabs = class_slabs[index];
+			c.slab_bytes = 0;
+			res.free_bytes += c.free_bytes;
+		}
+		for (size_t i = 0; i < nslabs; i++)
+			res.classes[slabs[i].index].slab_bytes += slabs[i].bytes;
+		return res;
+	}
+
+	// ֻslabĴС
+	void alloc::dump_stats(std::ostream& os) {
+		alloc_stats st = stats();
+		os << "heap_size: " << st.heap_size << " bytes, slabs: " << st.slabs
+			<< ", free: " << st.free_bytes << " bytes\n";
+		if (st.counters_enabled)
+			os << "large allocations: " << st.large_allocations
+				<< ", large deallocations: " << st.large_deallocations << "\n";
+		os << "  size     allocs      frees    free bytes  slabs  slab bytes\n";
+		for (size_t index = 0; index < NFREELISTS; index++) {
+			const alloc_class_stats& c = st.classes[index];
+			if (0 == c.slabs && 0 == c.allocations)
+				continue;
+			char buf[128];
+			std::snprintf(buf, sizeof(buf), "%6zu %10zu %10zu %13zu %6zu %11zu\n", c.block_size,
+				c.allocations, c.deallocations, c.free_bytes, c.slabs, c.slab_bytes);
+			os << buf;
+		}
+	}
+
+	void alloc::dump_stats_json(std::ostream& os) {
+		alloc_stats st = stats();
+		os << "{\"counters_enabled\":" << (st.counters_enabled ? "true" : "false")
+			<< ",\"heap_size\":" << st.heap_size
+			<< ",\"slabs\":" << st.slabs
+			<< ",\"free_bytes\":" << st.free_bytes
+			<< ",\"large_allocations\":" << st.large_allocations
+			<< ",\"large_deallocations\":" << st.large_deallocations
+			<< ",\"classes\":[";
+		for (size_t index = 0; index < NFREELISTS; index++) {
+			const alloc_class_stats& c = st.classes[index];
+			if (index != 0)
+				os << ",";
+			os << "{\"size\":" << c.block_size
+				<< ",\"allocations\":" << c.allocations
+				<< ",\"deallocations\":" << c.deallocations
+				<< ",\"free_bytes\":" << c.free_bytes
+				<< ",\"slabs\":" << c.slabs
+				<< ",\"slab_bytes\":" << c.slab_bytes << "}";
+		}
+		os << "]}";
+	}
+
+	thread_cache_guard::~thread_cache_guard() {
+		alloc::flush_cache();
+	}
+
+	// ֱʹmallocķ, ӿںallocͬ
+	class malloc_alloc {
+	public:
+		static void* allocate(size_t size) {
+			void* res = std::malloc(size);
+			if (nullptr == res)
+				throw std::bad_alloc();
+			return res;
+		}
+
+		static void deallocate(void* p, size_t) {
+			std::free(p);
+		}
+
+		static void* reallocate(void* p, size_t, size_t new_size) {
+			void* res = std::realloc(p, new_size);
+			if (nullptr == res)
+				throw std::bad_alloc();
+			return res;
+		}
+	};
+
+	template<class T>
+	struct alloc_void {
+		typedef void type;
+	};
+
+	// 漸Ƿ˶ӦĴ, ûжʱʹĬֵ
+	template<class Alloc, class = void>
+	struct alloc_pocca : std::false_type {};
+
+	template<class Alloc>
+	struct alloc_pocca<Alloc, typename alloc_void<typename Alloc::propagate_on_container_copy_assignment>::type>
+		: Alloc::propagate_on_container_copy_assignment {};
+
+	template<class Alloc, class = void>
+	struct alloc_pocma : std::false_type {};
+
+	template<class Alloc>
+	struct alloc_pocma<Alloc, typename alloc_void<typename Alloc::propagate_on_container_move_assignment>::type>
+		: Alloc::propagate_on_container_move_assignment {};
+
+	template<class Alloc, class = void>
+	struct alloc_pocs : std::false_type {};
+
+	template<class Alloc>
+	struct alloc_pocs<Alloc, typename alloc_void<typename Alloc::propagate_on_container_swap>::type>
+		: Alloc::propagate_on_container_swap {};
+
+	// ûݳԱķ(alloc, malloc_alloc, monotonic_alloc)ж
+	template<class Alloc, class = void>
+	struct alloc_always_equal : std::is_empty<Alloc> {};
+
+	template<class Alloc>
+	struct alloc_always_equal<Alloc, typename alloc_void<typename Alloc::is_always_equal>::type>
+		: Alloc::is_always_equal {};
+
+	// Ĵ, std::allocator_traitsĹͬ
+	// ״̬ķͨpropagate_on_container_copy_assignment,
+	// propagate_on_container_move_assignment, propagate_on_container_swap
+	// is_always_equalıĬϹ, ʱҪṩoperator==
+	template<class Alloc>
+	struct alloc_traits {
+		typedef alloc_pocca<Alloc>			propagate_on_container_copy_assignment;
+		typedef alloc_pocma<Alloc>			propagate_on_container_move_assignment;
+		typedef alloc_pocs<Alloc>			propagate_on_container_swap;
+		typedef alloc_always_equal<Alloc>	is_always_equal;
+
+		// ƹʱʹõķ
+		static Alloc select_on_container_copy_construction(const Alloc& a) {
+			return select_aux(a, 0);
+		}
+
+		// ǷԻնԷĿռ
+		static bool equal(const Alloc& a, const Alloc& b) {
+			return equal_aux(a, b, is_always_equal());
+		}
+
+	private:
+		template<class A>
+		static auto select_aux(const A& a, int) -> decltype(a.select_on_container_copy_construction()) {
+			return a.select_on_container_copy_construction();
+		}
+
+		static Alloc select_aux(const Alloc& a, long) {
+			return a;
+		}
+
+		static bool equal_aux(const Alloc&, const Alloc&, std::true_type) {
+			return true;
+		}
+
+		static bool equal_aux(const Alloc& a, const Alloc& b, std::false_type) {
+			return a == b;
+		}
+	};
+
+	// ʹõķ, ѰֽڷAllocװɰ
+	// Allocֻо̬Ա(alloc, malloc_alloc), ҲǴ״̬Ķ
+	// ˽м̳Alloc, AllocûݳԱʱռռ(ջŻ)
+	// ͬ˽м̳simple_alloc, ʹĬϷС
 	template<class T, class Alloc>
-	class simple_alloc {
+	class simple_alloc : private Alloc {
 	public:
-		static T* allocate() {
-			return static_cast<T*>(Alloc::allocate(sizeof(T)));
+		typedef alloc_traits<Alloc>			traits;
+
+		simple_alloc() {};
+
+		simple_alloc(const Alloc& a) : Alloc(a) {};
+
+		// ͬһвͬ͵ķ(dequeĻmap)ͬһAlloc
+		template<class U>
+		simple_alloc(const simple_alloc<U, Alloc>& rhs) : Alloc(rhs.resource()) {};
+
+		Alloc& resource() {
+			return *this;
+		}
+
+		const Alloc& resource() const {
+			return *this;
 		}
 
-		static T* allocate(size_t n) {
-			return 0 == n ? nullptr : static_cast<T*>(Alloc::allocate(sizeof(T) * n));
+		T* allocate() {
+			return static_cast<T*>(resource().allocate(sizeof(T)));
 		}
 
-		static void deallocate(void* p) {
-			Alloc::deallocate(p, sizeof(T));
+		T* allocate(size_t n) {
+			return 0 == n ? nullptr : static_cast<T*>(resource().allocate(sizeof(T) * n));
 		}
 
-		static void deallocate(void* p, size_t n) {
+		void deallocate(void* p) {
+			resource().deallocate(p, sizeof(T));
+		}
+
+		void deallocate(void* p, size_t n) {
 			if (n != 0)
-				Alloc::deallocate(p, sizeof(T) * n);
+				resource().deallocate(p, sizeof(T) * n);
+		}
+
+		// һnĿռ, ÿͷָǴɵ, ÿԵdeallocate()
+		// Allocṩallocate_chainʱһ, allocate
+		void* allocate_chain(size_t n) {
+			static_assert(sizeof(T) >= sizeof(void*), "allocate_chain needs room for a link pointer");
+			return 0 == n ? nullptr : chain_aux(resource(), n, 0);
+		}
+
+		// ֻڿ԰ֽڰ˵(is_trivially_relocatable)
+		T* reallocate(T* p, size_t old_n, size_t new_n) {
+			if (0 == old_n)
+				return allocate(new_n);
+			return static_cast<T*>(resource().reallocate(p, sizeof(T) * old_n, sizeof(T) * new_n));
+		}
+
+		// ǷԻնԷĿռ
+		bool same_resource(const simple_alloc& rhs) const {
+			return traits::equal(resource(), rhs.resource());
+		}
+
+		// ƸֵʱǷỻһȵķ
+		// ʱҪpropagate_copy֮ǰþɵķͷпռ
+		bool replaced_on_copy(const simple_alloc& rhs) const {
+			return traits::propagate_on_container_copy_assignment::value && !same_resource(rhs);
+		}
+
+		// ƸֵʱմǷ滻
+		void propagate_copy(const simple_alloc& rhs) {
+			propagate_aux(rhs, typename traits::propagate_on_container_copy_assignment());
+		}
+
+		void propagate_move(const simple_alloc& rhs) {
+			propagate_aux(rhs, typename traits::propagate_on_container_move_assignment());
+		}
+
+		// ʱ, 򽻻֮Ŀռ޷ȷ
+		void propagate_swap(simple_alloc& rhs) {
+			swap_aux(rhs, typename traits::propagate_on_container_swap());
+		}
+
+	private:
+		template<class A>
+		static auto chain_aux(A& a, size_t n, int) -> decltype(a.allocate_chain(sizeof(T), n)) {
+			return a.allocate_chain(sizeof(T), n);
+		}
+
+		static void* chain_aux(Alloc& a, size_t n, long) {
+			void* head = nullptr;
+			void** link = &head;
+			try {
+				for (size_t i = 0; i < n; i++) {
+					*link = a.allocate(sizeof(T));
+					link = static_cast<void**>(*link);
+					*link = nullptr;
+				}
+			}
+			catch (...) {
+				while (head != nullptr) {
+					void* next = *static_cast<void**>(head);
+					a.deallocate(head, sizeof(T));
+					head = next;
+				}
+				throw;
+			}
+			return head;
+		}
+
+		void propagate_aux(const simple_alloc& rhs, std::true_type) {
+			resource() = rhs.resource();
+		}
+
+		void propagate_aux(const simple_alloc&, std::false_type) {};
+
+		void swap_aux(simple_alloc& rhs, std::true_type) {
+			Alloc temp(resource());
+			resource() = rhs.resource();
+			rhs.resource() = temp;
+		}
+
+		void swap_aux(simple_alloc& rhs, std::false_type) {
+			assert(same_resource(rhs));
+			(void)rhs;
+		}
+	};
+
+	// רõĽ, rb_treehashtableһֻһ
+	// Լslabа˳г, ȺĽڴҲ, ʱʸ
+	// յĽŽԼĿ, alloc, slabջʱһ𻹸Alloc
+	// 㲻תƵһ(listsplice, listʹý)
+	template<class T, class Alloc>
+	class node_pool : public simple_alloc<T, Alloc> {
+	private:
+		typedef simple_alloc<T, Alloc>		base;
+
+		// slabͷ, ں
+		struct pool_slab {
+			pool_slab* next;
+			size_t bytes;
+		};
+
+		pool_slab* slabs;				// slabɵ
+		T* cur;							// ǰslabлûгȥĵһ
+		T* end;							// ǰslabĽλ
+		void* free_list;				// յĽ
+		size_t next_count;				// һslabĽ
+
+	public:
+		node_pool() : slabs(nullptr), cur(nullptr), end(nullptr), free_list(nullptr), next_count(POOL_MIN_NODES) {};
+
+		node_pool(const Alloc& a) : base(a), slabs(nullptr), cur(nullptr), end(nullptr),
+			free_list(nullptr), next_count(POOL_MIN_NODES) {};
+
+		node_pool(const node_pool&) = delete;
+		node_pool& operator=(const node_pool&) = delete;
+
+		~node_pool() {
+			release();
+		}
+
+		// ȴӵǰslab, ûյĽ, ûвµslab
+		T* allocate() {
+			if (cur != end)
+				return cur++;
+			if (free_list) {
+				void* res = free_list;
+				free_list = *static_cast<void**>(res);
+				return static_cast<T*>(res);
+			}
+			new_slab(next_count);
+			return cur++;
+		}
+
+		void deallocate(void* p) {
+			*static_cast<void**>(p) = free_list;
+			free_list = p;
+		}
+
+		// ͸֮ǰ, ֤nͬһslabг
+		// nһslabʱֻ֤ǰһ, ʣµĽ֮slabг
+		void reserve(size_t n) {
+			if (n > max_slab_count())
+				n = max_slab_count();
+			if (static_cast<size_t>(end - cur) >= n)
+				return;
+			// ǰslabʣµĽŽ, µslab֮
+			for (; cur != end; ++cur)
+				deallocate(cur);
+			new_slab(n);
+		}
+
+		// slabAlloc, ǰеĽѾȫ
+		void release() {
+			while (slabs) {
+				pool_slab* next = slabs->next;
+				base::resource().deallocate(slabs, slabs->bytes);
+				slabs = next;
+			}
+			cur = end = nullptr;
+			free_list = nullptr;
+			next_count = POOL_MIN_NODES;
+		}
+
+		// 滻ɲȵķ֮ǰ, þɵķ黹slab
+		void propagate_copy(const node_pool& rhs) {
+			if (base::replaced_on_copy(rhs))
+				release();
+			base::propagate_copy(rhs);
+		}
+
+		// , ʱҲҪ
+		void propagate_swap(node_pool& rhs) {
+			base::propagate_swap(rhs);
+			std::swap(slabs, rhs.slabs);
+			std::swap(cur, rhs.cur);
+			std::swap(end, rhs.end);
+			std::swap(free_list, rhs.free_list);
+			std::swap(next_count, rhs.next_count);
+		}
+
+	private:
+		// һslabܷŵĽ
+		static size_t max_slab_count() {
+			size_t max_count = (POOL_SLAB_BYTES - sizeof(pool_slab)) / sizeof(T);
+			return max_count == 0 ? 1 : max_count;
+		}
+
+		// һܷnslabΪǰslab
+		void new_slab(size_t n) {
+			size_t max_count = max_slab_count();
+			if (n < next_count)
+				n = next_count;
+			// һslabŲPOOL_MIN_NODES, Ϊ޳slab
+			if (n > max_count)
+				n = max_count;
+			if (next_count < max_count)
+				next_count = next_count * 2 < max_count ? next_count * 2 : max_count;
+			size_t bytes = sizeof(pool_slab) + n * sizeof(T);
+			pool_slab* slab = static_cast<pool_slab*>(base::resource().allocate(bytes));
+			slab->next = slabs;
+			slab->bytes = bytes;
+			slabs = slab;
+			cur = reinterpret_cast<T*>(slab + 1);
+			end = cur + n;
 		}
 	};
 
 }	// mystl
 
-#endif
\ No newline at end of file
+#endif
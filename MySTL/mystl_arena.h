@@ -0,0 +1,283 @@
+#ifndef MYSTL_ARENA_H
+#define MYSTL_ARENA_H
+
+// ļ˵arena
+// ֻƶָ룬ʲôҲresetһԶз
+// ʺںһͬ
+// Լtemporary_bufferʹõֲ߳̾ʱռ
+
+#include <cstdlib>								// malloc
+#include <cstring>								// memcpy
+#include <new>									// bad_alloc
+#include <atomic>								// atomic
+#include <cassert>								// assert
+#include "mystl_alloc.h"
+
+// ÿ̵߳ʱռౣֽ, ʱscratch_arena::set_limit޸
+#ifndef MYSTL_SCRATCH_LIMIT
+#define MYSTL_SCRATCH_LIMIT 1048576
+#endif
+
+namespace mystl {
+
+	enum { ARENA_BLOCK_BYTES = 65536 };			// arenaĬÿϵͳĴС
+
+	// arenaеһڴ
+	// п鴮ɵreset֮˳ʹ
+	struct arena_block {
+		arena_block* next;
+		size_t bytes;							// dataĴС
+		char* data() {
+			return reinterpret_cast<char*>(this + 1);
+		}
+	};
+
+	// Ļ
+	class monotonic_buffer {
+	private:
+		arena_block* head;						// һ
+		arena_block* current;					// ǰڷĿ
+		char* cur;								// ǰһηλ
+		char* end;								// ǰĽλ
+		char* last;								// һηλ(ԭչ)
+		size_t block_bytes;						// ¿ĬϴС
+
+	public:
+		explicit monotonic_buffer(size_t bytes = ARENA_BLOCK_BYTES)
+			: head(nullptr), current(nullptr), cur(nullptr), end(nullptr), last(nullptr), block_bytes(bytes) {};
+
+		monotonic_buffer(const monotonic_buffer&) = delete;
+		monotonic_buffer& operator=(const monotonic_buffer&) = delete;
+
+		~monotonic_buffer() {
+			release();
+		}
+
+		void* allocate(size_t n);
+
+		// ʲôҲռresetʱͳһ
+		void deallocate(void*, size_t) {};
+
+		void* reallocate(void* p, size_t old_size, size_t new_size);
+
+		// O(1)з䣬ѾĿ鱣֮ķʹ
+		void reset() {
+			current = head;
+			cur = head ? head->data() : nullptr;
+			end = head ? head->data() + head->bytes : nullptr;
+			last = nullptr;
+		}
+
+		// п黹ϵͳ
+		void release();
+
+		// Ѿϵͳֽ
+		size_t capacity() const;
+
+	private:
+		static size_t round_up(size_t n) {
+			return (n + ALIGN - 1) & ~static_cast<size_t>(ALIGN - 1);
+		}
+
+		void* allocate_slow(size_t n);
+	};
+
+	inline void* monotonic_buffer::allocate(size_t n) {
+		n = round_up(n == 0 ? 1 : n);
+		if (static_cast<size_t>(end - cur) < n)
+			return allocate_slow(n);
+		last = cur;
+		cur += n;
+		return last;
+	}
+
+	// ǰ鲻ʱȳԸreset֮ǰµĿ飬ûкʵĿϵͳ
+	// ¿ڵǰ֮reset֮Ȼ˳ʹ
+	inline void* monotonic_buffer::allocate_slow(size_t n) {
+		arena_block* next = current ? current->next : head;
+		if (nullptr == next || next->bytes < n) {
+			size_t bytes = n > block_bytes ? n : block_bytes;
+			arena_block* block = static_cast<arena_block*>(std::malloc(sizeof(arena_block) + bytes));
+			if (nullptr == block)
+				throw std::bad_alloc();
+			block->bytes = bytes;
+			block->next = next;
+			if (current)
+				current->next = block;
+			else
+				head = block;
+			next = block;
+		}
+		current = next;
+		cur = current->data();
+		end = cur + current->bytes;
+		last = cur;
+		cur += n;
+		return last;
+	}
+
+	// pһηĿռ䲢ҵǰ黹ŵ£ԭչ
+	inline void* monotonic_buffer::reallocate(void* p, size_t old_size, size_t new_size) {
+		if (p != nullptr && p == last && static_cast<size_t>(end - last) >= round_up(new_size)) {
+			cur = last + round_up(new_size);
+			return p;
+		}
+		void* res = allocate(new_size);
+		if (p != nullptr)
+			std::memcpy(res, p, old_size < new_size ? old_size : new_size);
+		return res;
+	}
+
+	inline void monotonic_buffer::release() {
+		while (head) {
+			arena_block* next = head->next;
+			std::free(head);
+			head = next;
+		}
+		current = nullptr;
+		cur = end = last = nullptr;
+	}
+
+	inline size_t monotonic_buffer::capacity() const {
+		size_t res = 0;
+		for (arena_block* p = head; p != nullptr; p = p->next)
+			res += p->bytes;
+		return res;
+	}
+
+	// ΪAllocarena
+	// ÿ̡߳ÿinstһmonotonic_bufferҪ
+	// ͬ;ʹòͬinst֮resetӰ
+	// ע: reset֮ʹѾٻ߲ʹ
+	template<int inst>
+	class monotonic_alloc {
+	private:
+		static monotonic_buffer& buffer() {
+			static thread_local monotonic_buffer buf;
+			return buf;
+		}
+
+	public:
+		static void* allocate(size_t n) {
+			return buffer().allocate(n);
+		}
+
+		static void deallocate(void*, size_t) {};
+
+		static void* reallocate(void* p, size_t old_size, size_t new_size) {
+			return buffer().reallocate(p, old_size, new_size);
+		}
+
+		// һʱ
+		static void reset() {
+			buffer().reset();
+		}
+
+		static void release() {
+			buffer().release();
+		}
+
+		static size_t capacity() {
+			return buffer().capacity();
+		}
+	};
+
+	enum { SCRATCH_ALIGN = 16 };				// ʱռ䰴16ֽڶ
+
+	// ÿ߳һظʹõʱռ, stable_sort㷨ʱȡ
+	// ջķʽͻ, Ҫ, Ҳÿζmallocfree
+	// 󳬹, ߿鲻󵫻ûյĿռʱnullptr, ɵԼϵͳ
+	class scratch_arena {
+	private:
+		char* base;
+		size_t bytes;							// ĴС
+		size_t top;								// Ѿȥֽ
+
+	public:
+		scratch_arena() : base(nullptr), bytes(0), top(0) {};
+
+		scratch_arena(const scratch_arena&) = delete;
+		scratch_arena& operator=(const scratch_arena&) = delete;
+
+		~scratch_arena() {
+			std::free(base);
+		}
+
+		// ǰ̵߳ʱռ
+		static scratch_arena& local() {
+			static thread_local scratch_arena arena;
+			return arena;
+		}
+
+		// ̹߳ͬһ, Ϊ0֮ʱȫmalloc
+		static void set_limit(size_t n) {
+			limit_ref().store(n, std::memory_order_relaxed);
+		}
+
+		static size_t limit() {
+			return limit_ref().load(std::memory_order_relaxed);
+		}
+
+		void* allocate(size_t n);
+
+		// 밴պͷ෴˳
+		void deallocate(void* p, size_t n) {
+			n = round_up(n);
+			assert(static_cast<char*>(p) + n == base + top);
+			top -= n;
+		}
+
+		// ûʹõĿռʱѿ黹ϵͳ
+		void release() {
+			if (0 == top) {
+				std::free(base);
+				base = nullptr;
+				bytes = 0;
+			}
+		}
+
+		size_t capacity() const {
+			return bytes;
+		}
+
+	private:
+		static std::atomic<size_t>& limit_ref() {
+			static std::atomic<size_t> lim(MYSTL_SCRATCH_LIMIT);
+			return lim;
+		}
+
+		static size_t round_up(size_t n) {
+			return (n + SCRATCH_ALIGN - 1) & ~static_cast<size_t>(SCRATCH_ALIGN - 1);
+		}
+	};
+
+	// 鲻ʱ, , ɿûʹõĿռ滻
+	inline void* scratch_arena::allocate(size_t n) {
+		size_t lim = limit();
+		n = round_up(n == 0 ? 1 : n);
+		// ޵С֮, ʱȰѳ޵Ŀ黹ϵͳ
+		if (bytes > lim)
+			release();
+		if (n > lim)
+			return nullptr;
+		if (bytes - top < n) {
+			if (top != 0)
+				return nullptr;
+			size_t new_bytes = bytes * 2 > n ? bytes * 2 : n;
+			if (new_bytes > lim)
+				new_bytes = lim;
+			char* p = static_cast<char*>(std::malloc(new_bytes));
+			if (nullptr == p)
+				return nullptr;
+			std::free(base);
+			base = p;
+			bytes = new_bytes;
+		}
+		void* res = base + top;
+		top += n;
+		return res;
+	}
+
+}	// mystl
+
+#endif
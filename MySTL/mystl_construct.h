@@ -2,18 +2,15 @@
 #define MYSTL_CONSTRUCT_H
 
 #include <type_traits>
+#include <utility>
 #include "iterator.h"
 
 namespace mystl {
 
-	template<class T1, class T2>
-	inline void construct(T1* p, const T2& value) {
-		::new (static_cast<void*>(p)) T1(value);
-	}
-
-	template<class T1>
-	inline void construct(T1* p) {
-		::new (static_cast<void*>(p)) T1();
+	// argspֱӹ, ûвʱֵʼ
+	template<class T1, class... Args>
+	inline void construct(T1* p, Args&&... args) {
+		::new (static_cast<void*>(p)) T1(std::forward<Args>(args)...);
 	}
 
 	template<class T1>
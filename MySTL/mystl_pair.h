@@ -1,6 +1,8 @@
 #ifndef MYSTL_PAIR_H
 #define MYSTL_PAIR_H
 
+#include "type_traits.h"
+
 namespace mystl {
 
 
@@ -56,6 +58,11 @@ inline pair<T1, T2> make_pair(const T1& a, const T2& b) {
 	return pair<T1, T2>(a, b);
 }
 
+// Ա԰ֽڰʱpairҲ
+template<class T1, class T2>
+struct is_trivially_relocatable<pair<T1, T2>>
+	: std::integral_constant<bool, is_trivially_relocatable<T1>::value && is_trivially_relocatable<T2>::value> {};
+
 
 
 } // mystl
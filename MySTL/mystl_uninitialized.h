@@ -2,9 +2,12 @@
 #define MYSTL_UNINITIALIZED_H
 
 #include <type_traits>
+#include <utility>
 #include <string>
+#include <cstring>
 #include "mystl_construct.h"
 #include "algobase.h"
+#include "type_traits.h"
 
 namespace mystl {
 
@@ -18,18 +21,16 @@ namespace mystl {
 
 	template<class ForwardIterator, class InputIterator>
 	ForwardIterator __uninitialized_copy(InputIterator first, InputIterator last, ForwardIterator result, std::false_type) {
-		InputIterator p = first;
+		ForwardIterator cur = result;
 		try {
-			for (; first != last; first++, result++)
-				mystl::construct(&*result, *first);
+			for (; first != last; ++first, ++cur)
+				mystl::construct(&*cur, *first);
 		}
 		catch (...) {
-			while (first != p) {
-				mystl::destroy(&*first);
-				first--;
-			}
+			mystl::destroy(result, cur);
+			throw;
 		}
-		return result;
+		return cur;
 	}
 
 	template<class ForwardIterator, class InputIterator>
@@ -43,6 +44,62 @@ namespace mystl {
 		return result + (last - first);
 	}
 
+	//-------------------------------------------------------------------------------------------------------------------------
+	//-------------------------------------------------------------------------------------------------------------------------
+	// uninitialized_move
+	// [first, last)ڵԪƶ쵽δʼĿռ, ׳쳣ʱѾԪ
+	template<class InputIterator, class ForwardIterator>
+	ForwardIterator __uninitialized_move(InputIterator first, InputIterator last, ForwardIterator result, std::true_type) {
+		return mystl::copy(first, last, result);
+	}
+
+	template<class InputIterator, class ForwardIterator>
+	ForwardIterator __uninitialized_move(InputIterator first, InputIterator last, ForwardIterator result, std::false_type) {
+		ForwardIterator cur = result;
+		try {
+			for (; first != last; ++first, ++cur)
+				mystl::construct(&*cur, std::move(*first));
+		}
+		catch (...) {
+			mystl::destroy(result, cur);
+			throw;
+		}
+		return cur;
+	}
+
+	template<class InputIterator, class ForwardIterator>
+	ForwardIterator uninitialized_move(InputIterator first, InputIterator last, ForwardIterator result) {
+		typedef typename iterator_traits<ForwardIterator>::value_type type;
+		return __uninitialized_move(first, last, result, std::is_trivially_copyable<type>());
+	}
+
+	// ʱԪʹ
+	// ƶ׳쳣ԪؿԸʱΪ, ʱԭԪرֲ
+	template<class InputIterator, class ForwardIterator>
+	ForwardIterator __uninitialized_move_if_noexcept(InputIterator first, InputIterator last, ForwardIterator result, std::true_type) {
+		return mystl::copy(first, last, result);
+	}
+
+	template<class InputIterator, class ForwardIterator>
+	ForwardIterator __uninitialized_move_if_noexcept(InputIterator first, InputIterator last, ForwardIterator result, std::false_type) {
+		ForwardIterator cur = result;
+		try {
+			for (; first != last; ++first, ++cur)
+				mystl::construct(&*cur, std::move_if_noexcept(*first));
+		}
+		catch (...) {
+			mystl::destroy(result, cur);
+			throw;
+		}
+		return cur;
+	}
+
+	template<class InputIterator, class ForwardIterator>
+	ForwardIterator uninitialized_move_if_noexcept(InputIterator first, InputIterator last, ForwardIterator result) {
+		typedef typename iterator_traits<ForwardIterator>::value_type type;
+		return __uninitialized_move_if_noexcept(first, last, result, std::is_trivially_copyable<type>());
+	}
+
 	//-------------------------------------------------------------------------------------------------------------------------
 	//-------------------------------------------------------------------------------------------------------------------------
 	// uninitialized_fill
@@ -61,8 +118,8 @@ namespace mystl {
 		}
 		catch (...) {
 			mystl::destroy(p, first);
+			throw;
 		}
-		return last;
 	}
 
 	template<class ForwardIterator, class T>
@@ -91,8 +148,9 @@ namespace mystl {
 		}
 		catch (...) {
 			mystl::destroy(p, first);
+			throw;
 		}
-		return first + n;
+		return first;
 	}
 
 	template<class ForwardIterator, class Size, class T>
@@ -101,6 +159,160 @@ namespace mystl {
 		return __uninitialized_fill_n(first, n, value, std::is_trivially_copy_assignable<type>());
 	}
 
+	//-------------------------------------------------------------------------------------------------------------------------
+	//-------------------------------------------------------------------------------------------------------------------------
+	// 洢(vector, small_vector, inplace_vector)õĲ롢ɾͰԪصĺ
+	// ֻ[start, finish)еԪ, ռͷԼԼָɵ߸
+	// ԰ֽڰ˵Ԫ(is_trivially_relocatable)memmove, Ԫƶ
+
+	// ֽڰ[first, last)ᵽresult, οռص
+	template<class T>
+	void relocate_bytes(const T* first, const T* last, T* result) {
+		if (first != last)
+			std::memmove(static_cast<void*>(result), static_cast<const void*>(first), sizeof(T) * (last - first));
+	}
+
+	// positionһԪ, ǰfinish֮ٻһԪصĿռ
+	// finish¹Ԫظ, ;׳쳣ʱ[start, finish)ȻǹõԪ
+	// argsеԪ, ƶԪ֮ǰȹԪ
+	// ԰ֽڰ˵Ԫʱռй, Ԫٰ֮ȥ
+	template<class T, class... Args>
+	void emplace_in_place(T* position, T*& finish, Args&&... args) {
+		if (is_trivially_relocatable<T>::value) {
+			typename std::aligned_storage<sizeof(T), alignof(T)>::type buf;
+			T* x = reinterpret_cast<T*>(&buf);
+			mystl::construct(x, std::forward<Args>(args)...);
+			mystl::relocate_bytes(position, finish, position + 1);
+			mystl::relocate_bytes(x, x + 1, position);
+			++finish;
+		}
+		else if (position == finish) {
+			mystl::construct(finish, std::forward<Args>(args)...);
+			++finish;
+		}
+		else {
+			T x(std::forward<Args>(args)...);
+			mystl::construct(finish, std::move(*(finish - 1)));
+			++finish;
+			mystl::move_backward(position, finish - 2, finish - 1);
+			*position = std::move(x);
+		}
+	}
+
+	// positionnvalue, ǰfinish֮ٻnԪصĿռ, finishĸͬ
+	template<class T>
+	void fill_insert_in_place(T* position, T*& finish, size_t n, const T& value) {
+		T x = value;		// valueܾлᱻƶԪ
+		T* old_finish = finish;
+		size_t elem_after = old_finish - position;
+		// ԰ֽڰ˵Ԫ, ڿճλ
+		if (is_trivially_relocatable<T>::value) {
+			mystl::relocate_bytes(position, old_finish, position + n);
+			try {
+				mystl::uninitialized_fill_n(position, n, x);
+			}
+			catch (...) {
+				mystl::relocate_bytes(position + n, old_finish + n, position);
+				throw;
+			}
+			finish += n;
+		}
+		// position֮Ԫظn
+		// תƺ벿 -> תǰ벿 ->
+		else if (elem_after > n) {
+			finish = mystl::uninitialized_move(old_finish - n, old_finish, old_finish);
+			mystl::move_backward(position, old_finish - n, old_finish);
+			mystl::fill(position, position + n, x);
+		}
+		// position֮ԪظСڵn
+		// һ -> ת -> ʣ²
+		else {
+			finish = mystl::uninitialized_fill_n(old_finish, n - elem_after, x);
+			finish = mystl::uninitialized_move(position, old_finish, finish);
+			mystl::fill(position, old_finish, x);
+		}
+	}
+
+	// position[first, last)еnԪ, ǰfinish֮ٻnԪصĿռ, finishĸͬ
+	template<class T, class ForwardIterator>
+	void range_insert_in_place(T* position, T*& finish, ForwardIterator first, ForwardIterator last, size_t n) {
+		T* old_finish = finish;
+		size_t elem_after = old_finish - position;
+		// ԰ֽڰ˵Ԫ, ڿճλϸ
+		if (is_trivially_relocatable<T>::value) {
+			mystl::relocate_bytes(position, old_finish, position + n);
+			try {
+				mystl::uninitialized_copy(first, last, position);
+			}
+			catch (...) {
+				mystl::relocate_bytes(position + n, old_finish + n, position);
+				throw;
+			}
+			finish += n;
+		}
+		// position֮Ԫظn
+		// תƺ벿 -> תǰ벿 ->
+		else if (elem_after > n) {
+			finish = mystl::uninitialized_move(old_finish - n, old_finish, old_finish);
+			mystl::move_backward(position, old_finish - n, old_finish);
+			mystl::copy(first, last, position);
+		}
+		// position֮ԪظСڵn
+		// һ -> ת -> ʣ²
+		else {
+			ForwardIterator mid = first;
+			mystl::advance(mid, elem_after);
+			finish = mystl::uninitialized_copy(mid, last, old_finish);
+			finish = mystl::uninitialized_move(position, old_finish, finish);
+			mystl::copy(first, mid, position);
+		}
+	}
+
+	// ɾ[first, last), finishǰ
+	// ԰ֽڰ˵Ԫ֮ѺԪǰ
+	template<class T>
+	void erase_in_place(T* first, T* last, T*& finish) {
+		if (first == last)
+			return;
+		if (is_trivially_relocatable<T>::value) {
+			mystl::destroy(first, last);
+			mystl::relocate_bytes(last, finish, first);
+			finish -= last - first;
+		}
+		else {
+			T* new_finish = mystl::move(last, finish, first);
+			mystl::destroy(new_finish, finish);
+			finish = new_finish;
+		}
+	}
+
+	// ʱԪ, ¿ռеfinish
+	// new_startкpositionӦλѾnԪ, [start, finish)ᵽ
+	// ԰ֽڰ˵Ԫֱmemcpy, ԭԪز
+	// Ԫƶ׳쳣ʱƶ, , ȻԭԪ
+	// ʱnԪغѾȥԪ׳, ԭԪرֲ, ¿ռɵͷ
+	template<class T>
+	T* relocate_around(T* start, T* position, T* finish, T* new_start, size_t n) {
+		T* new_pos = new_start + (position - start);
+		if (is_trivially_relocatable<T>::value) {
+			mystl::relocate_bytes(start, position, new_start);
+			mystl::relocate_bytes(position, finish, new_pos + n);
+			return new_pos + n + (finish - position);
+		}
+		T* new_finish = new_start;
+		try {
+			new_finish = mystl::uninitialized_move_if_noexcept(start, position, new_start);
+			new_finish = mystl::uninitialized_move_if_noexcept(position, finish, new_pos + n);
+		}
+		catch (...) {
+			mystl::destroy(new_pos, new_pos + n);
+			mystl::destroy(new_start, new_finish);
+			throw;
+		}
+		mystl::destroy(start, finish);
+		return new_finish;
+	}
+
 }	// mystl
 
-#endif
\ No newline at end of file
+#endif
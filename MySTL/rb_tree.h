@@ -595,7 +595,7 @@ namespace mystl {
 
 // 
 template<class Key, class Value, class Keyofvalue, class Compare, class Alloc = alloc>
-class rb_tree {
+class rb_tree : private node_pool<rb_tree_node<Value>, Alloc> {
 public:
 	// typedefs
 	typedef rb_tree_node_base<Value>*							base_ptr;
@@ -607,10 +607,10 @@ public:
 	typedef Value												value_type;
 	typedef Compare												key_compare;
 
-	typedef simple_alloc<Value, Alloc>							allocator_type;
+	typedef Alloc												allocator_type;
 	typedef simple_alloc<Value, Alloc>							data_allocator;
 	typedef simple_alloc<base_type, Alloc>						base_allocator;
-	typedef simple_alloc<node_type, Alloc>						node_allocator;
+	typedef node_pool<node_type, Alloc>							node_allocator;
 
 	typedef value_type*											pointer;
 	typedef const value_type*									const_pointer;
@@ -631,11 +631,12 @@ protected:
 	size_type node_count;
 	key_compare key_comp;
 
-protected:
+public:
 	allocator_type get_allocator() const {
-		return node_allocator();
+		return node_allocator::resource();
 	}
 
+protected:
 	static const key_type& get_key(base_ptr& node) {
 		return Keyofvalue()(static_cast<node_ptr>(node)->value);
 	}
@@ -692,18 +693,22 @@ protected:
 public:
 	// 졢ƺ
 	rb_tree() : header(nullptr), node_count(0) {
-		header = get_node();
+		header = get_header();
 		empty_initialize();
 	}
 
-	rb_tree(key_compare comp) : header(nullptr), node_count(0), key_comp(comp) {
-		header = get_node();
+	rb_tree(key_compare comp, const Alloc& a = Alloc()) : node_allocator(a), header(nullptr), node_count(0), key_comp(comp) {
+		header = get_header();
 		empty_initialize();
 	}
 
-	rb_tree(const rb_tree<Key, Value, Keyofvalue, Compare, Alloc>& rhs) : header(nullptr), node_count(0), 
-		key_comp(rhs.key_comp) {
-		header = get_node();
+	// ķselect_on_container_copy_construction
+	rb_tree(const rb_tree<Key, Value, Keyofvalue, Compare, Alloc>& rhs)
+		: node_allocator(node_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())),
+		header(nullptr), node_count(0), key_comp(rhs.key_comp) {
+		// иƵĽͬһslabг
+		node_allocator::reserve(rhs.node_count);
+		header = get_header();
 		if (nullptr == rhs.root())
 			empty_initialize();
 		else {
@@ -715,10 +720,21 @@ public:
 		node_count = rhs.node_count;
 	}
 
-	rb_tree<Key, Value, Keyofvalue, Compare, Alloc>& operator=(rb_tree<Key, Value, Keyofvalue, Compare, Alloc>& rhs) {
-		if (*this == rhs)
+	rb_tree<Key, Value, Keyofvalue, Compare, Alloc>& operator=(const rb_tree<Key, Value, Keyofvalue, Compare, Alloc>& rhs) {
+		if (this == &rhs)
 			return *this;
 		clear();
+		// Ҫɲȵķ, ͷҲҪµķ·
+		if (node_allocator::replaced_on_copy(rhs)) {
+			put_header(header);
+			node_allocator::propagate_copy(rhs);
+			header = get_header();
+			empty_initialize();
+		}
+		else {
+			node_allocator::propagate_copy(rhs);
+		}
+		node_allocator::reserve(rhs.node_count);
 		key_comp = rhs.key_comp;
 		node_count = 0;
 		if (0 == rhs.node_count) {
@@ -737,6 +753,7 @@ public:
 
 	~rb_tree() {
 		clear();
+		put_header(header);
 	}
 
 
@@ -867,6 +884,19 @@ private:
 
 	void put_node(node_ptr node);
 
+	base_ptr get_header();
+
+	void put_header(base_ptr node);
+
+	// ֮ǰԤ, ֻforward iteratorǰ֪
+	template<class InputIterator>
+	void reserve_nodes(InputIterator, InputIterator, input_iterator_tag) {};
+
+	template<class ForwardIterator>
+	void reserve_nodes(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+		node_allocator::reserve(mystl::distance(first, last));
+	}
+
 	void empty_initialize();
 
 	node_ptr copy_from(base_ptr x, base_ptr p);
@@ -960,6 +990,7 @@ rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::insert_equal(iterator position,
 template<class Key, class Value, class Keyofvalue, class Compare, class Alloc>
 template<class InputIterator>
 void rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::insert_equal(InputIterator first, InputIterator last) {
+	reserve_nodes(first, last, iterator_category(first));
 	for (; first != last; ++first)
 		insert_equal(*first);
 }
@@ -1022,6 +1053,7 @@ rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::insert_unique(iterator position
 template<class Key, class Value, class Keyofvalue, class Compare, class Alloc>
 template<class InputIterator>
 void rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::insert_unique(InputIterator first, InputIterator last) {
+	reserve_nodes(first, last, iterator_category(first));
 	for (; first != last; ++first)
 		insert_unique(*first);
 }
@@ -1097,7 +1129,7 @@ void rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::erase(node_ptr x) {
 	}
 }
 
-// ɾ
+// ɾ, صslabҲһ𻹸
 template<class Key, class Value, class Keyofvalue, class Compare, class Alloc>
 void rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::clear() {
 	if (node_count != 0) {
@@ -1107,6 +1139,7 @@ void rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::clear() {
 		root() = nullptr;
 		node_count = 0;
 	}
+	node_allocator::release();
 }
 
 
@@ -1250,7 +1283,7 @@ mystl::pair<typename rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::const_iter
 template<class Key, class Value, class Keyofvalue, class Compare, class Alloc>
 typename rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::node_ptr
 rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::get_node() {
-	return node_allocator::allocate(1);
+	return node_allocator::allocate();
 }
 
 // һ
@@ -1259,6 +1292,18 @@ void rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::put_node(node_ptr node) {
 	node_allocator::deallocate(node);
 }
 
+// ͷ㲻value, Ҳӽз, clear֮صslabȫ黹
+template<class Key, class Value, class Keyofvalue, class Compare, class Alloc>
+typename rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::base_ptr
+rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::get_header() {
+	return base_allocator(node_allocator::resource()).allocate();
+}
+
+template<class Key, class Value, class Keyofvalue, class Compare, class Alloc>
+void rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::put_header(base_ptr node) {
+	base_allocator(node_allocator::resource()).deallocate(node);
+}
+
 // Ժгʼ
 template<class Key, class Value, class Keyofvalue, class Compare, class Alloc>
 void rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::empty_initialize() {
@@ -1353,6 +1398,7 @@ bool rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::rb_tree_verify() const {
 // 
 template<class Key, class Value, class Keyofvalue, class Compare, class Alloc>
 void rb_tree<Key, Value, Keyofvalue, Compare, Alloc>::swap(rb_tree<Key, Value, Keyofvalue, Compare, Alloc>& rhs) {
+	node_allocator::propagate_swap(rhs);
 	mystl::swap(header, rhs.header);
 	mystl::swap(node_count, rhs.node_count);
 	mystl::swap(key_comp, rhs.key_comp);
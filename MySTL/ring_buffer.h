@@ -0,0 +1,1136 @@
+#ifndef MYSTL_RING_BUFFER_H
+#define MYSTL_RING_BUFFER_H
+
+// ļring_buffer
+// ԪرһĻοռ, 2, ±Ԫڵλ
+// ˲ɾO(1), ռ֮, ѻչɴ¿ռ俪ͷʼһ
+// Ϊqueuestackĵײ
+
+#include "iterator.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "algorithm.h"
+#include <cassert>
+#include <cstring>
+
+namespace mystl {
+
+// ring_buffer
+// Ԫصľ±, ˲ɾԪʱָԪصĵȻЧ, ֮ʧЧ
+template<class T, class Ref, class Ptr>
+struct ring_buffer_iterator : public iterator<random_iterator_tag, T> {
+	// typedef
+	typedef ring_buffer_iterator<T, T&, T*>					iterator;
+	typedef ring_buffer_iterator<T, const T&, const T*>		const_iterator;
+
+	typedef T												value_type;
+	typedef Ptr												pointer;
+	typedef Ref												reference;
+	typedef size_t											size_type;
+	typedef ptrdiff_t										difference_type;
+
+	typedef ring_buffer_iterator							self;
+
+	// οռʼλáһԪصľ±
+	T* buf;
+	size_type mask;
+	size_type pos;
+
+	// 캯
+	ring_buffer_iterator() : buf(nullptr), mask(0), pos(0) {};
+
+	ring_buffer_iterator(T* b, size_type m, size_type p) : buf(b), mask(m), pos(p) {};
+
+	ring_buffer_iterator(const iterator& rhs) : buf(rhs.buf), mask(rhs.mask), pos(rhs.pos) {};
+
+	// 
+	reference operator*() const {
+		return buf[pos & mask];
+	}
+
+	pointer operator->() const {
+		return buf + (pos & mask);
+	}
+
+	// ±ƻ0, зͲֵ
+	difference_type operator-(const self& rhs) const {
+		return static_cast<difference_type>(pos - rhs.pos);
+	}
+
+	self& operator++() {
+		++pos;
+		return *this;
+	}
+
+	self operator++(int) {
+		self temp = *this;
+		++pos;
+		return temp;
+	}
+
+	self& operator--() {
+		--pos;
+		return *this;
+	}
+
+	self operator--(int) {
+		self temp = *this;
+		--pos;
+		return temp;
+	}
+
+	self& operator+=(difference_type n) {
+		pos += n;
+		return *this;
+	}
+
+	self operator+(difference_type n) const {
+		self temp = *this;
+		temp += n;
+		return temp;
+	}
+
+	self& operator-=(difference_type n) {
+		pos -= n;
+		return *this;
+	}
+
+	self operator-(difference_type n) const {
+		self temp = *this;
+		temp -= n;
+		return temp;
+	}
+
+	reference operator[](difference_type n) const {
+		return buf[(pos + n) & mask];
+	}
+
+	bool operator==(const self& rhs) const {
+		return pos == rhs.pos;
+	}
+
+	bool operator!=(const self& rhs) const {
+		return pos != rhs.pos;
+	}
+
+	bool operator<(const self& rhs) const {
+		return *this - rhs < 0;
+	}
+
+	bool operator>(const self& rhs) const {
+		return rhs < *this;
+	}
+
+	bool operator<=(const self& rhs) const {
+		return !(rhs < *this);
+	}
+
+	bool operator>=(const self& rhs) const {
+		return !(*this < rhs);
+	}
+};
+
+// ring_bufferһ: ±[base, base + )֮Ԫ
+// ÿһζӦ黷οռ, һԽ
+template<class T>
+struct ring_buffer_segment {
+	T* buf;
+	size_t mask;
+	size_t base;
+
+	ring_buffer_segment& operator++() {
+		base += mask + 1;
+		return *this;
+	}
+
+	ring_buffer_segment& operator--() {
+		base -= mask + 1;
+		return *this;
+	}
+
+	bool operator==(const ring_buffer_segment& rhs) const {
+		return base == rhs.base;
+	}
+
+	bool operator!=(const ring_buffer_segment& rhs) const {
+		return base != rhs.base;
+	}
+};
+
+// ring_bufferҲǷֶε, 㷨ƻصֱʹԭָ
+template<class T, class Ref, class Ptr>
+struct segmented_iterator_traits<ring_buffer_iterator<T, Ref, Ptr>> {
+	typedef true_type								is_segmented_iterator;
+	typedef ring_buffer_iterator<T, Ref, Ptr>		iterator;
+	typedef ring_buffer_segment<T>					segment_iterator;
+	typedef Ptr										local_iterator;
+
+	static segment_iterator segment(const iterator& it) {
+		segment_iterator seg = { it.buf, it.mask, it.pos & ~it.mask };
+		return seg;
+	}
+
+	static local_iterator local(const iterator& it) {
+		return it.buf + (it.pos & it.mask);
+	}
+
+	static local_iterator begin(const segment_iterator& seg) {
+		return seg.buf;
+	}
+
+	static local_iterator end(const segment_iterator& seg) {
+		return seg.buf + seg.mask + 1;
+	}
+
+	static iterator compose(const segment_iterator& seg, local_iterator local) {
+		return iterator(seg.buf, seg.mask, seg.base + (local - seg.buf));
+	}
+};
+
+// ring_buffer
+// headtailǵһԪغһԪصһλõľ±, ֻ(պ)
+template<class T, class Alloc = alloc>
+class ring_buffer : private simple_alloc<T, Alloc> {
+public:
+	typedef simple_alloc<T, Alloc>						data_allocator;
+	typedef Alloc										allocator_type;
+
+	// 
+	typedef T											value_type;
+	typedef T*											pointer;
+	typedef const T*									const_pointer;
+	typedef T&											reference;
+	typedef const T&									const_reference;
+	typedef size_t										size_type;
+	typedef ptrdiff_t									difference_type;
+
+	// 
+	typedef ring_buffer_iterator<T, T&, T*>				iterator;
+	typedef ring_buffer_iterator<T, const T&, const T*>	const_iterator;
+	typedef mystl::reverse_iterator<iterator>			reverse_iterator;
+	typedef mystl::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	// õʹõķ
+	allocator_type get_allocator() const {
+		return data_allocator::resource();
+	}
+
+protected:
+	// һβԪʱ
+	static const size_type initial_capacity = 8;
+
+private:
+	pointer buffer;			// οռ
+	size_type cap;			// , Ϊ02
+	size_type head;			// һԪصľ±
+	size_type tail;			// һԪصһλõľ±
+
+public:
+	//-----------------------------------------------------졢ƺ---------------------------------------------------
+	ring_buffer() : buffer(nullptr), cap(0), head(0), tail(0) {};
+
+	explicit ring_buffer(const Alloc& a) : data_allocator(a), buffer(nullptr), cap(0), head(0), tail(0) {};
+
+	explicit ring_buffer(size_type n) : buffer(nullptr), cap(0), head(0), tail(0) {
+		resize(n);
+	}
+
+	ring_buffer(size_type n, const value_type& value, const Alloc& a = Alloc())
+		: data_allocator(a), buffer(nullptr), cap(0), head(0), tail(0) {
+		fill_assign(n, value);
+	}
+
+	template<class InputIterator>
+	ring_buffer(InputIterator first, InputIterator last, const Alloc& a = Alloc())
+		: data_allocator(a), buffer(nullptr), cap(0), head(0), tail(0) {
+		assign(first, last);
+	}
+
+	ring_buffer(std::initializer_list<value_type> ilist, const Alloc& a = Alloc())
+		: data_allocator(a), buffer(nullptr), cap(0), head(0), tail(0) {
+		assign(ilist.begin(), ilist.end());
+	}
+
+	// ķselect_on_container_copy_construction
+	ring_buffer(const ring_buffer& rhs)
+		: data_allocator(data_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())),
+		buffer(nullptr), cap(0), head(0), tail(0) {
+		assign(rhs.begin(), rhs.end());
+	}
+
+	ring_buffer(const ring_buffer& rhs, const Alloc& a) : data_allocator(a), buffer(nullptr), cap(0), head(0), tail(0) {
+		assign(rhs.begin(), rhs.end());
+	}
+
+	// ƶ캯, ֱӽӹrhsĿռ
+	ring_buffer(ring_buffer&& rhs) noexcept
+		: data_allocator(rhs.get_allocator()), buffer(rhs.buffer), cap(rhs.cap), head(rhs.head), tail(rhs.tail) {
+		rhs.clean();
+	}
+
+	ring_buffer& operator=(const ring_buffer& rhs);
+
+	ring_buffer& operator=(ring_buffer&& rhs)
+		noexcept(data_allocator::traits::propagate_on_container_move_assignment::value ||
+			data_allocator::traits::is_always_equal::value);
+
+	ring_buffer& operator=(std::initializer_list<value_type> ilist) {
+		assign(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+	~ring_buffer() {
+		clear();
+		data_allocator::deallocate(buffer, cap);
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	iterator begin() {
+		return iterator(buffer, cap - 1, head);
+	}
+
+	const_iterator begin() const {
+		return const_iterator(buffer, cap - 1, head);
+	}
+
+	iterator end() {
+		return iterator(buffer, cap - 1, tail);
+	}
+
+	const_iterator end() const {
+		return const_iterator(buffer, cap - 1, tail);
+	}
+
+	reverse_iterator rbegin() {
+		return reverse_iterator(end());
+	}
+
+	const_reverse_iterator rbegin() const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend() {
+		return reverse_iterator(begin());
+	}
+
+	const_reverse_iterator rend() const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin() const {
+		return begin();
+	}
+
+	const_iterator cend() const {
+		return end();
+	}
+
+	const_reverse_iterator crbegin() const {
+		return rbegin();
+	}
+
+	const_reverse_iterator crend() const {
+		return rend();
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	size_type size() const {
+		return tail - head;
+	}
+
+	size_type max_size() const {
+		return static_cast<size_type>(-1) / sizeof(T);
+	}
+
+	size_type capacity() const {
+		return cap;
+	}
+
+	bool empty() const {
+		return head == tail;
+	}
+
+	// ȡ2
+	void reserve(size_type n) {
+		if (n > cap)
+			reallocate(round_capacity(n));
+	}
+
+	// ССsize()С2, ûԪʱͷſռ
+	void shrink_to_fit();
+
+	void resize(size_type n, const value_type& value);
+
+	void resize(size_type n);
+
+	//-----------------------------------------------------Ԫغ---------------------------------------------------------
+	reference operator[](size_type n) {
+		assert(n < size());
+		return buffer[(head + n) & (cap - 1)];
+	}
+
+	const_reference operator[](size_type n) const {
+		assert(n < size());
+		return buffer[(head + n) & (cap - 1)];
+	}
+
+	reference at(size_type n) {
+		if (!(n < size()))
+			throw std::out_of_range("ring_buffer<T>::at() subscript out of range");
+		return (*this)[n];
+	}
+
+	const_reference at(size_type n) const {
+		if (!(n < size()))
+			throw std::out_of_range("ring_buffer<T>::at() subscript out of range");
+		return (*this)[n];
+	}
+
+	reference front() {
+		assert(!empty());
+		return buffer[head & (cap - 1)];
+	}
+
+	const_reference front() const {
+		assert(!empty());
+		return buffer[head & (cap - 1)];
+	}
+
+	reference back() {
+		assert(!empty());
+		return buffer[(tail - 1) & (cap - 1)];
+	}
+
+	const_reference back() const {
+		assert(!empty());
+		return buffer[(tail - 1) & (cap - 1)];
+	}
+
+	//-------------------------------------------------޸ز----------------------------------------------------------
+	// 1. ֵ
+	void assign(size_type n, const value_type& value) {
+		fill_assign(n, value);
+	}
+
+	// 2. ֵ(ģʽ)
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		assign_dispatch(first, last, Integer());
+	}
+
+	// 3. β˲Ԫ
+	void push_back(const value_type& value) {
+		emplace_back(value);
+	}
+
+	void push_back(value_type&& value) {
+		emplace_back(std::move(value));
+	}
+
+	// 4. βֱӹԪ, ռʱ
+	template<class... Args>
+	reference emplace_back(Args&&... args) {
+		if (size() == cap)
+			return emplace_back_aux(std::forward<Args>(args)...);
+		pointer p = buffer + (tail & (cap - 1));
+		mystl::construct(p, std::forward<Args>(args)...);
+		++tail;
+		return *p;
+	}
+
+	// 5. ͷԪ
+	void push_front(const value_type& value) {
+		emplace_front(value);
+	}
+
+	void push_front(value_type&& value) {
+		emplace_front(std::move(value));
+	}
+
+	// 6. ͷֱӹԪ, ռʱ
+	template<class... Args>
+	reference emplace_front(Args&&... args) {
+		if (size() == cap)
+			return emplace_front_aux(std::forward<Args>(args)...);
+		pointer p = buffer + ((head - 1) & (cap - 1));
+		mystl::construct(p, std::forward<Args>(args)...);
+		--head;
+		return *p;
+	}
+
+	// 7. һԪ
+	void pop_back() {
+		assert(!empty());
+		--tail;
+		mystl::destroy(buffer + (tail & (cap - 1)));
+	}
+
+	// 8. һԪ
+	void pop_front() {
+		assert(!empty());
+		mystl::destroy(buffer + (head & (cap - 1)));
+		++head;
+	}
+
+	// 9. 뵥Ԫ
+	iterator insert(iterator position, const value_type& value) {
+		return emplace(position, value);
+	}
+
+	iterator insert(iterator position, value_type&& value) {
+		return emplace(position, std::move(value));
+	}
+
+	// 10. nԪ, ָһԪصĵ
+	iterator insert(iterator position, size_type n, const value_type& value) {
+		return fill_insert(position, n, value);
+	}
+
+	// 11. [first, last)ڵԪ(ģʽ), ָһԪصĵ
+	template<class InputIterator>
+	iterator insert(iterator position, InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		return insert_dispatch(position, first, last, Integer());
+	}
+
+	// 12. ָλֱӹԪ, ƶpositionϽһ˵Ԫ
+	template<class... Args>
+	iterator emplace(iterator position, Args&&... args);
+
+	// 13. ɾԪ
+	iterator erase(iterator position) {
+		return erase(position, position + 1);
+	}
+
+	// 14. ɾԪ, ƶɾϽһ˵Ԫ
+	iterator erase(iterator first, iterator last);
+
+	// 15. ɾԪ, ռ
+	void clear() {
+		mystl::destroy(begin(), end());
+		head = tail = 0;
+	}
+
+	// 16. 
+	void swap(ring_buffer& rhs) {
+		if (this != &rhs) {
+			data_allocator::propagate_swap(rhs);
+			mystl::swap(buffer, rhs.buffer);
+			mystl::swap(cap, rhs.cap);
+			mystl::swap(head, rhs.head);
+			mystl::swap(tail, rhs.tail);
+		}
+	}
+
+private:
+	//-------------------------------------------------------------------------------------------------------------------
+	typedef std::integral_constant<bool, is_trivially_relocatable<T>::value>	relocatable;
+
+	// Сn2, Ϊinitial_capacity
+	static size_type round_capacity(size_type n) {
+		size_type res = initial_capacity;
+		while (res < n)
+			res <<= 1;
+		return res;
+	}
+
+	// ռȨ(ƶ)
+	void clean() {
+		buffer = nullptr;
+		cap = head = tail = 0;
+	}
+
+	// ֽڰ[first, last)ᵽresult
+	static void move_bytes(const T* first, const T* last, T* result) {
+		if (first != last)
+			std::memcpy(static_cast<void*>(result), static_cast<const void*>(first), sizeof(T) * (last - first));
+	}
+
+	// ֽڰѻе[first, last)ᵽresult, ƻʱθ
+	void move_bytes(iterator first, iterator last, pointer result) {
+		size_type n = last - first;
+		size_type off = first.pos & (cap - 1);
+		size_type n1 = cap - off < n ? cap - off : n;
+		move_bytes(buffer + off, buffer + off + n1, result);
+		move_bytes(buffer, buffer + (n - n1), result + n1);
+	}
+
+	void relocate_to(pointer new_start) {
+		relocate_to(new_start, size(), 0);
+	}
+
+	void relocate_to(pointer new_start, size_type index, size_type n);
+
+	void reallocate(size_type new_cap);
+
+	void insert_relocate(pointer new_start, size_type new_cap, size_type index, size_type n);
+
+	template<class... Args>
+	reference emplace_back_aux(Args&&... args);
+
+	template<class... Args>
+	reference emplace_front_aux(Args&&... args);
+
+	void fill_assign(size_type n, const value_type& value);
+
+	template<class Integer>
+	void assign_dispatch(Integer n, Integer value, true_type) {
+		fill_assign(static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	void assign_dispatch(InputIterator first, InputIterator last, false_type) {
+		assign_aux(first, last, iterator_category(first));
+	}
+
+	template<class InputIterator>
+	void assign_aux(InputIterator first, InputIterator last, input_iterator_tag);
+
+	template<class ForwardIterator>
+	void assign_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+	iterator fill_insert(iterator position, size_type n, const value_type& value);
+
+	void fill_insert_aux(size_type index, size_type n, const value_type& value);
+
+	template<class Integer>
+	iterator insert_dispatch(iterator position, Integer n, Integer value, true_type) {
+		return fill_insert(position, static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	iterator insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
+		return range_insert(position, first, last, iterator_category(first));
+	}
+
+	template<class InputIterator>
+	iterator range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag);
+
+	template<class ForwardIterator>
+	iterator range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+	template<class ForwardIterator>
+	void range_insert_aux(size_type index, ForwardIterator first, ForwardIterator last, size_type n);
+};
+
+//--------------------------------------------------졢ƺ----------------------------------------------------------
+// Ҫɲȵķʱ, þɵķͷſռ
+template<class T, class Alloc>
+ring_buffer<T, Alloc>& ring_buffer<T, Alloc>::operator=(const ring_buffer& rhs) {
+	if (this != &rhs) {
+		if (data_allocator::replaced_on_copy(rhs)) {
+			clear();
+			data_allocator::deallocate(buffer, cap);
+			clean();
+		}
+		data_allocator::propagate_copy(rhs);
+		assign(rhs.begin(), rhs.end());
+	}
+	return *this;
+}
+
+// ƶֵ
+// Ŵʱ, ͷԼĿռ֮ӹrhsĿռ, ƶԪ
+template<class T, class Alloc>
+ring_buffer<T, Alloc>& ring_buffer<T, Alloc>::operator=(ring_buffer&& rhs)
+	noexcept(data_allocator::traits::propagate_on_container_move_assignment::value ||
+		data_allocator::traits::is_always_equal::value) {
+	if (this == &rhs)
+		return *this;
+	if (data_allocator::traits::propagate_on_container_move_assignment::value || data_allocator::same_resource(rhs)) {
+		clear();
+		data_allocator::deallocate(buffer, cap);
+		data_allocator::propagate_move(rhs);
+		buffer = rhs.buffer;
+		cap = rhs.cap;
+		head = rhs.head;
+		tail = rhs.tail;
+		rhs.clean();
+	}
+	else {
+		clear();
+		reserve(rhs.size());
+		for (iterator it = rhs.begin(); it != rhs.end(); ++it)
+			emplace_back(std::move(*it));
+		rhs.clear();
+	}
+	return *this;
+}
+
+//--------------------------------------------------غ--------------------------------------------------------------
+template<class T, class Alloc>
+void ring_buffer<T, Alloc>::shrink_to_fit() {
+	if (empty()) {
+		data_allocator::deallocate(buffer, cap);
+		clean();
+	}
+	else {
+		size_type new_cap = round_capacity(size());
+		if (new_cap < cap)
+			reallocate(new_cap);
+	}
+}
+
+template<class T, class Alloc>
+void ring_buffer<T, Alloc>::resize(size_type n, const value_type& value) {
+	if (n < size()) {
+		erase(begin() + n, end());
+	}
+	else {
+		reserve(n);
+		while (size() < n)
+			emplace_back(value);
+	}
+}
+
+template<class T, class Alloc>
+void ring_buffer<T, Alloc>::resize(size_type n) {
+	if (n < size()) {
+		erase(begin() + n, end());
+	}
+	else {
+		reserve(n);
+		while (size() < n)
+			emplace_back();
+	}
+}
+
+//--------------------------------------------------޸ز--------------------------------------------------------------
+// ָλֱӹԪ
+// Ԫȹʱ(argsеԪ), ٴӽϽһڳλ
+template<class T, class Alloc>
+template<class... Args>
+typename ring_buffer<T, Alloc>::iterator ring_buffer<T, Alloc>::emplace(iterator position, Args&&... args) {
+	difference_type index = position - begin();
+	if (position == end()) {
+		emplace_back(std::forward<Args>(args)...);
+		return end() - 1;
+	}
+	if (0 == index) {
+		emplace_front(std::forward<Args>(args)...);
+		return begin();
+	}
+	value_type x(std::forward<Args>(args)...);
+	if (static_cast<size_type>(index) < size() / 2) {
+		emplace_front(std::move(front()));
+		iterator pos = begin() + index;
+		mystl::move(begin() + 2, pos + 1, begin() + 1);
+		*pos = std::move(x);
+		return pos;
+	}
+	else {
+		emplace_back(std::move(back()));
+		iterator pos = begin() + index;
+		mystl::move_backward(pos, end() - 2, end() - 1);
+		*pos = std::move(x);
+		return pos;
+	}
+}
+
+// ɾԪ
+template<class T, class Alloc>
+typename ring_buffer<T, Alloc>::iterator ring_buffer<T, Alloc>::erase(iterator first, iterator last) {
+	if (first == last)
+		return first;
+	difference_type n = last - first;
+	difference_type elems_before = first - begin();
+	if (static_cast<size_type>(elems_before) < (size() - n) / 2) {
+		mystl::move_backward(begin(), first, last);
+		mystl::destroy(begin(), begin() + n);
+		head += n;
+	}
+	else {
+		mystl::move(last, end(), first);
+		mystl::destroy(end() - n, end());
+		tail -= n;
+	}
+	return begin() + elems_before;
+}
+
+//------------------------------------------------------------------------------------------------------------
+// ѻչnew_startʼһռ, ±겻СindexԪճnλ
+// ԰ֽڰ˵Ԫֱmemcpy, Ԫƶ׳쳣ʱƶ, 
+// ʱѾԪر, ԭԪرֲ
+template<class T, class Alloc>
+void ring_buffer<T, Alloc>::relocate_to(pointer new_start, size_type index, size_type n) {
+	iterator position = begin() + index;
+	if (relocatable::value) {
+		move_bytes(begin(), position, new_start);
+		move_bytes(position, end(), new_start + index + n);
+	}
+	else {
+		pointer mid = mystl::uninitialized_move_if_noexcept(begin(), position, new_start);
+		try {
+			mystl::uninitialized_move_if_noexcept(position, end(), mid + n);
+		}
+		catch (...) {
+			mystl::destroy(new_start, mid);
+			throw;
+		}
+		mystl::destroy(begin(), end());
+	}
+}
+
+// һΪnew_cap¿ռ, һԪط¿ռĿͷ
+// ʱ԰ֽڰ˲ûƻصԪʹreallocate, ڴԭչ, Ԫλò
+template<class T, class Alloc>
+void ring_buffer<T, Alloc>::reallocate(size_type new_cap) {
+	size_type first = head & (cap - 1);
+	if (relocatable::value && new_cap > cap && first + size() <= cap) {
+		buffer = data_allocator::reallocate(buffer, cap, new_cap);
+		tail = first + size();
+		head = first;
+		cap = new_cap;
+		return;
+	}
+	pointer new_start = data_allocator::allocate(new_cap);
+	try {
+		relocate_to(new_start);
+	}
+	catch (...) {
+		data_allocator::deallocate(new_start, new_cap);
+		throw;
+	}
+	data_allocator::deallocate(buffer, cap);
+	tail -= head;
+	head = 0;
+	buffer = new_start;
+	cap = new_cap;
+}
+
+// ռ䲻ʱnԪ: ԪѾnew_start + indexʼλ, ԭԪذᵽߺ󻻵¿ռ
+// ʱԪزͷ¿ռ, ԭԪرֲ
+template<class T, class Alloc>
+void ring_buffer<T, Alloc>::insert_relocate(pointer new_start, size_type new_cap, size_type index, size_type n) {
+	size_type old_size = size();
+	try {
+		relocate_to(new_start, index, n);
+	}
+	catch (...) {
+		mystl::destroy(new_start + index, new_start + index + n);
+		data_allocator::deallocate(new_start, new_cap);
+		throw;
+	}
+	data_allocator::deallocate(buffer, cap);
+	buffer = new_start;
+	cap = new_cap;
+	head = 0;
+	tail = old_size + n;
+}
+
+// ռʱβ˹Ԫ
+// Ԫȹ¿ռ(argsеԪ), ٰԭԪ
+// Ԫؿ԰ֽڰ˲Ҵӿռ俪ͷʼʱ(һֱpush_back), ȹʱreallocate
+template<class T, class Alloc>
+template<class... Args>
+typename ring_buffer<T, Alloc>::reference ring_buffer<T, Alloc>::emplace_back_aux(Args&&... args) {
+	size_type n = size();
+	size_type new_cap = cap ? cap * 2 : static_cast<size_type>(initial_capacity);
+	if (relocatable::value && 0 == (head & (cap - 1))) {
+		value_type x(std::forward<Args>(args)...);
+		reallocate(new_cap);
+		return emplace_back(std::move(x));
+	}
+	pointer new_start = data_allocator::allocate(new_cap);
+	try {
+		mystl::construct(new_start + n, std::forward<Args>(args)...);
+	}
+	catch (...) {
+		data_allocator::deallocate(new_start, new_cap);
+		throw;
+	}
+	try {
+		relocate_to(new_start);
+	}
+	catch (...) {
+		mystl::destroy(new_start + n);
+		data_allocator::deallocate(new_start, new_cap);
+		throw;
+	}
+	data_allocator::deallocate(buffer, cap);
+	buffer = new_start;
+	cap = new_cap;
+	head = 0;
+	tail = n + 1;
+	return new_start[n];
+}
+
+// ռʱͷԪ, Ԫط¿ռһλ, ԭԪشӿͷʼ
+template<class T, class Alloc>
+template<class... Args>
+typename ring_buffer<T, Alloc>::reference ring_buffer<T, Alloc>::emplace_front_aux(Args&&... args) {
+	size_type n = size();
+	size_type new_cap = cap ? cap * 2 : static_cast<size_type>(initial_capacity);
+	pointer new_start = data_allocator::allocate(new_cap);
+	try {
+		mystl::construct(new_start + new_cap - 1, std::forward<Args>(args)...);
+	}
+	catch (...) {
+		data_allocator::deallocate(new_start, new_cap);
+		throw;
+	}
+	try {
+		relocate_to(new_start);
+	}
+	catch (...) {
+		mystl::destroy(new_start + new_cap - 1);
+		data_allocator::deallocate(new_start, new_cap);
+		throw;
+	}
+	data_allocator::deallocate(buffer, cap);
+	buffer = new_start;
+	cap = new_cap;
+	head = new_cap - 1;
+	tail = new_cap + n;
+	return new_start[new_cap - 1];
+}
+
+template<class T, class Alloc>
+void ring_buffer<T, Alloc>::fill_assign(size_type n, const value_type& value) {
+	if (n > cap) {
+		ring_buffer temp(get_allocator());
+		temp.reserve(n);
+		mystl::uninitialized_fill_n(temp.buffer, n, value);
+		temp.tail = n;
+		swap(temp);
+	}
+	else {
+		clear();
+		mystl::uninitialized_fill_n(buffer, n, value);
+		tail = n;
+	}
+}
+
+template<class T, class Alloc>
+template<class InputIterator>
+void ring_buffer<T, Alloc>::assign_aux(InputIterator first, InputIterator last, input_iterator_tag) {
+	clear();
+	for (; first != last; ++first)
+		emplace_back(*first);
+}
+
+// Ԫظ֪, ֱӹ쵽ӿռ俪ͷʼһ
+template<class T, class Alloc>
+template<class ForwardIterator>
+void ring_buffer<T, Alloc>::assign_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type n = static_cast<size_type>(mystl::distance(first, last));
+	if (n > cap) {
+		ring_buffer temp(get_allocator());
+		temp.reserve(n);
+		mystl::uninitialized_copy(first, last, temp.buffer);
+		temp.tail = n;
+		swap(temp);
+	}
+	else {
+		clear();
+		mystl::uninitialized_copy(first, last, buffer);
+		tail = n;
+	}
+}
+
+// nԪ
+// ռ䲻ʱԪֱӹ쵽¿ռеλ, ԭԪֻһ
+// ԰ֽڰ˵Ԫز뵽βʱ, reallocate(ڴԭչ), β˹
+template<class T, class Alloc>
+typename ring_buffer<T, Alloc>::iterator
+ring_buffer<T, Alloc>::fill_insert(iterator position, size_type n, const value_type& value) {
+	size_type index = position - begin();
+	if (0 == n)
+		return position;
+	if (size() + n > cap && (index != size() || !relocatable::value)) {
+		size_type new_cap = round_capacity(size() + n);
+		pointer new_start = data_allocator::allocate(new_cap);
+		try {
+			mystl::uninitialized_fill_n(new_start + index, n, value);
+		}
+		catch (...) {
+			data_allocator::deallocate(new_start, new_cap);
+			throw;
+		}
+		insert_relocate(new_start, new_cap, index, n);
+	}
+	else if (size() + n > cap) {
+		value_type x = value;		// valueܾеԪ, ֮ʧЧ
+		reserve(size() + n);
+		fill_insert_aux(index, n, x);
+	}
+	else {
+		fill_insert_aux(index, n, value);
+	}
+	return begin() + index;
+}
+
+// ռ㹻ʱnԪ, ƶλýϽһ˵Ԫ
+// ȹδʼλϵԪ, ÿһξ͸headtail, ʱȻЧ
+template<class T, class Alloc>
+void ring_buffer<T, Alloc>::fill_insert_aux(size_type index, size_type n, const value_type& value) {
+	value_type x = value;		// valueܾлᱻƶԪ
+	if (index < size() / 2) {
+		iterator old_begin = begin();
+		iterator position = old_begin + index;
+		// position֮ǰԪظСn
+		// ǰnԪƵͷ֮ǰ -> ƶʣµǰ벿 -> 
+		if (index >= n) {
+			mystl::uninitialized_move(old_begin, old_begin + n, old_begin - n);
+			head -= n;
+			mystl::move(old_begin + n, position, old_begin);
+			mystl::fill(position - n, position, x);
+		}
+		// position֮ǰԪظСn
+		// һ -> תǰ벿 -> ʣ²
+		else {
+			mystl::uninitialized_fill_n(old_begin - (n - index), n - index, x);
+			head -= n - index;
+			mystl::uninitialized_move(old_begin, position, old_begin - n);
+			head -= index;
+			mystl::fill(old_begin, position, x);
+		}
+	}
+	else {
+		iterator old_end = end();
+		iterator position = begin() + index;
+		size_type elems_after = size() - index;
+		// position֮Ԫظn
+		// nԪƵβ֮ -> ƶʣµĺ벿 -> 
+		if (elems_after > n) {
+			mystl::uninitialized_move(old_end - n, old_end, old_end);
+			tail += n;
+			mystl::move_backward(position, old_end - n, old_end);
+			mystl::fill(position, position + n, x);
+		}
+		// position֮Ԫظn
+		// һ -> תƺ벿 -> ʣ²
+		else {
+			mystl::uninitialized_fill_n(old_end, n - elems_after, x);
+			tail += n - elems_after;
+			mystl::uninitialized_move(position, old_end, end());
+			tail += elems_after;
+			mystl::fill(position, old_end, x);
+		}
+	}
+}
+
+// Ԫظδ֪, 
+template<class T, class Alloc>
+template<class InputIterator>
+typename ring_buffer<T, Alloc>::iterator
+ring_buffer<T, Alloc>::range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag) {
+	difference_type index = position - begin();
+	for (; first != last; ++first, ++position)
+		position = emplace(position, *first);
+	return begin() + index;
+}
+
+// Ԫظ֪, ͬfill_insert
+template<class T, class Alloc>
+template<class ForwardIterator>
+typename ring_buffer<T, Alloc>::iterator
+ring_buffer<T, Alloc>::range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type index = position - begin();
+	size_type n = static_cast<size_type>(mystl::distance(first, last));
+	if (0 == n)
+		return position;
+	if (size() + n > cap && (index != size() || !relocatable::value)) {
+		size_type new_cap = round_capacity(size() + n);
+		pointer new_start = data_allocator::allocate(new_cap);
+		try {
+			mystl::uninitialized_copy(first, last, new_start + index);
+		}
+		catch (...) {
+			data_allocator::deallocate(new_start, new_cap);
+			throw;
+		}
+		insert_relocate(new_start, new_cap, index, n);
+	}
+	else {
+		reserve(size() + n);
+		range_insert_aux(index, first, last, n);
+	}
+	return begin() + index;
+}
+
+// ռ㹻ʱ[first, last)ڵnԪ, ͬfill_insert_aux
+template<class T, class Alloc>
+template<class ForwardIterator>
+void ring_buffer<T, Alloc>::range_insert_aux(size_type index, ForwardIterator first, ForwardIterator last, size_type n) {
+	if (index < size() / 2) {
+		iterator old_begin = begin();
+		iterator position = old_begin + index;
+		if (index >= n) {
+			mystl::uninitialized_move(old_begin, old_begin + n, old_begin - n);
+			head -= n;
+			mystl::move(old_begin + n, position, old_begin);
+			mystl::copy(first, last, position - n);
+		}
+		else {
+			ForwardIterator mid = first;
+			mystl::advance(mid, n - index);
+			mystl::uninitialized_copy(first, mid, old_begin - (n - index));
+			head -= n - index;
+			mystl::uninitialized_move(old_begin, position, old_begin - n);
+			head -= index;
+			mystl::copy(mid, last, old_begin);
+		}
+	}
+	else {
+		iterator old_end = end();
+		iterator position = begin() + index;
+		size_type elems_after = size() - index;
+		if (elems_after > n) {
+			mystl::uninitialized_move(old_end - n, old_end, old_end);
+			tail += n;
+			mystl::move_backward(position, old_end - n, old_end);
+			mystl::copy(first, last, position);
+		}
+		else {
+			ForwardIterator mid = first;
+			mystl::advance(mid, elems_after);
+			mystl::uninitialized_copy(mid, last, old_end);
+			tail += n - elems_after;
+			mystl::uninitialized_move(position, old_end, end());
+			tail += elems_after;
+			mystl::copy(first, mid, position);
+		}
+	}
+}
+
+//--------------------------------------------------Ƚϲ----------------------------------------------------------
+template<class T, class Alloc>
+bool operator==(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs) {
+	return lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class T, class Alloc>
+bool operator<(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs) {
+	return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<class T, class Alloc>
+bool operator!=(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs) {
+	return !(lhs == rhs);
+}
+
+template<class T, class Alloc>
+bool operator>(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs) {
+	return rhs < lhs;
+}
+
+template<class T, class Alloc>
+bool operator<=(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs) {
+	return !(rhs < lhs);
+}
+
+template<class T, class Alloc>
+bool operator>=(const ring_buffer<T, Alloc>& lhs, const ring_buffer<T, Alloc>& rhs) {
+	return !(lhs < rhs);
+}
+
+template<class T, class Alloc>
+void swap(ring_buffer<T, Alloc>& lhs, ring_buffer<T, Alloc>& rhs) {
+	lhs.swap(rhs);
+}
+
+}	// mystl
+
+#endif
@@ -0,0 +1,194 @@
+#ifndef MYSTL_RING_BUFFER_TEST_H
+#define MYSTL_RING_BUFFER_TEST_H
+
+#include "test.h"
+#include "../MySTL/ring_buffer.h"
+#include "../MySTL/queue.h"
+#include "../MySTL/stack.h"
+#include <iostream>
+#include <string>
+#include <queue>
+
+namespace mystl {
+namespace ring_buffer_test {
+
+// Ϊʹ: ȷlenԪ, push/popcount
+// ring_bufferݵλ֮ռ, ÿβֻһ±
+#define QUEUE_CHURN_DO_TEST(con, len, count) do {							\
+	con q;																	\
+	for (size_t i = 0; i < len; i++)										\
+		q.push(static_cast<int>(i));										\
+	clock_t start, end;														\
+	size_t sum = 0;															\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++) {									\
+		q.push(static_cast<int>(i));										\
+		sum += q.front();													\
+		q.pop();															\
+	}																		\
+	end = clock();															\
+	if (0 == sum)															\
+		std::cout << "wrong sum";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+// ӿնпʼpush countԪ, ȫpop
+#define QUEUE_FILL_DO_TEST(con, len, count) do {							\
+	con q;																	\
+	clock_t start, end;														\
+	size_t sum = 0;															\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++)										\
+		q.push(static_cast<int>(i));										\
+	while (!q.empty()) {													\
+		sum += q.front();													\
+		q.pop();															\
+	}																		\
+	end = clock();															\
+	if (0 == sum)															\
+		std::cout << "wrong sum";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define QUEUE_TEST(TEST, len, len1, len2, len3) do {						\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|      std::queue     |";									\
+	TEST(std::queue<int>, len, len1);										\
+	TEST(std::queue<int>, len, len2);										\
+	TEST(std::queue<int>, len, len3);										\
+	std::cout << "\n|  queue over deque   |";								\
+	TEST(mystl::queue<int>, len, len1);										\
+	TEST(mystl::queue<int>, len, len2);										\
+	TEST(mystl::queue<int>, len, len3);										\
+	std::cout << "\n| queue over ring_buf |";								\
+	TEST(RING_QUEUE_INT, len, len1);										\
+	TEST(RING_QUEUE_INT, len, len2);										\
+	TEST(RING_QUEUE_INT, len, len3);										\
+	std::cout << "\n";														\
+} while(0)
+
+typedef mystl::queue<int, mystl::ring_buffer<int>> RING_QUEUE_INT;
+
+void ring_buffer_test() {
+	std::cout << "[===============================================================]\n";
+	std::cout << "[-------------- Run container test : ring_buffer ---------------]\n";
+	std::cout << "[-------------------------- API test ---------------------------]\n";
+
+	int test[] = { 1, 2, 3, 4, 5 };
+	mystl::ring_buffer<int> r1;
+	mystl::ring_buffer<int> r2(10);
+	mystl::ring_buffer<int> r3(10, 1);
+	mystl::ring_buffer<int> r4(test, test + 5);
+	mystl::ring_buffer<int> r5(r2);
+	mystl::ring_buffer<int> r6(std::move(r2));
+	mystl::ring_buffer<int> r7{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	mystl::ring_buffer<int> r8, r9, r10;
+	r8 = r3;
+	r9 = std::move(r3);
+	r10 = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	FUN_AFTER(r1, r1.assign(8, 8));
+	FUN_AFTER(r1, r1.assign(test, test + 5));
+	FUN_AFTER(r1, r1.push_back(6));
+	FUN_AFTER(r1, r1.push_front(0));
+	FUN_AFTER(r1, r1.emplace_back(7));
+	FUN_AFTER(r1, r1.emplace_front(-1));
+	FUN_AFTER(r1, r1.pop_front());
+	FUN_AFTER(r1, r1.pop_back());
+	FUN_AFTER(r1, r1.insert(r1.begin() + 1, 9));
+	FUN_AFTER(r1, r1.insert(r1.end() - 1, 9));
+	FUN_AFTER(r1, r1.insert(r1.begin() + 2, 3, 5));
+	FUN_AFTER(r1, r1.insert(r1.end() - 2, test, test + 5));
+	FUN_AFTER(r1, r1.insert(r1.end(), 2, 0));
+	FUN_AFTER(r1, r1.erase(r1.begin() + 1));
+	FUN_AFTER(r1, r1.erase(r1.end() - 3, r1.end() - 1));
+	FUN_AFTER(r1, r1.swap(r4));
+
+	FUN_VALUE(*r1.begin());
+	FUN_VALUE(*(r1.end() - 1));
+	FUN_VALUE(*r1.rbegin());
+	FUN_VALUE(*(r1.rend() - 1));
+	FUN_VALUE(r1.front());
+	FUN_VALUE(r1.back());
+	FUN_VALUE(r1[0]);
+	FUN_VALUE(r1.at(1));
+
+	std::cout << std::boolalpha;
+	FUN_VALUE(r1.empty());
+	FUN_VALUE((r7 == r10));
+	FUN_VALUE((r4 < r1));
+	std::cout << std::noboolalpha;
+
+	FUN_VALUE(r1.size());
+	FUN_VALUE(r1.capacity());
+
+	// Ԫƹռĩβ֮, 㷨ƻصֱ
+	mystl::ring_buffer<int> r11;
+	r11.reserve(16);
+	for (int i = 0; i < 12; i++)
+		r11.push_back(i);
+	for (int i = 0; i < 10; i++) {
+		r11.pop_front();
+		r11.push_back(20 - i);
+	}
+	FUN_VALUE(r11.capacity());
+	FUN_AFTER(r11, mystl::sort(r11.begin(), r11.end()));
+	FUN_VALUE(*mystl::find(r11.begin(), r11.end(), 15));
+	FUN_AFTER(r11, mystl::fill(r11.begin() + 4, r11.end() - 4, 0));
+	FUN_AFTER(r11, r11.insert(r11.begin() + 1, 2, 50));
+	FUN_AFTER(r11, r11.insert(r11.end() - 1, test, test + 2));
+	FUN_AFTER(r11, r11.push_back(99));
+	FUN_VALUE(r11.capacity());
+	FUN_AFTER(r11, r11.resize(4));
+	FUN_AFTER(r11, r11.shrink_to_fit());
+	FUN_VALUE(r11.capacity());
+
+	mystl::ring_buffer<std::string> rs;
+	rs.push_back(std::string(32, 'a'));
+	FUN_AFTER(rs, rs.emplace_back(3, 'b'));
+	FUN_AFTER(rs, rs.emplace_front("c"));
+	FUN_AFTER(rs, rs.insert(rs.begin() + 1, "d"));
+	FUN_AFTER(rs, rs.insert(rs.begin() + 1, 2, rs.back()));
+	mystl::ring_buffer<std::string> rs2(rs);
+	FUN_AFTER(rs2, rs2.erase(rs2.begin()));
+	FUN_AFTER(rs, rs.insert(rs.end() - 1, rs2.begin(), rs2.end()));
+	FUN_AFTER(rs, rs.swap(rs2));
+
+	// Ϊqueuestackĵײ
+	mystl::queue<int, mystl::ring_buffer<int>> q1{ 1, 2, 3 };
+	q1.push(4);
+	q1.pop();
+	FUN_VALUE(q1.front());
+	FUN_VALUE(q1.back());
+	FUN_VALUE(q1.size());
+	mystl::stack<int, mystl::ring_buffer<int>> s1{ 1, 2, 3 };
+	s1.push(4);
+	s1.pop();
+	FUN_VALUE(s1.top());
+	FUN_VALUE(s1.size());
+
+	PASSED;
+
+#if PERFORMANCE_TEST_ON
+	std::cout << "[--------------------- Performance Testing ---------------------]\n";
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|   push + pop (64)   |";
+	QUEUE_TEST(QUEUE_CHURN_DO_TEST, 64, L(LEN2), M(LEN3), L(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|  push + pop (4096)  |";
+	QUEUE_TEST(QUEUE_CHURN_DO_TEST, 4096, L(LEN2), M(LEN3), L(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|   push all, pop all |";
+	QUEUE_TEST(QUEUE_FILL_DO_TEST, 0, M(LEN2), M(LEN3), L(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	PASSED;
+#endif
+	std::cout << "[-------------- End container test : ring_buffer ---------------]\n";
+	std::cout << std::endl;
+	std::cout << std::endl;
+}
+
+}	// ring_buffer_test
+}	// mystl
+
+#endif
@@ -40,7 +40,9 @@ public:
 	// ͸ƺ
 	set() : tree(Compare()) {};
 
-	explicit set(Compare& comp) : tree(comp) {};
+	explicit set(Compare& comp, const Alloc& a = Alloc()) : tree(comp, a) {};
+
+	explicit set(const Alloc& a) : tree(Compare(), a) {};
 
 	template<class InputIterator>
 	set(InputIterator first, InputIterator last) : tree() {
@@ -48,7 +50,7 @@ public:
 	}
 
 	template<class InputIterator>
-	set(InputIterator first, InputIterator last, Compare& comp) : tree(comp) {
+	set(InputIterator first, InputIterator last, Compare& comp, const Alloc& a = Alloc()) : tree(comp, a) {
 		tree.insert_unique(first, last);
 	}
 
@@ -282,7 +284,9 @@ public:
 // ͸ƺ
 	multiset() : tree(Compare()) {};
 
-	explicit multiset(Compare& comp) : tree(comp) {};
+	explicit multiset(Compare& comp, const Alloc& a = Alloc()) : tree(comp, a) {};
+
+	explicit multiset(const Alloc& a) : tree(Compare(), a) {};
 
 	template<class InputIterator>
 	multiset(InputIterator first, InputIterator last) : tree(Compare()) {
@@ -290,7 +294,7 @@ public:
 	}
 
 	template<class InputIterator>
-	multiset(InputIterator first, InputIterator last, Compare comp) : tree(comp) {
+	multiset(InputIterator first, InputIterator last, Compare comp, const Alloc& a = Alloc()) : tree(comp, a) {
 		tree.insert_equal(first, last);
 	}
 
@@ -0,0 +1,902 @@
+#ifndef MYSTL_SLIST_H
+#define MYSTL_SLIST_H
+
+// ļslist
+// , ÿֻһnextָ, listĽһָ
+// ͷֱӷ, յslistκοռ
+// ֻڸλ֮ɾ, Խӿinsert_after/erase_after/splice_after
+// listһͨsimple_alloc<, Alloc>, ʹallocshard_allocpolymorphic_allocȷ
+
+#include "iterator.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "algorithm.h"
+#include <cstddef>
+#include <cassert>
+
+namespace mystl {
+
+enum { SLIST_CHAIN_NODES = BATCH_OBJS };		// ԪʱÿĽ, listͬ
+
+//-----------------------------------------------slistĽ---------------------------------------------------------------
+// slist_node_baseֻһָһָ, һnextΪnullptr
+struct slist_node_base {
+	slist_node_base* next;
+};
+
+template<class T>
+struct slist_node : public slist_node_base {
+	T data;
+};
+
+// ȽеԪ, ڶԽָ
+template<class T, class Compare>
+struct slist_node_compare {
+	Compare comp;
+
+	slist_node_compare(const Compare& c) : comp(c) {};
+
+	bool operator()(const slist_node<T>* x, const slist_node<T>* y) {
+		return comp(x->data, y->data);
+	}
+};
+
+//-----------------------------------------------slistĵ---------------------------------------------------------------
+// slist, ֻǰƶ, end()ǿָ
+template<class T, class Ref, class Ptr>
+struct slist_iterator : public iterator<forward_iterator_tag, T> {
+	// typedef
+	typedef slist_iterator<T, T&, T*>					iterator;
+	typedef slist_iterator<T, const T&, const T*>		const_iterator;
+
+	typedef T											value_type;
+	typedef Ptr											pointer;
+	typedef Ref											reference;
+	typedef forward_iterator_tag						iterator_category;
+	typedef size_t										size_type;
+	typedef ptrdiff_t									difference_type;
+
+	typedef slist_iterator								self;
+
+	slist_node_base* node;
+
+	// 캯
+	slist_iterator() : node(nullptr) {};
+
+	slist_iterator(slist_node_base* x) : node(x) {};
+
+	slist_iterator(const iterator& rhs) : node(rhs.node) {};
+
+	// 
+	reference operator*() const {
+		return static_cast<slist_node<T>*>(node)->data;
+	}
+
+	pointer operator->() const {
+		return &(operator*());
+	}
+
+	self& operator++() {
+		node = node->next;
+		return *this;
+	}
+
+	self operator++(int) {
+		self temp = *this;
+		node = node->next;
+		return temp;
+	}
+
+	bool operator==(const self& rhs) const {
+		return node == rhs.node;
+	}
+
+	bool operator!=(const self& rhs) const {
+		return node != rhs.node;
+	}
+};
+
+//-----------------------------------------------slist---------------------------------------------------------------
+// slist
+// άͷԪظ, Ԫظ롢ɾsplice_after, size()O(1)
+template<class T, class Alloc = alloc>
+class slist : private simple_alloc<slist_node<T>, Alloc> {
+public:
+	// ָ
+	typedef slist_node_base*								base_ptr;
+	typedef slist_node<T>*									node_ptr;
+
+	// 
+	typedef Alloc											allocator_type;
+	typedef simple_alloc<slist_node<T>, Alloc>				node_allocator;
+
+	// 
+	typedef T												value_type;
+	typedef T*												pointer;
+	typedef const T*										const_pointer;
+	typedef T&												reference;
+	typedef const T&										const_reference;
+	typedef size_t											size_type;
+	typedef ptrdiff_t										difference_type;
+
+	// 
+	typedef slist_iterator<T, T&, T*>						iterator;
+	typedef slist_iterator<T, const T&, const T*>			const_iterator;
+
+	// õʹõķ
+	allocator_type get_allocator() const {
+		return node_allocator::resource();
+	}
+
+private:
+	slist_node_base head;	// ͷ, head.nextǵһԪ
+	size_type len;			// Ԫظ
+
+public:
+	//-----------------------------------------------------졢ƺ---------------------------------------------------
+	slist() : len(0) {
+		head.next = nullptr;
+	}
+
+	explicit slist(const Alloc& a) : node_allocator(a), len(0) {
+		head.next = nullptr;
+	}
+
+	explicit slist(size_type n) : len(0) {
+		head.next = nullptr;
+		fill_insert_after(before_begin(), n, T());
+	}
+
+	slist(size_type n, const value_type& value, const Alloc& a = Alloc()) : node_allocator(a), len(0) {
+		head.next = nullptr;
+		fill_insert_after(before_begin(), n, value);
+	}
+
+	template<class InputIterator>
+	slist(InputIterator first, InputIterator last, const Alloc& a = Alloc()) : node_allocator(a), len(0) {
+		head.next = nullptr;
+		insert_after(before_begin(), first, last);
+	}
+
+	slist(std::initializer_list<value_type> ilist, const Alloc& a = Alloc()) : node_allocator(a), len(0) {
+		head.next = nullptr;
+		range_insert_after(before_begin(), ilist.begin(), ilist.end());
+	}
+
+	// ķselect_on_container_copy_construction
+	slist(const slist& rhs)
+		: node_allocator(node_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())), len(0) {
+		head.next = nullptr;
+		range_insert_after(before_begin(), rhs.begin(), rhs.end());
+	}
+
+	slist(const slist& rhs, const Alloc& a) : node_allocator(a), len(0) {
+		head.next = nullptr;
+		range_insert_after(before_begin(), rhs.begin(), rhs.end());
+	}
+
+	// ƶ캯, ֱӽӹrhsĽ
+	slist(slist&& rhs) noexcept : node_allocator(rhs.get_allocator()), len(rhs.len) {
+		head.next = rhs.head.next;
+		rhs.head.next = nullptr;
+		rhs.len = 0;
+	}
+
+	slist& operator=(const slist& rhs);
+
+	slist& operator=(slist&& rhs)
+		noexcept(node_allocator::traits::propagate_on_container_move_assignment::value ||
+			node_allocator::traits::is_always_equal::value);
+
+	slist& operator=(std::initializer_list<value_type> ilist) {
+		assign(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+	~slist() {
+		clear();
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	// һԪ֮ǰλ, ͷinsert_after/erase_after/splice_after
+	iterator before_begin() {
+		return iterator(&head);
+	}
+
+	const_iterator before_begin() const {
+		return const_iterator(const_cast<base_ptr>(&head));
+	}
+
+	iterator begin() {
+		return iterator(head.next);
+	}
+
+	const_iterator begin() const {
+		return const_iterator(head.next);
+	}
+
+	iterator end() {
+		return iterator(nullptr);
+	}
+
+	const_iterator end() const {
+		return const_iterator(nullptr);
+	}
+
+	const_iterator cbefore_begin() const {
+		return before_begin();
+	}
+
+	const_iterator cbegin() const {
+		return begin();
+	}
+
+	const_iterator cend() const {
+		return end();
+	}
+
+	// positionǰһλ, Ҫͷʼ, O(n)
+	iterator previous(const_iterator position) {
+		return iterator(previous_node(&head, position.node));
+	}
+
+	const_iterator previous(const_iterator position) const {
+		return const_iterator(previous_node(const_cast<base_ptr>(&head), position.node));
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	bool empty() const {
+		return head.next == nullptr;
+	}
+
+	size_type size() const {
+		return len;
+	}
+
+	size_type max_size() const {
+		return static_cast<size_type>(-1) / sizeof(slist_node<T>);
+	}
+
+	void resize(size_type new_size, const value_type& value);
+
+	void resize(size_type new_size) {
+		resize(new_size, T());
+	}
+
+	//-----------------------------------------------------Ԫغ---------------------------------------------------------
+	reference front() {
+		assert(!empty());
+		return static_cast<node_ptr>(head.next)->data;
+	}
+
+	const_reference front() const {
+		assert(!empty());
+		return static_cast<node_ptr>(head.next)->data;
+	}
+
+	//-------------------------------------------------޸ز----------------------------------------------------------
+	// 1. ֵ
+	void assign(size_type n, const value_type& value);
+
+	// 2. ֵ(ģʽ)
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		assign_dispatch(first, last, Integer());
+	}
+
+	void assign(std::initializer_list<value_type> ilist) {
+		assign(ilist.begin(), ilist.end());
+	}
+
+	// 3. ͷԪ, O(1)
+	void push_front(const value_type& value) {
+		emplace_after(before_begin(), value);
+	}
+
+	void push_front(value_type&& value) {
+		emplace_after(before_begin(), std::move(value));
+	}
+
+	// 4. ͷֱӹԪ
+	template<class... Args>
+	reference emplace_front(Args&&... args) {
+		return *emplace_after(before_begin(), std::forward<Args>(args)...);
+	}
+
+	// 5. һԪ
+	void pop_front() {
+		assert(!empty());
+		erase_after(before_begin());
+	}
+
+	// 6. positionֱ֮ӹԪ, ָԪصĵ
+	template<class... Args>
+	iterator emplace_after(const_iterator position, Args&&... args) {
+		node_ptr p = create_node(std::forward<Args>(args)...);
+		p->next = position.node->next;
+		position.node->next = p;
+		++len;
+		return iterator(p);
+	}
+
+	// 7. position֮Ԫ, ָһԪصĵ(ûвԪʱposition)
+	iterator insert_after(const_iterator position, const value_type& value) {
+		return emplace_after(position, value);
+	}
+
+	iterator insert_after(const_iterator position, value_type&& value) {
+		return emplace_after(position, std::move(value));
+	}
+
+	iterator insert_after(const_iterator position, size_type n, const value_type& value) {
+		return fill_insert_after(position, n, value);
+	}
+
+	template<class InputIterator>
+	iterator insert_after(const_iterator position, InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		return insert_after_dispatch(position, first, last, Integer());
+	}
+
+	iterator insert_after(const_iterator position, std::initializer_list<value_type> ilist) {
+		return range_insert_after(position, ilist.begin(), ilist.end());
+	}
+
+	// 8. ɾposition֮һԪ, رɾԪصһλ
+	iterator erase_after(const_iterator position) {
+		base_ptr p = position.node->next;
+		position.node->next = p->next;
+		destroy_node(static_cast<node_ptr>(p));
+		--len;
+		return iterator(position.node->next);
+	}
+
+	// 9. ɾ(first, last)֮Ԫ, last
+	iterator erase_after(const_iterator first, const_iterator last);
+
+	// 10. ɾԪ
+	void clear() {
+		erase_after(before_begin(), end());
+	}
+
+	// 11. 
+	void swap(slist& rhs) {
+		node_allocator::propagate_swap(rhs);
+		mystl::swap(head.next, rhs.head.next);
+		mystl::swap(len, rhs.len);
+	}
+
+	//-------------------------------------------------slistز-------------------------------------------------------------
+	// otherԪƶposition֮
+	void splice_after(const_iterator position, slist& other);
+
+	// i֮һԪƶposition֮
+	void splice_after(const_iterator position, slist& other, const_iterator i);
+
+	// (first, last)֮Ԫƶposition֮, һslistƶһֽʱҪ
+	void splice_after(const_iterator position, slist& other, const_iterator first, const_iterator last);
+
+	void remove(const value_type& value) {
+		remove_if([&](const value_type& x) { return x == value; });
+	}
+
+	template<class Predicate>
+	void remove_if(Predicate pred);
+
+	void unique() {
+		unique(mystl::equal_to<T>());
+	}
+
+	template<class BinaryPredicate>
+	void unique(BinaryPredicate binary_pred);
+
+	void merge(slist& other) {
+		merge(other, mystl::less<T>());
+	}
+
+	template<class StrictWeakOrdering>
+	void merge(slist& other, StrictWeakOrdering comp);
+
+	void reverse();
+
+	void sort() {
+		sort(mystl::less<T>());
+	}
+
+	// listһ, ʹpointer_sort, 벻ʱʹmerge_sort, ߶ȶ
+	template<class StrictWeakOrdering>
+	void sort(StrictWeakOrdering comp) {
+		if (len < 2)
+			return;
+		if (!pointer_sort(comp))
+			merge_sort(comp);
+	}
+
+private:
+	//-------------------------------------------------------------------------------------------------------------------
+	template<class... Args>
+	node_ptr create_node(Args&&... args) {
+		node_ptr p = node_allocator::allocate(1);
+		try {
+			mystl::construct(&p->data, std::forward<Args>(args)...);
+		}
+		catch (...) {
+			node_allocator::deallocate(p, 1);
+			throw;
+		}
+		p->next = nullptr;
+		return p;
+	}
+
+	void destroy_node(node_ptr p) {
+		mystl::destroy(&p->data);
+		node_allocator::deallocate(p, 1);
+	}
+
+	// allocate_chainõĻûйĽռ
+	void put_nodes(void* chain) {
+		while (chain != nullptr) {
+			void* next = *static_cast<void**>(chain);
+			node_allocator::deallocate(static_cast<node_ptr>(chain), 1);
+			chain = next;
+		}
+	}
+
+	// startʼҵnextΪxĽ
+	static base_ptr previous_node(base_ptr start, const slist_node_base* x) {
+		while (start && start->next != x)
+			start = start->next;
+		return start;
+	}
+
+	template<class Integer>
+	void assign_dispatch(Integer n, Integer value, true_type) {
+		assign(static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	void assign_dispatch(InputIterator first, InputIterator last, false_type);
+
+	template<class Integer>
+	iterator insert_after_dispatch(const_iterator position, Integer n, Integer value, true_type) {
+		return fill_insert_after(position, static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	iterator insert_after_dispatch(const_iterator position, InputIterator first, InputIterator last, false_type) {
+		return range_insert_after(position, first, last);
+	}
+
+	iterator fill_insert_after(const_iterator position, size_type n, const value_type& value);
+
+	template<class InputIterator>
+	iterator range_insert_after(const_iterator position, InputIterator first, InputIterator last) {
+		return range_insert_after_aux(position, first, last, iterator_category(first));
+	}
+
+	template<class InputIterator>
+	iterator range_insert_after_aux(const_iterator position, InputIterator first, InputIterator last, input_iterator_tag);
+
+	template<class ForwardIterator>
+	iterator range_insert_after_aux(const_iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+	template<class ValueSource>
+	iterator chain_insert_after(const_iterator position, size_type n, ValueSource next_value);
+
+	iterator link_chain_after(const_iterator position, node_ptr first, node_ptr last, size_type n);
+
+	void destroy_chain(base_ptr first);
+
+	// *thisΪʱӹotherн, 漰
+	void take(slist& other) {
+		assert(empty());
+		head.next = other.head.next;
+		len = other.len;
+		other.head.next = nullptr;
+		other.len = 0;
+	}
+
+	template<class StrictWeakOrdering>
+	bool pointer_sort(StrictWeakOrdering comp);
+
+	template<class StrictWeakOrdering>
+	void merge_sort(StrictWeakOrdering comp);
+};
+
+//--------------------------------------------------졢ƺ------------------------------------------------------
+template<class T, class Alloc>
+slist<T, Alloc>& slist<T, Alloc>::operator=(const slist& rhs) {
+	if (this != &rhs) {
+		// Ҫɲȵķ, þɵķͷн
+		if (node_allocator::replaced_on_copy(rhs))
+			clear();
+		node_allocator::propagate_copy(rhs);
+		assign(rhs.begin(), rhs.end());
+	}
+	return *this;
+}
+
+// ƶʱֱӽӹrhsĽ, ƶԪ
+template<class T, class Alloc>
+slist<T, Alloc>& slist<T, Alloc>::operator=(slist&& rhs)
+	noexcept(node_allocator::traits::propagate_on_container_move_assignment::value ||
+		node_allocator::traits::is_always_equal::value) {
+	if (this == &rhs)
+		return *this;
+	clear();
+	if (node_allocator::traits::propagate_on_container_move_assignment::value || node_allocator::same_resource(rhs)) {
+		node_allocator::propagate_move(rhs);
+		head.next = rhs.head.next;
+		len = rhs.len;
+		rhs.head.next = nullptr;
+		rhs.len = 0;
+	}
+	else {
+		iterator tail = before_begin();
+		for (iterator it = rhs.begin(); it != rhs.end(); ++it)
+			tail = emplace_after(tail, std::move(*it));
+		rhs.clear();
+	}
+	return *this;
+}
+
+//--------------------------------------------------غ--------------------------------------------------------------
+// ָԪظ, 䳤ʱβvalue
+template<class T, class Alloc>
+void slist<T, Alloc>::resize(size_type new_size, const value_type& value) {
+	base_ptr cur = &head;
+	size_type n = new_size < len ? new_size : len;
+	for (; n > 0; --n)
+		cur = cur->next;
+	if (new_size < len)
+		erase_after(const_iterator(cur), end());
+	else
+		fill_insert_after(const_iterator(cur), new_size - len, value);
+}
+
+//-------------------------------------------------޸ز----------------------------------------------------------
+// еԪֱӸֵ, ɾ, β
+template<class T, class Alloc>
+void slist<T, Alloc>::assign(size_type n, const value_type& value) {
+	base_ptr prev = &head;
+	for (; prev->next && n > 0; --n) {
+		static_cast<node_ptr>(prev->next)->data = value;
+		prev = prev->next;
+	}
+	if (n > 0)
+		fill_insert_after(const_iterator(prev), n, value);
+	else
+		erase_after(const_iterator(prev), end());
+}
+
+template<class T, class Alloc>
+template<class InputIterator>
+void slist<T, Alloc>::assign_dispatch(InputIterator first, InputIterator last, false_type) {
+	base_ptr prev = &head;
+	for (; prev->next && first != last; ++first) {
+		static_cast<node_ptr>(prev->next)->data = *first;
+		prev = prev->next;
+	}
+	if (first != last)
+		range_insert_after(const_iterator(prev), first, last);
+	else
+		erase_after(const_iterator(prev), end());
+}
+
+template<class T, class Alloc>
+typename slist<T, Alloc>::iterator
+slist<T, Alloc>::erase_after(const_iterator first, const_iterator last) {
+	base_ptr cur = first.node->next;
+	while (cur != last.node) {
+		base_ptr next = cur->next;
+		destroy_node(static_cast<node_ptr>(cur));
+		--len;
+		cur = next;
+	}
+	first.node->next = last.node;
+	return iterator(last.node);
+}
+
+//-------------------------------------------------slistز-------------------------------------------------------------
+template<class T, class Alloc>
+void slist<T, Alloc>::splice_after(const_iterator position, slist& other) {
+	if (this == &other || other.empty())
+		return;
+	base_ptr last = previous_node(&other.head, nullptr);
+	last->next = position.node->next;
+	position.node->next = other.head.next;
+	other.head.next = nullptr;
+	len += other.len;
+	other.len = 0;
+}
+
+template<class T, class Alloc>
+void slist<T, Alloc>::splice_after(const_iterator position, slist& other, const_iterator i) {
+	base_ptr p = i.node->next;
+	if (position == i || position.node == p)
+		return;
+	i.node->next = p->next;
+	p->next = position.node->next;
+	position.node->next = p;
+	if (this != &other) {
+		++len;
+		--other.len;
+	}
+}
+
+template<class T, class Alloc>
+void slist<T, Alloc>::splice_after(const_iterator position, slist& other, const_iterator first, const_iterator last) {
+	if (first == last || first.node->next == last.node)
+		return;
+	// ҵ(first, last)еһ, ˳
+	base_ptr tail = first.node->next;
+	size_type n = 1;
+	for (; tail->next != last.node; tail = tail->next)
+		++n;
+	if (this != &other) {
+		len += n;
+		other.len -= n;
+	}
+	base_ptr moved = first.node->next;
+	first.node->next = last.node;
+	tail->next = position.node->next;
+	position.node->next = moved;
+}
+
+template<class T, class Alloc>
+template<class Predicate>
+void slist<T, Alloc>::remove_if(Predicate pred) {
+	base_ptr prev = &head;
+	while (prev->next) {
+		if (pred(static_cast<node_ptr>(prev->next)->data))
+			erase_after(const_iterator(prev));
+		else
+			prev = prev->next;
+	}
+}
+
+template<class T, class Alloc>
+template<class BinaryPredicate>
+void slist<T, Alloc>::unique(BinaryPredicate binary_pred) {
+	base_ptr first = head.next;
+	if (!first)
+		return;
+	while (first->next) {
+		if (binary_pred(static_cast<node_ptr>(first)->data, static_cast<node_ptr>(first->next)->data))
+			erase_after(const_iterator(first));
+		else
+			first = first->next;
+	}
+}
+
+// slistϲһslist, ȵԪ*thisǰ
+template<class T, class Alloc>
+template<class StrictWeakOrdering>
+void slist<T, Alloc>::merge(slist& other, StrictWeakOrdering comp) {
+	if (this == &other)
+		return;
+	base_ptr prev = &head;
+	base_ptr cur2 = other.head.next;
+	while (prev->next && cur2) {
+		if (comp(static_cast<node_ptr>(cur2)->data, static_cast<node_ptr>(prev->next)->data)) {
+			base_ptr next2 = cur2->next;
+			cur2->next = prev->next;
+			prev->next = cur2;
+			cur2 = next2;
+		}
+		prev = prev->next;
+	}
+	if (cur2)
+		prev->next = cur2;
+	other.head.next = nullptr;
+	len += other.len;
+	other.len = 0;
+}
+
+template<class T, class Alloc>
+void slist<T, Alloc>::reverse() {
+	base_ptr result = nullptr;
+	base_ptr cur = head.next;
+	while (cur) {
+		base_ptr next = cur->next;
+		cur->next = result;
+		result = cur;
+		cur = next;
+	}
+	head.next = result;
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// nvalue, 
+template<class T, class Alloc>
+typename slist<T, Alloc>::iterator
+slist<T, Alloc>::fill_insert_after(const_iterator position, size_type n, const value_type& value) {
+	return chain_insert_after(position, n, [&]() -> const value_type& { return value; });
+}
+
+// Ȳ֪Ԫظ, 㴮һ, һνӵposition֮
+// ʱѾĽ, slistֲ
+template<class T, class Alloc>
+template<class InputIterator>
+typename slist<T, Alloc>::iterator
+slist<T, Alloc>::range_insert_after_aux(const_iterator position, InputIterator first, InputIterator last,
+	input_iterator_tag) {
+	if (first == last)
+		return iterator(position.node);
+	node_ptr head_node = create_node(*first);
+	node_ptr tail = head_node;
+	size_type count = 1;
+	try {
+		for (++first; first != last; ++first, ++count) {
+			node_ptr p = create_node(*first);
+			tail->next = p;
+			tail = p;
+		}
+	}
+	catch (...) {
+		destroy_chain(head_node);
+		throw;
+	}
+	return link_chain_after(position, head_node, tail, count);
+}
+
+// ǰԪظ, fill_insert_afterһ
+template<class T, class Alloc>
+template<class ForwardIterator>
+typename slist<T, Alloc>::iterator
+slist<T, Alloc>::range_insert_after_aux(const_iterator position, ForwardIterator first, ForwardIterator last,
+	forward_iterator_tag) {
+	size_type n = static_cast<size_type>(mystl::distance(first, last));
+	return chain_insert_after(position, n, [&]() -> decltype(*first) {
+		decltype(*first) value = *first;
+		++first;
+		return value;
+	});
+}
+
+// list::chain_insertһ, allocate_chainÿSLIST_CHAIN_NODESĿռ,
+// ι첢һ, һνӵposition֮
+// next_value()θÿĳֵ
+// ʱѾĽ㲢ȫռ, slistֲ
+template<class T, class Alloc>
+template<class ValueSource>
+typename slist<T, Alloc>::iterator
+slist<T, Alloc>::chain_insert_after(const_iterator position, size_type n, ValueSource next_value) {
+	if (0 == n)
+		return iterator(position.node);
+	void* rest = nullptr;
+	node_ptr first = nullptr;
+	node_ptr last = nullptr;
+	node_ptr p = nullptr;
+	try {
+		for (size_type count = 0; count < n; ++count) {
+			p = nullptr;
+			if (nullptr == rest)
+				rest = node_allocator::allocate_chain(mystl::min(n - count, static_cast<size_type>(SLIST_CHAIN_NODES)));
+			p = static_cast<node_ptr>(rest);
+			rest = *static_cast<void**>(rest);
+			mystl::construct(&p->data, next_value());
+			p->next = nullptr;
+			if (nullptr == first)
+				first = p;
+			else
+				last->next = p;
+			last = p;
+		}
+	}
+	catch (...) {
+		destroy_chain(first);
+		if (p != nullptr)
+			node_allocator::deallocate(p, 1);
+		put_nodes(rest);
+		throw;
+	}
+	return link_chain_after(position, first, last, n);
+}
+
+// һfirstlastnӵposition֮, ָlastĵ
+template<class T, class Alloc>
+typename slist<T, Alloc>::iterator
+slist<T, Alloc>::link_chain_after(const_iterator position, node_ptr first, node_ptr last, size_type n) {
+	last->next = position.node->next;
+	position.node->next = first;
+	len += n;
+	return iterator(last);
+}
+
+// һûнslistĽ, һnextΪnullptr
+template<class T, class Alloc>
+void slist<T, Alloc>::destroy_chain(base_ptr first) {
+	while (first) {
+		base_ptr next = first->next;
+		destroy_node(static_cast<node_ptr>(first));
+		first = next;
+	}
+}
+
+// ѽָռһĻ, stable_sort֮˳
+// ȽϺ׳쳣ʱslistûиĶ; ʱfalse
+template<class T, class Alloc>
+template<class StrictWeakOrdering>
+bool slist<T, Alloc>::pointer_sort(StrictWeakOrdering comp) {
+	temporary_buffer<node_ptr*, node_ptr> buf(static_cast<ptrdiff_t>(len));
+	if (buf.size() < static_cast<ptrdiff_t>(len))
+		return false;
+	node_ptr* nodes = buf.begin();
+	base_ptr cur = head.next;
+	for (size_type i = 0; i < len; ++i, cur = cur->next)
+		nodes[i] = static_cast<node_ptr>(cur);
+	mystl::stable_sort(nodes, nodes + len, slist_node_compare<T, StrictWeakOrdering>(comp));
+	base_ptr prev = &head;
+	for (size_type i = 0; i < len; ++i) {
+		prev->next = nodes[i];
+		prev = nodes[i];
+	}
+	prev->next = nullptr;
+	return true;
+}
+
+// ҪռĹ鲢, list::merge_sortͬ
+// ʱslistֻ֮splice_aftertakeƶ, 
+template<class T, class Alloc>
+template<class StrictWeakOrdering>
+void slist<T, Alloc>::merge_sort(StrictWeakOrdering comp) {
+	slist<T, Alloc> carry(get_allocator());
+	slist<T, Alloc> counter[64];
+	int fill = 0;
+	while (!empty()) {
+		carry.splice_after(carry.before_begin(), *this, before_begin());
+		int i = 0;
+		while (i < fill && !counter[i].empty()) {
+			counter[i].merge(carry, comp);
+			carry.take(counter[i++]);
+		}
+		counter[i].take(carry);
+		if (i == fill)
+			++fill;
+	}
+	for (int i = 1; i < fill; ++i)
+		counter[i].merge(counter[i - 1], comp);
+	take(counter[fill - 1]);
+}
+
+//-----------------------------------------------ú(slistԱ)----------------------------------------------------
+template<class T, class Alloc>
+bool operator==(const slist<T, Alloc>& lhs, const slist<T, Alloc>& rhs) {
+	return lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class T, class Alloc>
+bool operator!=(const slist<T, Alloc>& lhs, const slist<T, Alloc>& rhs) {
+	return !(lhs == rhs);
+}
+
+template<class T, class Alloc>
+bool operator<(const slist<T, Alloc>& lhs, const slist<T, Alloc>& rhs) {
+	return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<class T, class Alloc>
+bool operator>(const slist<T, Alloc>& lhs, const slist<T, Alloc>& rhs) {
+	return rhs < lhs;
+}
+
+template<class T, class Alloc>
+bool operator<=(const slist<T, Alloc>& lhs, const slist<T, Alloc>& rhs) {
+	return !(rhs < lhs);
+}
+
+template<class T, class Alloc>
+bool operator>=(const slist<T, Alloc>& lhs, const slist<T, Alloc>& rhs) {
+	return !(lhs < rhs);
+}
+
+template<class T, class Alloc>
+void swap(slist<T, Alloc>& lhs, slist<T, Alloc>& rhs) {
+	lhs.swap(rhs);
+}
+
+}	// mystl
+
+#endif
@@ -0,0 +1,174 @@
+#ifndef MYSTL_SLIST_TEST_H
+#define MYSTL_SLIST_TEST_H
+
+#include "test.h"
+#include "../MySTL/slist.h"
+#include "../MySTL/list.h"
+#include <iostream>
+#include <string>
+#include <forward_list>
+
+namespace mystl {
+namespace slist_test {
+
+// ͷcountԪ, ٴͷβһ
+#define SLIST_PUSH_FRONT_DO_TEST(con, count) do {							\
+	con l;																	\
+	clock_t start, end;														\
+	size_t sum = 0;															\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++)										\
+		l.push_front(static_cast<int>(i));									\
+	for (auto it = l.begin(); it != l.end(); ++it)							\
+		sum += *it;															\
+	end = clock();															\
+	if (0 == sum)															\
+		std::cout << "wrong sum";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+// countԪصϷɾͷԪٲ뵽ͷ, ڷзպ͸
+#define SLIST_CHURN_DO_TEST(con, count) do {								\
+	con l;																	\
+	for (size_t i = 0; i < count; i++)										\
+		l.push_front(static_cast<int>(i));									\
+	clock_t start, end;														\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++) {									\
+		l.pop_front();														\
+		l.push_front(static_cast<int>(i));									\
+	}																		\
+	end = clock();															\
+	if (l.empty())															\
+		std::cout << "wrong size";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define SLIST_TEST(TEST, len1, len2, len3) do {								\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|  std::forward_list  |";									\
+	TEST(std::forward_list<int>, len1);										\
+	TEST(std::forward_list<int>, len2);										\
+	TEST(std::forward_list<int>, len3);										\
+	std::cout << "\n|     mystl::list     |";								\
+	TEST(mystl::list<int>, len1);											\
+	TEST(mystl::list<int>, len2);											\
+	TEST(mystl::list<int>, len3);											\
+	std::cout << "\n|     mystl::slist    |";								\
+	TEST(mystl::slist<int>, len1);											\
+	TEST(mystl::slist<int>, len2);											\
+	TEST(mystl::slist<int>, len3);											\
+	std::cout << "\n";														\
+} while(0)
+
+void slist_test() {
+	std::cout << "[===============================================================]\n";
+	std::cout << "[----------------- Run container test : slist ------------------]\n";
+	std::cout << "[-------------------------- API test ---------------------------]\n";
+
+	int test[] = { 1, 2, 3, 4, 5 };
+	mystl::slist<int> s1;
+	mystl::slist<int> s2(5);
+	mystl::slist<int> s3(5, 1);
+	mystl::slist<int> s4(test, test + 5);
+	mystl::slist<int> s5(s2);
+	mystl::slist<int> s6(std::move(s2));
+	mystl::slist<int> s7{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	mystl::slist<int> s8, s9, s10;
+	s8 = s3;
+	s9 = std::move(s3);
+	s10 = { 5, 1, 3, 2, 6, 8, 7, 9, 3, 5, 1 };
+
+	FUN_AFTER(s1, s1.assign(8, 8));
+	FUN_AFTER(s1, s1.assign(test, test + 5));
+	FUN_AFTER(s1, s1.push_front(0));
+	FUN_AFTER(s1, s1.emplace_front(-1));
+	FUN_AFTER(s1, s1.pop_front());
+	FUN_AFTER(s1, s1.insert_after(s1.begin(), 9));
+	FUN_AFTER(s1, s1.insert_after(s1.before_begin(), 2, 7));
+	FUN_AFTER(s1, s1.insert_after(s1.previous(s1.end()), test, test + 3));
+	FUN_AFTER(s1, s1.emplace_after(s1.begin(), 6));
+	FUN_AFTER(s1, s1.erase_after(s1.begin()));
+	FUN_AFTER(s1, s1.erase_after(s1.begin(), s1.previous(s1.end())));
+	FUN_VALUE(s1.size());
+
+	FUN_AFTER(s1, s1.resize(6, 4));
+	FUN_AFTER(s1, s1.resize(3));
+	FUN_VALUE(s1.size());
+
+	FUN_AFTER(s1, s1.splice_after(s1.before_begin(), s4));
+	FUN_AFTER(s1, s1.splice_after(s1.begin(), s5, s5.before_begin()));
+	FUN_AFTER(s1, s1.splice_after(s1.previous(s1.end()), s7, s7.begin(), s7.previous(s7.end())));
+	FUN_VALUE(s1.size());
+	FUN_VALUE(s4.size());
+	FUN_VALUE(s5.size());
+	FUN_VALUE(s7.size());
+
+	FUN_AFTER(s1, s1.remove(0));
+	FUN_AFTER(s1, s1.remove_if([&](int a) {return a > 6; }));
+	FUN_AFTER(s1, s1.reverse());
+	FUN_AFTER(s1, s1.assign(s10.begin(), s10.end()));
+	FUN_AFTER(s1, s1.sort());
+	FUN_AFTER(s1, s1.unique());
+	FUN_AFTER(s1, s1.merge(s7));
+	FUN_VALUE(s1.size());
+	FUN_VALUE(s7.size());
+	FUN_AFTER(s1, s1.sort(mystl::greater<int>()));
+	FUN_AFTER(s1, s1.swap(s9));
+
+	// sortȶ: ֻȽʮλʱ, ʮλͬԪرԭ˳
+	mystl::slist<int> s11{ 31, 12, 35, 17, 33, 11, 24 };
+	FUN_AFTER(s11, s11.sort([](int a, int b) {return a / 10 < b / 10; }));
+
+	mystl::slist<std::string> ss;
+	ss.push_front(std::string(32, 'a'));
+	FUN_AFTER(ss, ss.emplace_front(3, 'b'));
+	FUN_AFTER(ss, ss.emplace_after(ss.begin(), "c"));
+	mystl::slist<std::string> ss2(ss);
+	FUN_AFTER(ss2, ss2.pop_front());
+
+	FUN_VALUE(*s1.begin());
+	FUN_VALUE(s1.front());
+
+	std::cout << std::boolalpha;
+	FUN_VALUE(s1.empty());
+	FUN_VALUE((s8 == s9));
+	FUN_VALUE((s4 < s1));
+	std::cout << std::noboolalpha;
+
+	FUN_VALUE(s1.size());
+	FUN_VALUE(s1.max_size());
+
+	// Ԫʱּ, ÿSLIST_CHAIN_NODES
+	mystl::slist<int> s12(100, 3);
+	mystl::slist<int> s13(s12.begin(), s12.end());
+	s13.insert_after(s13.before_begin(), 40, 4);
+	FUN_VALUE(s12.size());
+	FUN_VALUE(s13.size());
+	FUN_VALUE(mystl::count(s13.begin(), s13.end(), 4));
+
+	// listĽһָ
+	FUN_VALUE(sizeof(mystl::slist_node<int>));
+	FUN_VALUE(sizeof(mystl::list_node<int>));
+	PASSED;
+
+#if PERFORMANCE_TEST_ON
+	std::cout << "[--------------------- Performance Testing ---------------------]\n";
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "| push_front + travel |";
+	SLIST_TEST(SLIST_PUSH_FRONT_DO_TEST, M(LEN1), M(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|  pop + push_front   |";
+	SLIST_TEST(SLIST_CHURN_DO_TEST, M(LEN1), M(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	PASSED;
+#endif
+	std::cout << "[----------------- End container test : slist ------------------]\n";
+	std::cout << std::endl;
+	std::cout << std::endl;
+}
+
+}	// slist_test
+}	// mystl
+
+#endif
@@ -0,0 +1,823 @@
+#ifndef MYSTL_SMALL_VECTOR_H
+#define MYSTL_SMALL_VECTOR_H
+
+// ļsmall_vector
+// ǰNԪرڶڲĻ, ԪسN֮ռ
+// ӿںvectorͬ, ʺϾʱֻмԪصĳ, ʡÿһεķͻ
+
+#include "vector.h"
+
+namespace mystl {
+
+// small_vector
+template<class T, size_t N, class Alloc = alloc>
+class small_vector : private simple_alloc<T, Alloc> {
+	static_assert(N > 0, "small_vector needs at least one inline element");
+
+public:
+	typedef simple_alloc<T, Alloc>						data_allocator;
+	typedef Alloc										allocator_type;
+
+	// 
+	typedef T											value_type;
+	typedef T*											pointer;
+	typedef const T*									const_pointer;
+	typedef T*											iterator;
+	typedef const T*									const_iterator;
+	typedef T&											reference;
+	typedef const T&									const_reference;
+	typedef size_t										size_type;
+	typedef ptrdiff_t									difference_type;
+	typedef mystl::reverse_iterator<iterator>			reverse_iterator;
+	typedef mystl::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+	// õʹõķ
+	allocator_type get_allocator() const {
+		return data_allocator::resource();
+	}
+
+private:
+	iterator start;				// ǰռͷ
+	iterator finish;			// ǰռβ
+	iterator end_of_storage;	// ǰռ洢β
+	typename std::aligned_storage<sizeof(T), alignof(T)>::type buffer[N];	// ڲ
+
+public:
+	//-----------------------------------------------------졢ƺ---------------------------------------------------
+	small_vector() {
+		reset_inline();
+	}
+
+	explicit small_vector(const Alloc& a) : data_allocator(a) {
+		reset_inline();
+	}
+
+	explicit small_vector(size_type n) {
+		reset_inline();
+		fill_insert(finish, n, T());
+	}
+
+	small_vector(size_type n, const T& value, const Alloc& a = Alloc()) : data_allocator(a) {
+		reset_inline();
+		fill_insert(finish, n, value);
+	}
+
+	template<class InputIterator>
+	small_vector(InputIterator first, InputIterator last, const Alloc& a = Alloc()) : data_allocator(a) {
+		reset_inline();
+		insert(finish, first, last);
+	}
+
+	small_vector(std::initializer_list<value_type> ilist, const Alloc& a = Alloc()) : data_allocator(a) {
+		reset_inline();
+		insert(finish, ilist.begin(), ilist.end());
+	}
+
+	// ķselect_on_container_copy_construction
+	small_vector(const small_vector& rhs)
+		: data_allocator(data_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())) {
+		reset_inline();
+		insert(finish, rhs.begin(), rhs.end());
+	}
+
+	small_vector(small_vector&& rhs) noexcept(is_trivially_relocatable<T>::value ||
+		std::is_nothrow_move_constructible<T>::value);
+
+	small_vector& operator=(const small_vector& rhs);
+
+	small_vector& operator=(small_vector&& rhs);
+
+	small_vector& operator=(std::initializer_list<value_type> ilist) {
+		assign(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+	~small_vector() {
+		mystl::destroy(start, finish);
+		release_storage();
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	iterator begin() {
+		return start;
+	}
+
+	const_iterator begin() const {
+		return start;
+	}
+
+	iterator end() {
+		return finish;
+	}
+
+	const_iterator end() const {
+		return finish;
+	}
+
+	reverse_iterator rbegin() {
+		return reverse_iterator(end());
+	}
+
+	const_reverse_iterator rbegin() const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend() {
+		return reverse_iterator(begin());
+	}
+
+	const_reverse_iterator rend() const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin() const {
+		return begin();
+	}
+
+	const_iterator cend() const {
+		return end();
+	}
+
+	const_reverse_iterator crbegin() const {
+		return rbegin();
+	}
+
+	const_reverse_iterator crend() const {
+		return rend();
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	size_type size() const {
+		return static_cast<size_type>(finish - start);
+	}
+
+	size_type max_size() const {
+		return static_cast<size_type>(-1) / sizeof(T);
+	}
+
+	size_type capacity() const {
+		return static_cast<size_type>(end_of_storage - start);
+	}
+
+	bool empty() const {
+		return start == finish;
+	}
+
+	// ԪǷ񻹱ڲ
+	bool is_inline() const {
+		return start == inline_data();
+	}
+
+	static size_type inline_capacity() {
+		return N;
+	}
+
+	void reserve(size_type n);
+
+	// СԪظͬ, Ԫطŵýڲʱڲ
+	void shrink_to_fit();
+
+	//-----------------------------------------------------Ԫغ---------------------------------------------------------
+	reference operator[](size_type n) {
+		assert(n < size());
+		return *(start + n);
+	}
+
+	const_reference operator[](size_type n) const {
+		assert(n < size());
+		return *(start + n);
+	}
+
+	reference at(size_type n) {
+		if (!(n < size()))
+			throw std::out_of_range("small_vector<T>::at() subscript out of range");
+		return (*this)[n];
+	}
+
+	const_reference at(size_type n) const {
+		if (!(n < size()))
+			throw std::out_of_range("small_vector<T>::at() subscript out of range");
+		return (*this)[n];
+	}
+
+	reference front() {
+		assert(!empty());
+		return *start;
+	}
+
+	const_reference front() const {
+		assert(!empty());
+		return *start;
+	}
+
+	reference back() {
+		assert(!empty());
+		return *(finish - 1);
+	}
+
+	const_reference back() const {
+		assert(!empty());
+		return *(finish - 1);
+	}
+
+	pointer data() {
+		return start;
+	}
+
+	const_pointer data() const {
+		return start;
+	}
+
+	//-------------------------------------------------޸ز----------------------------------------------------------
+	// 1. ֵ
+	void assign(size_type n, const value_type& value) {
+		clear();
+		fill_insert(finish, n, value);
+	}
+
+	// 2. ֵ(ģʽ)
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		assign_dispatch(first, last, Integer());
+	}
+
+	// 3. β˲Ԫ
+	void push_back(const value_type& value) {
+		emplace_back(value);
+	}
+
+	void push_back(value_type&& value) {
+		emplace_back(std::move(value));
+	}
+
+	// 4. βֱӹԪ
+	template<class... Args>
+	void emplace_back(Args&&... args) {
+		if (finish != end_of_storage) {
+			mystl::construct(finish, std::forward<Args>(args)...);
+			++finish;
+		}
+		else {
+			insert_aux(finish, std::forward<Args>(args)...);
+		}
+	}
+
+	// 5. һԪ
+	void pop_back() {
+		assert(!empty());
+		--finish;
+		mystl::destroy(finish);
+	}
+
+	// 6. 뵥Ԫ
+	iterator insert(iterator position, const value_type& value) {
+		return emplace(position, value);
+	}
+
+	iterator insert(iterator position, value_type&& value) {
+		return emplace(position, std::move(value));
+	}
+
+	// 7. ָλֱӹԪ
+	template<class... Args>
+	iterator emplace(iterator position, Args&&... args);
+
+	// 8. Ԫ
+	void insert(iterator position, size_type n, const value_type& value) {
+		fill_insert(position, n, value);
+	}
+
+	// 9. ģ, Ԫ
+	template<class InputIterator>
+	void insert(iterator position, InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		insert_dispatch(position, first, last, Integer());
+	}
+
+	// 10. ɾԪ
+	iterator erase(iterator position) {
+		return erase(position, position + 1);
+	}
+
+	// 11. ɾԪ
+	iterator erase(iterator first, iterator last);
+
+	// 12. ɾԪ, ѾĿռ䱣
+	void clear() {
+		mystl::destroy(start, finish);
+		finish = start;
+	}
+
+	// 13. С, ֵ
+	void resize(size_type n, const value_type& value) {
+		if (n < size())
+			erase(start + n, finish);
+		else
+			fill_insert(finish, n - size(), value);
+	}
+
+	// 14. С
+	void resize(size_type n) {
+		resize(n, T());
+	}
+
+	// 15. 
+	void swap(small_vector& rhs);
+
+	// 16. С, ԪĬϳʼ(ƽͲκγʼ)
+	void resize_default_init(size_type n);
+
+	// 17. С, Ԫصֵȷ, ֻƽ
+	void resize_uninitialized(size_type n) {
+		static_assert(std::is_trivial<T>::value, "resize_uninitialized requires a trivial value_type");
+		resize_default_init(n);
+	}
+
+	// 18. β׷[first, last), forward iteratorֻһ鸴
+	template<class InputIterator>
+	void append(InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		append_dispatch(first, last, Integer());
+	}
+
+private:
+	//-------------------------------------------------------------------------------------------------------------------
+	typedef std::integral_constant<bool, is_trivially_relocatable<T>::value>	relocatable;
+
+	iterator inline_data() {
+		return reinterpret_cast<iterator>(buffer);
+	}
+
+	const_iterator inline_data() const {
+		return reinterpret_cast<const_iterator>(buffer);
+	}
+
+	// صڲ, ֮ǰԪرѾٻ߰
+	void reset_inline() {
+		start = finish = inline_data();
+		end_of_storage = start + N;
+	}
+
+	// ͷĿռ, ڲҪͷ
+	void release_storage() {
+		if (!is_inline())
+			data_allocator::deallocate(start, capacity());
+	}
+
+	// ٲnԪʱ, ʹvectorĬϵ
+	size_type grow_size(size_type n) const {
+		return growth_double::next_capacity(size(), n, sizeof(T));
+	}
+
+	// [first, last)ᵽδʼresult, ԭλñδʼĿռ
+	// ֮ǰҪ֤׳쳣: Ԫؿ԰ֽڰ˻ƶ첻׳쳣
+	static iterator relocate(iterator first, iterator last, iterator result) {
+		if (relocatable::value) {
+			mystl::relocate_bytes(first, last, result);
+			return result + (last - first);
+		}
+		iterator res = mystl::uninitialized_move(first, last, result);
+		mystl::destroy(first, last);
+		return res;
+	}
+
+	template<class... Args>
+	void insert_aux(iterator position, Args&&... args);
+
+	void relocate_around(iterator position, iterator new_start, size_type n, size_type new_size);
+
+	void fill_insert(iterator position, size_type n, const value_type& value);
+
+	template<class Integer>
+	void insert_dispatch(iterator position, Integer n, Integer value, true_type) {
+		fill_insert(position, static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	void insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
+		range_insert(position, first, last, iterator_category(first));
+	}
+
+	template<class InputIterator>
+	void range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag);
+
+	template<class ForwardIterator>
+	void range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+	template<class Integer>
+	void assign_dispatch(Integer n, Integer value, true_type) {
+		assign(static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	void assign_dispatch(InputIterator first, InputIterator last, false_type) {
+		assign_aux(first, last, iterator_category(first));
+	}
+
+	template<class InputIterator>
+	void assign_aux(InputIterator first, InputIterator last, input_iterator_tag);
+
+	template<class ForwardIterator>
+	void assign_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+	template<class Integer>
+	void append_dispatch(Integer n, Integer value, true_type) {
+		fill_insert(finish, static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	void append_dispatch(InputIterator first, InputIterator last, false_type) {
+		append_aux(first, last, iterator_category(first));
+	}
+
+	template<class InputIterator>
+	void append_aux(InputIterator first, InputIterator last, input_iterator_tag);
+
+	template<class ForwardIterator>
+	void append_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
+	// rhsаԪ, rhsĿռ䲻
+	void move_elements_from(small_vector& rhs);
+};
+
+//--------------------------------------------------졢ƺ----------------------------------------------------------
+// ƶ캯
+// rhsԪڶʱֱӽӹܿռ, ڲʱֻܰԪذ
+template<class T, size_t N, class Alloc>
+small_vector<T, N, Alloc>::small_vector(small_vector&& rhs) noexcept(is_trivially_relocatable<T>::value ||
+	std::is_nothrow_move_constructible<T>::value) : data_allocator(rhs.get_allocator()) {
+	reset_inline();
+	if (rhs.is_inline()) {
+		finish = relocate(rhs.start, rhs.finish, start);
+		rhs.finish = rhs.start;
+	}
+	else {
+		start = rhs.start;
+		finish = rhs.finish;
+		end_of_storage = rhs.end_of_storage;
+		rhs.reset_inline();
+	}
+}
+
+// Ƹֵ
+template<class T, size_t N, class Alloc>
+small_vector<T, N, Alloc>& small_vector<T, N, Alloc>::operator=(const small_vector& rhs) {
+	if (this != &rhs) {
+		// Ҫɲȵķ, þɵķͷſռ
+		if (data_allocator::replaced_on_copy(rhs)) {
+			clear();
+			release_storage();
+			reset_inline();
+		}
+		data_allocator::propagate_copy(rhs);
+		assign(rhs.begin(), rhs.end());
+	}
+	return *this;
+}
+
+// ƶֵ
+// rhsԪڶϲҿԽӹrhsĿռʱֱӽӹ, Ԫ
+template<class T, size_t N, class Alloc>
+small_vector<T, N, Alloc>& small_vector<T, N, Alloc>::operator=(small_vector&& rhs) {
+	if (this == &rhs)
+		return *this;
+	clear();
+	if (!rhs.is_inline() && (data_allocator::traits::propagate_on_container_move_assignment::value ||
+		data_allocator::same_resource(rhs))) {
+		release_storage();
+		data_allocator::propagate_move(rhs);
+		start = rhs.start;
+		finish = rhs.finish;
+		end_of_storage = rhs.end_of_storage;
+		rhs.reset_inline();
+	}
+	else {
+		move_elements_from(rhs);
+	}
+	return *this;
+}
+
+//--------------------------------------------------޸ز--------------------------------------------------------------
+// Ԥռ亯, ֻеnڵǰʱŻ·
+// ѾڶϲԪؿ԰ֽڰʱʹreallocate
+template<class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::reserve(size_type n) {
+	if (n <= capacity())
+		return;
+	if (relocatable::value && !is_inline()) {
+		size_type old_size = size();
+		start = data_allocator::reallocate(start, capacity(), n);
+		finish = start + old_size;
+		end_of_storage = start + n;
+	}
+	else {
+		relocate_around(finish, data_allocator::allocate(n), 0, n);
+	}
+}
+
+// Сsize()
+// ԪطŵýڲʱڲͷŶϵĿռ, vector::shrink_to_fitͬ
+// ʱԭֲ
+template<class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::shrink_to_fit() {
+	if (is_inline() || finish == end_of_storage)
+		return;
+	if (size() <= N) {
+		iterator new_finish = mystl::relocate_around(start, finish, finish, inline_data(), 0);
+		data_allocator::deallocate(start, capacity());
+		start = inline_data();
+		finish = new_finish;
+		end_of_storage = start + N;
+	}
+	else if (relocatable::value) {
+		size_type old_size = size();
+		start = data_allocator::reallocate(start, capacity(), old_size);
+		finish = end_of_storage = start + old_size;
+	}
+	else {
+		relocate_around(finish, data_allocator::allocate(size()), 0, size());
+	}
+}
+
+// С, ԪĬϳʼ
+// ƽֻƶfinish, ĬϹ, ʱѾԪ
+template<class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::resize_default_init(size_type n) {
+	if (n <= size()) {
+		erase(start + n, finish);
+		return;
+	}
+	if (n > capacity())
+		reserve(grow_size(n - size()));
+	iterator new_finish = start + n;
+	if (std::is_trivially_default_constructible<T>::value) {
+		finish = new_finish;
+		return;
+	}
+	iterator cur = finish;
+	try {
+		for (; cur != new_finish; ++cur)
+			::new (static_cast<void*>(cur)) T;
+	}
+	catch (...) {
+		mystl::destroy(finish, cur);
+		throw;
+	}
+	finish = new_finish;
+}
+
+// ָλֱӹԪ
+template<class T, size_t N, class Alloc>
+template<class... Args>
+typename small_vector<T, N, Alloc>::iterator small_vector<T, N, Alloc>::emplace(iterator position, Args&&... args) {
+	size_type n = position - start;
+	if (finish != end_of_storage && position == finish) {
+		mystl::construct(finish, std::forward<Args>(args)...);
+		++finish;
+	}
+	else {
+		insert_aux(position, std::forward<Args>(args)...);
+	}
+	return start + n;
+}
+
+// ɾԪ
+template<class T, size_t N, class Alloc>
+typename small_vector<T, N, Alloc>::iterator small_vector<T, N, Alloc>::erase(iterator first, iterator last) {
+	mystl::erase_in_place(first, last, finish);
+	return first;
+}
+
+// 
+// Ԫضڶʱָֻ, Ԫ, Ԫذᵽһ
+// ڶ·, ԱԼĿռ
+template<class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::swap(small_vector& rhs) {
+	if (this == &rhs)
+		return;
+	if (!is_inline() && !rhs.is_inline()) {
+		data_allocator::propagate_swap(rhs);
+		mystl::swap(start, rhs.start);
+		mystl::swap(finish, rhs.finish);
+		mystl::swap(end_of_storage, rhs.end_of_storage);
+		return;
+	}
+	small_vector& shorter = size() < rhs.size() ? *this : rhs;
+	small_vector& longer = size() < rhs.size() ? rhs : *this;
+	size_type n = shorter.size();
+	shorter.reserve(longer.size());
+	for (size_type i = 0; i < n; i++)
+		mystl::swap(shorter.start[i], longer.start[i]);
+	shorter.finish = mystl::uninitialized_move(longer.start + n, longer.finish, shorter.finish);
+	longer.erase(longer.start + n, longer.finish);
+}
+
+//------------------------------------------------------------------------------------------------------------
+// 뵥Ԫصĸ
+// argsеԪ, ƶԪ֮ǰȹԪ
+template<class T, size_t N, class Alloc>
+template<class... Args>
+void small_vector<T, N, Alloc>::insert_aux(iterator position, Args&&... args) {
+	// ǰпռ, Ԫغһλ
+	if (finish != end_of_storage) {
+		mystl::emplace_in_place(position, finish, std::forward<Args>(args)...);
+	}
+	// Ѿڶ, β԰ֽڰ˵Ԫʱʹreallocate
+	else if (position == finish && relocatable::value && !is_inline()) {
+		value_type x(std::forward<Args>(args)...);
+		size_type old_size = size();
+		size_type new_size = grow_size(1);
+		start = data_allocator::reallocate(start, old_size, new_size);
+		finish = start + old_size;
+		end_of_storage = start + new_size;
+		mystl::construct(finish, std::move(x));
+		++finish;
+	}
+	// û, ¿ռйԪٰԭԪذȥ
+	else {
+		size_type new_size = grow_size(1);
+		iterator new_start = data_allocator::allocate(new_size);
+		try {
+			mystl::construct(new_start + (position - start), std::forward<Args>(args)...);
+		}
+		catch (...) {
+			data_allocator::deallocate(new_start, new_size);
+			throw;
+		}
+		relocate_around(position, new_start, 1, new_size);
+	}
+}
+
+// ʱԪ, vector::relocate_aroundͬ, ֻԭĿռڲʱҪͷ
+template<class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::relocate_around(iterator position, iterator new_start, size_type n, size_type new_size) {
+	iterator new_finish;
+	try {
+		new_finish = mystl::relocate_around(start, position, finish, new_start, n);
+	}
+	catch (...) {
+		data_allocator::deallocate(new_start, new_size);
+		throw;
+	}
+	release_storage();
+	start = new_start;
+	finish = new_finish;
+	end_of_storage = start + new_size;
+}
+
+// ָλònԪ
+template<class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::fill_insert(iterator position, size_type n, const value_type& value) {
+	if (0 == n)
+		return;
+	if (static_cast<size_type>(end_of_storage - finish) >= n) {
+		mystl::fill_insert_in_place(position, finish, n, value);
+	}
+	else {
+		size_type new_size = grow_size(n);
+		iterator new_start = data_allocator::allocate(new_size);
+		try {
+			mystl::uninitialized_fill_n(new_start + (position - start), n, value);
+		}
+		catch (...) {
+			data_allocator::deallocate(new_start, new_size);
+			throw;
+		}
+		relocate_around(position, new_start, n, new_size);
+	}
+}
+
+// ָλò[first, last), input iterator汾
+template<class T, size_t N, class Alloc>
+template<class InputIterator>
+void small_vector<T, N, Alloc>::range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag) {
+	for (; first != last; ++first) {
+		position = emplace(position, *first);
+		++position;
+	}
+}
+
+// ָλò[first, last), forward iterator汾
+template<class T, size_t N, class Alloc>
+template<class ForwardIterator>
+void small_vector<T, N, Alloc>::range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type n = mystl::distance(first, last);
+	if (0 == n)
+		return;
+	if (static_cast<size_type>(end_of_storage - finish) >= n) {
+		mystl::range_insert_in_place(position, finish, first, last, n);
+	}
+	else {
+		size_type new_size = grow_size(n);
+		iterator new_start = data_allocator::allocate(new_size);
+		try {
+			mystl::uninitialized_copy(first, last, new_start + (position - start));
+		}
+		catch (...) {
+			data_allocator::deallocate(new_start, new_size);
+			throw;
+		}
+		relocate_around(position, new_start, n, new_size);
+	}
+}
+
+template<class T, size_t N, class Alloc>
+template<class InputIterator>
+void small_vector<T, N, Alloc>::assign_aux(InputIterator first, InputIterator last, input_iterator_tag) {
+	iterator cur = start;
+	for (; first != last && cur != finish; ++first, ++cur)
+		*cur = *first;
+	if (first != last)
+		insert(finish, first, last);
+	else
+		erase(cur, finish);
+}
+
+template<class T, size_t N, class Alloc>
+template<class ForwardIterator>
+void small_vector<T, N, Alloc>::assign_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type len = mystl::distance(first, last);
+	if (len > capacity()) {
+		clear();
+		insert(finish, first, last);
+	}
+	else if (size() >= len) {
+		iterator new_finish = mystl::copy(first, last, start);
+		mystl::destroy(new_finish, finish);
+		finish = new_finish;
+	}
+	else {
+		ForwardIterator mid = first;
+		mystl::advance(mid, size());
+		mystl::copy(first, mid, start);
+		finish = mystl::uninitialized_copy(mid, last, finish);
+	}
+}
+
+// β׷[first, last), input iterator汾
+template<class T, size_t N, class Alloc>
+template<class InputIterator>
+void small_vector<T, N, Alloc>::append_aux(InputIterator first, InputIterator last, input_iterator_tag) {
+	for (; first != last; ++first)
+		emplace_back(*first);
+}
+
+// β׷[first, last), forward iterator汾
+// Ȱһ, ٰθƵβδʼĿռ
+template<class T, size_t N, class Alloc>
+template<class ForwardIterator>
+void small_vector<T, N, Alloc>::append_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type n = mystl::distance(first, last);
+	if (n > static_cast<size_type>(end_of_storage - finish))
+		reserve(grow_size(n));
+	finish = mystl::uninitialized_copy(first, last, finish);
+}
+
+// ʱƶֵ, ԼrhsԪڲʱʹ
+template<class T, size_t N, class Alloc>
+void small_vector<T, N, Alloc>::move_elements_from(small_vector& rhs) {
+	reserve(rhs.size());
+	finish = mystl::uninitialized_move(rhs.start, rhs.finish, start);
+	rhs.clear();
+}
+
+//--------------------------------------------------ú(small_vector)----------------------------------------------------------
+template<class T, size_t N, class Alloc>
+inline bool operator==(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+	return (lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin()));
+}
+
+template<class T, size_t N, class Alloc>
+inline bool operator!=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+	return !(lhs == rhs);
+}
+
+template<class T, size_t N, class Alloc>
+inline bool operator<(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+	return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<class T, size_t N, class Alloc>
+inline bool operator>=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+	return !(lhs < rhs);
+}
+
+template<class T, size_t N, class Alloc>
+inline bool operator>(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+	return rhs < lhs;
+}
+
+template<class T, size_t N, class Alloc>
+inline bool operator<=(const small_vector<T, N, Alloc>& lhs, const small_vector<T, N, Alloc>& rhs) {
+	return !(rhs < lhs);
+}
+
+template<class T, size_t N, class Alloc>
+inline void swap(small_vector<T, N, Alloc>& lhs, small_vector<T, N, Alloc>& rhs) {
+	lhs.swap(rhs);
+}
+
+}	// mystl
+
+#endif
@@ -0,0 +1,187 @@
+#ifndef MYSTL_SMALL_VECTOR_TEST_H
+#define MYSTL_SMALL_VECTOR_TEST_H
+
+#include "test.h"
+#include "../MySTL/vector.h"
+#include "../MySTL/small_vector.h"
+#include <iostream>
+#include <string>
+#include <memory>
+
+namespace mystl {
+namespace small_vector_test {
+
+// countֻ4ԪصС
+// vectorÿҪͷһοռ, small_vectorԪطڶڲ
+#define SMALL_VECTOR_DO_TEST(con, count) do {								\
+	clock_t start, end;														\
+	size_t sum = 0;															\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++) {									\
+		con v;																\
+		for (int j = 0; j < 4; j++)											\
+			v.push_back(j);													\
+		sum += v.size();													\
+	}																		\
+	end = clock();															\
+	if (sum != 4 * count)													\
+		std::cout << "wrong size";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define SMALL_VECTOR_TEST(len1, len2, len3) do {							\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|         std         |";									\
+	SMALL_VECTOR_DO_TEST(std::vector<int>, len1);							\
+	SMALL_VECTOR_DO_TEST(std::vector<int>, len2);							\
+	SMALL_VECTOR_DO_TEST(std::vector<int>, len3);							\
+	std::cout << "\n|        vector       |";								\
+	SMALL_VECTOR_DO_TEST(mystl::vector<int>, len1);							\
+	SMALL_VECTOR_DO_TEST(mystl::vector<int>, len2);							\
+	SMALL_VECTOR_DO_TEST(mystl::vector<int>, len3);							\
+	std::cout << "\n|     small_vector    |";								\
+	SMALL_VECTOR_DO_TEST(SMALL_VECTOR_INT, len1);							\
+	SMALL_VECTOR_DO_TEST(SMALL_VECTOR_INT, len2);							\
+	SMALL_VECTOR_DO_TEST(SMALL_VECTOR_INT, len3);							\
+	std::cout << "\n";														\
+} while(0)
+
+typedef mystl::small_vector<int, 8> SMALL_VECTOR_INT;
+
+void small_vector_test() {
+	std::cout << "[===============================================================]\n";
+	std::cout << "[-------------- Run container test : small_vector --------------]\n";
+	std::cout << "[-------------------------- API test ---------------------------]\n";
+
+	int test[] = { 1, 2, 3, 4, 5 };
+	small_vector<int, 8> v1;
+	small_vector<int, 8> v2(10);
+	small_vector<int, 8> v3(10, 1);
+	small_vector<int, 8> v4(test, test + 5);
+	small_vector<int, 8> v5(v2);
+	small_vector<int, 8> v6(std::move(v2));
+	small_vector<int, 8> v7{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	small_vector<int, 8> v8, v9, v10;
+	v8 = v3;
+	v9 = std::move(v3);
+	v10 = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	FUN_AFTER(v1, v1.assign(8, 8));
+	FUN_AFTER(v1, v1.assign(test, test + 5));
+	FUN_AFTER(v1, v1.emplace(v1.begin(), 0));
+	FUN_AFTER(v1, v1.emplace_back(6));
+	FUN_AFTER(v1, v1.push_back(6));
+	FUN_AFTER(v1, v1.insert(v1.end(), 7));
+	FUN_AFTER(v1, v1.insert(v1.begin() + 3, 2, 3));
+	FUN_AFTER(v1, v1.insert(v1.begin(), test, test + 5));
+	FUN_AFTER(v1, v1.pop_back());
+	FUN_AFTER(v1, v1.erase(v1.begin()));
+	FUN_AFTER(v1, v1.erase(v1.begin(), v1.begin() + 2));
+	FUN_AFTER(v1, v1.swap(v4));
+
+	FUN_VALUE(*v1.begin());
+	FUN_VALUE(*(v1.end() - 1));
+	FUN_VALUE(*v1.rbegin());
+	FUN_VALUE(*(v1.rend() - 1));
+	FUN_VALUE(v1.front());
+	FUN_VALUE(v1.back());
+	FUN_VALUE(v1[0]);
+	FUN_VALUE(v1.at(1));
+
+	std::cout << std::boolalpha;
+	FUN_VALUE(v1.empty());
+	FUN_VALUE(v1.is_inline());
+	FUN_VALUE((small_vector<int, 8>(test, test + 5).is_inline()));
+	std::cout << std::noboolalpha;
+
+	FUN_VALUE(v1.size());
+	FUN_VALUE(v1.capacity());
+
+	// ڲ֮ռ
+	FUN_AFTER(v1, v1.insert(v1.end(), 4, 9));
+	std::cout << std::boolalpha;
+	FUN_VALUE(v1.is_inline());
+	std::cout << std::noboolalpha;
+	FUN_VALUE(v1.size());
+	FUN_VALUE(v1.capacity());
+
+	FUN_AFTER(v1, v1.resize(3));
+	FUN_VALUE(v1.size());
+	FUN_VALUE(v1.capacity());
+
+	// Ԫطŵýڲʱshrink_to_fitڲ
+	FUN_AFTER(v1, v1.shrink_to_fit());
+	std::cout << std::boolalpha;
+	FUN_VALUE(v1.is_inline());
+	std::cout << std::noboolalpha;
+	FUN_VALUE(v1.capacity());
+
+	FUN_AFTER(v1, v1.clear());
+	FUN_VALUE(v1.size());
+	FUN_VALUE(v1.capacity());
+
+	// Ԫزʼresize, Լһݵappend
+	small_vector<char, 4> vc;
+	vc.resize_uninitialized(4);
+	vc[0] = 'a', vc[1] = 'b', vc[2] = 'c', vc[3] = 'd';
+	const char* chars = "efgh";
+	FUN_AFTER(vc, vc.append(chars, chars + 4));
+	FUN_AFTER(vc, vc.resize_default_init(3));
+	FUN_AFTER(vc, vc.shrink_to_fit());
+	std::cout << std::boolalpha;
+	FUN_VALUE(vc.is_inline());
+	std::cout << std::noboolalpha;
+	FUN_AFTER(v1, v1.append(test, test + 5));
+	FUN_AFTER(v1, v1.append(2, 8));
+	FUN_VALUE(v1.capacity());
+
+	// ԪڲʱƶֻԪ
+	small_vector<std::unique_ptr<int>, 4> vp;
+	for (int i = 0; i < 3; i++)
+		vp.emplace_back(new int(i));
+	small_vector<std::unique_ptr<int>, 4> vp2(std::move(vp));
+	vp2.emplace(vp2.begin() + 1, new int(10));
+	vp2.emplace_back(new int(20));
+	vp.swap(vp2);
+	std::cout << " vp :";
+	for (auto& p : vp)
+		std::cout << " " << *p;
+	std::cout << "\n";
+	FUN_VALUE(vp2.size());
+
+	small_vector<std::string, 2> vs;
+	vs.push_back(std::string(32, 'a'));
+	FUN_AFTER(vs, vs.emplace_back(3, 'b'));
+	FUN_AFTER(vs, vs.emplace(vs.begin(), "c"));
+	small_vector<std::string, 2> vs2(std::move(vs));
+	FUN_VALUE(vs.size());
+	FUN_VALUE(vs2.size());
+	FUN_AFTER(vs2, vs2.reserve(16));
+	FUN_AFTER(vs2, vs2.shrink_to_fit());
+	FUN_VALUE(vs2.capacity());
+	FUN_AFTER(vs2, vs2.pop_back());
+	FUN_AFTER(vs2, vs2.shrink_to_fit());
+	std::cout << std::boolalpha;
+	FUN_VALUE(vs2.is_inline());
+	std::cout << std::noboolalpha;
+
+	PASSED;
+
+#if PERFORMANCE_TEST_ON
+	std::cout << "[--------------------- Performance Testing ---------------------]\n";
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "| 4 elements x count  |";
+	SMALL_VECTOR_TEST(M(LEN2), L(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	PASSED;
+#endif
+	std::cout << "[-------------- End container test : small_vector --------------]\n";
+	std::cout << std::endl;
+	std::cout << std::endl;
+
+}
+
+}	// small_vector_test
+}	// mystl
+
+#endif
@@ -1,7 +1,13 @@
 #include "test.h"
 #include "vector_test.h"
+#include "small_vector_test.h"
+#include "inplace_vector_test.h"
+#include "dynamic_bitset_test.h"
 #include "list_test.h"
+#include "slist_test.h"
+#include "unrolled_list_test.h"
 #include "deque_test.h"
+#include "ring_buffer_test.h"
 #include "queue_test.h"
 #include "stack_test.h"
 #include "set_test.h"
@@ -11,6 +17,7 @@
 #include "unordered_set_test.h"
 #include "algorithm_test.h"
 #include "algorithm_performance_test.h"
+#include "alloc_test.h"
 
 
 using namespace mystl;
@@ -22,9 +29,16 @@ int main() {
 
 	test::algorithm_performance_test::algorithm_performance_test();
 
+	alloc_test::alloc_test();
 	vector_test::vector_test();
+	small_vector_test::small_vector_test();
+	inplace_vector_test::inplace_vector_test();
+	dynamic_bitset_test::dynamic_bitset_test();
 	list_test::list_test();
+	slist_test::slist_test();
+	unrolled_list_test::unrolled_list_test();
 	deque_test::deque_test();
+	ring_buffer_test::ring_buffer_test();
 	queue_test::queue_test();
 	queue_test::priority_queue_test();
 	stack_test::stack_test();
@@ -654,6 +654,37 @@ void TESTCASE_NAME(testcase_name)::Run()
 	MAP_INSERT_DO_TEST(mystl, con, len3);									\
 } while(0)
 
+// countֵ֮, ֻͳƱʱ
+// ֵiһõ, ͬҲ˳Ǵҵ
+#define MAP_ITERATE_DO_TEST(Namespace, con, count) do {						\
+	Namespace::con<int, int> c;												\
+	for (size_t i = 0; i < count; i++){										\
+		int k = static_cast<int>(static_cast<unsigned>(i) * 2654435761u);	\
+		c.insert(Namespace::make_pair(k, k));								\
+	}																		\
+	clock_t start, end;														\
+	size_t sum = 0;															\
+	start = clock();														\
+	for (auto it = c.begin(); it != c.end(); ++it)							\
+		sum += static_cast<size_t>(it->second);								\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+	if (sum == 1)															\
+		std::cout << sum;													\
+} while(0)
+
+#define MAP_ITERATE_TEST(con, len1, len2, len3) do {						\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|         std         |";									\
+	MAP_ITERATE_DO_TEST(std, con, len1);									\
+	MAP_ITERATE_DO_TEST(std, con, len2);									\
+	MAP_ITERATE_DO_TEST(std, con, len3);									\
+	std::cout << "\n|        mystl        |";								\
+	MAP_ITERATE_DO_TEST(mystl, con, len1);									\
+	MAP_ITERATE_DO_TEST(mystl, con, len2);									\
+	MAP_ITERATE_DO_TEST(mystl, con, len3);									\
+} while(0)
+
 /*
 #define MAP_EMPLACE_TEST(NameSpace, count) do{								\
 	srand(static_cast<int>(time(0)));										\
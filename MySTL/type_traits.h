@@ -2,6 +2,7 @@
 #define MYSTL_TYPE_TRAITS_H
 
 #include <type_traits>
+#include <memory>		// unique_ptr
 
 namespace mystl {
 
@@ -301,6 +302,17 @@ namespace mystl {
 		typedef true_type		is_POD_type;
 	};
 
+	// ԰ֽڰ˵
+	// ѶֽڸƵλ֮, λϵĶ, Чƶɶͬ
+	// ݡɾʱmemcpy/memmovereallocԪ
+	// ĬֱֻӰֽڸƵ, (ָֻĽṹ)Ҫػģ
+	// ע: ָָ(粿ʵеstd::string)ػ
+	template<class T>
+	struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+	// unique_ptrֻһָ(ĬϵɾûݳԱ)
+	template<class T>
+	struct is_trivially_relocatable<std::unique_ptr<T>> : std::true_type {};
 
 }	// mystl
 
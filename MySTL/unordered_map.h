@@ -65,7 +65,7 @@ public:
 
 	unordered_map(size_type n, hasher hf) : ht(n, hf, key_equal()) {};
 
-	unordered_map(size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {};
+	unordered_map(size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {};
 
 	template<class InputIterator>
 	unordered_map(InputIterator first, InputIterator last) : ht(100, hasher(), key_equal()) {
@@ -83,7 +83,7 @@ public:
 	}
 
 	template<class InputIterator>
-	unordered_map(InputIterator first, InputIterator last, size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {
+	unordered_map(InputIterator first, InputIterator last, size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {
 		ht.insert_unique(first, last);
 	}
 
@@ -99,7 +99,7 @@ public:
 		ht.insert_unique(ilist.begin(), ilist.end());
 	}
 
-	unordered_map(const std::initializer_list<value_type>& ilist, size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {
+	unordered_map(const std::initializer_list<value_type>& ilist, size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {
 		ht.insert_unique(ilist.begin(), ilist.end());
 	}
 
@@ -331,7 +331,7 @@ public:
 
 	unordered_multimap(size_type n, hasher hf) : ht(n, hf, key_equal()) {};
 
-	unordered_multimap(size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {};
+	unordered_multimap(size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {};
 
 	template<class InputIterator>
 	unordered_multimap(InputIterator first, InputIterator last) : ht(100, hasher(), key_equal()) {
@@ -349,7 +349,7 @@ public:
 	}
 
 	template<class InputIterator>
-	unordered_multimap(InputIterator first, InputIterator last, size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {
+	unordered_multimap(InputIterator first, InputIterator last, size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {
 		ht.insert_equal(first, last);
 	}
 
@@ -365,7 +365,7 @@ public:
 		ht.insert_equal(ilist.begin(), ilist.end());
 	}
 
-	unordered_multimap(const std::initializer_list<value_type>& ilist, size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {
+	unordered_multimap(const std::initializer_list<value_type>& ilist, size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {
 		ht.insert_equal(ilist.begin(), ilist.end());
 	}
 
@@ -90,6 +90,14 @@ void unorder_map_test() {
 	MAP_INSERT_TEST(unordered_map, M(LEN1), M(LEN2), M(LEN3));
 #else
 	MAP_INSERT_TEST(unordered_map, XL(LEN1), XL(LEN2), XL(LEN3));
+#endif
+	std::cout << std::endl;
+	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
+	std::cout << "|      iterate        |";
+#if LARGER_TEST_DATA_ON
+	MAP_ITERATE_TEST(unordered_map, XL(LEN1), XL(LEN2), XL(LEN3));
+#else
+	MAP_ITERATE_TEST(unordered_map, M(LEN1), M(LEN2), M(LEN3));
 #endif
 	std::cout << std::endl;
 	std::cout << "|---------------------|-------------|-------------|-------------|" << std::endl;
@@ -54,7 +54,7 @@ public:
 
 	unordered_set(size_type n, hasher hf) : ht(n, hf, key_equal()) {};
 
-	unordered_set(size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {};
+	unordered_set(size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {};
 
 	template<class InputIterator>
 	unordered_set(InputIterator first, InputIterator last) : ht(100, hasher(), key_equal()) {
@@ -72,7 +72,7 @@ public:
 	}
 
 	template<class InputIterator>
-	unordered_set(InputIterator first, InputIterator last, size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {
+	unordered_set(InputIterator first, InputIterator last, size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {
 		ht.insert_unique(first, last);
 	}
 
@@ -88,7 +88,7 @@ public:
 		ht.insert_unique(ilist.begin(), ilist.end());
 	}
 
-	unordered_set(const std::initializer_list<Value>& ilist, size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {
+	unordered_set(const std::initializer_list<Value>& ilist, size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {
 		ht.insert_unique(ilist.begin(), ilist.end());
 	}
 
@@ -288,7 +288,7 @@ public:
 
 	unordered_multiset(size_type n, hasher hf) : ht(n, hf, key_equal()) {};
 
-	unordered_multiset(size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {};
+	unordered_multiset(size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {};
 
 	template<class InputIterator>
 	unordered_multiset(InputIterator first, InputIterator last) : ht(100, hasher(), key_equal()) {
@@ -306,7 +306,7 @@ public:
 	}
 
 	template<class InputIterator>
-	unordered_multiset(InputIterator first, InputIterator last, size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {
+	unordered_multiset(InputIterator first, InputIterator last, size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {
 		ht.insert_equal(first, last);
 	}
 
@@ -322,7 +322,7 @@ public:
 		ht.insert_equal(ilist.begin(), ilist.end());
 	}
 
-	unordered_multiset(const std::initializer_list<Value>& ilist, size_type n, hasher hf, key_equal eql) : ht(n, hf, eql) {
+	unordered_multiset(const std::initializer_list<Value>& ilist, size_type n, hasher hf, key_equal eql, const Alloc& a = Alloc()) : ht(n, hf, eql, a) {
 		ht.insert_equal(ilist.begin(), ilist.end());
 	}
 
@@ -0,0 +1,800 @@
+#ifndef MYSTL_UNROLLED_LIST_H
+#define MYSTL_UNROLLED_LIST_H
+
+// ļunrolled_list
+// չ: ˫ÿ㱣һСԪ, Ĭһ(ͷ)ԼΪ
+// ˳ʱÿֻһλȱʧ, ڵԪ
+// мɾֻƶһڵԪ: ˾ͷֳ, Ԫغͺϲ
+// ɾʹеʧЧ
+
+#include "iterator.h"
+#include "memory.h"
+#include "type_traits.h"
+#include "algorithm.h"
+#include <cstddef>
+#include <cassert>
+#include <type_traits>
+
+namespace mystl {
+
+// ÿɵԪظ
+// NodeSizΪ0ʱʹĬֵ: 㲻128ֽ, 4Ԫ
+template<class T, size_t NodeSiz = 0>
+struct unrolled_list_node_size {
+	static_assert(0 == NodeSiz || NodeSiz >= 2, "unrolled_list node size must be at least 2");
+
+	static constexpr size_t header = 3 * sizeof(void*);
+	static constexpr size_t value = NodeSiz != 0 ? NodeSiz
+		: (sizeof(T) * 4 + header > 128 ? 4 : (128 - header) / sizeof(T));
+};
+
+//-----------------------------------------------unrolled_listĽ---------------------------------------------------------------
+// ͷ: ǰָͽеԪظ, еͷֻнͷ, count0
+struct unrolled_list_node_base {
+	unrolled_list_node_base* prev;
+	unrolled_list_node_base* next;
+	size_t count;
+};
+
+template<class T, size_t N>
+struct unrolled_list_node : public unrolled_list_node_base {
+	typename std::aligned_storage<sizeof(T), alignof(T)>::type storage[N];
+
+	T* elems() {
+		return reinterpret_cast<T*>(storage);
+	}
+};
+
+//-----------------------------------------------unrolled_listĵ---------------------------------------------------------------
+// dequeһ浱ǰԪغڽԪ, ƶָֻӼ
+// end()ָͷ, curfirstlastnullptr
+template<class T, class Ref, class Ptr, size_t NodeSiz>
+struct unrolled_list_iterator : public iterator<bidirectional_iterator_tag, T> {
+	// typedef
+	typedef unrolled_list_iterator<T, T&, T*, NodeSiz>				iterator;
+	typedef unrolled_list_iterator<T, const T&, const T*, NodeSiz>	const_iterator;
+
+	typedef T														value_type;
+	typedef Ptr														pointer;
+	typedef Ref														reference;
+	typedef bidirectional_iterator_tag								iterator_category;
+	typedef size_t													size_type;
+	typedef ptrdiff_t												difference_type;
+
+	typedef unrolled_list_node_base*								base_ptr;
+	typedef unrolled_list_node<T, unrolled_list_node_size<T, NodeSiz>::value>*	node_ptr;
+
+	typedef unrolled_list_iterator									self;
+
+	T* cur;				// ǰԪ
+	T* first;			// еĵһԪ
+	T* last;			// һԪصһλ
+	base_ptr node;		// ڽ
+
+	// 캯
+	unrolled_list_iterator() : cur(nullptr), first(nullptr), last(nullptr), node(nullptr) {};
+
+	// ָn±ΪiԪ
+	unrolled_list_iterator(base_ptr n, size_type i) {
+		set_node(n);
+		cur = first ? first + i : nullptr;
+	}
+
+	unrolled_list_iterator(const iterator& rhs) : cur(rhs.cur), first(rhs.first), last(rhs.last), node(rhs.node) {};
+
+	void set_node(base_ptr n) {
+		node = n;
+		if (n->count) {
+			first = static_cast<node_ptr>(n)->elems();
+			last = first + n->count;
+		}
+		else {
+			first = last = nullptr;
+		}
+	}
+
+	// ڽе±
+	size_type index() const {
+		return static_cast<size_type>(cur - first);
+	}
+
+	// 
+	reference operator*() const {
+		return *cur;
+	}
+
+	pointer operator->() const {
+		return cur;
+	}
+
+	self& operator++() {
+		if (++cur == last) {
+			set_node(node->next);
+			cur = first;
+		}
+		return *this;
+	}
+
+	self operator++(int) {
+		self temp = *this;
+		++*this;
+		return temp;
+	}
+
+	self& operator--() {
+		if (cur == first) {
+			set_node(node->prev);
+			cur = last;
+		}
+		--cur;
+		return *this;
+	}
+
+	self operator--(int) {
+		self temp = *this;
+		--*this;
+		return temp;
+	}
+
+	bool operator==(const self& rhs) const {
+		return cur == rhs.cur;
+	}
+
+	bool operator!=(const self& rhs) const {
+		return cur != rhs.cur;
+	}
+};
+
+//-----------------------------------------------unrolled_list---------------------------------------------------------------
+// unrolled_list
+// ͷֱӷ, ռ; Ԫظ, size()O(1)
+template<class T, class Alloc = alloc, size_t NodeSiz = 0>
+class unrolled_list : private simple_alloc<unrolled_list_node<T, unrolled_list_node_size<T, NodeSiz>::value>, Alloc> {
+public:
+	// ÿԪظ
+	static const size_t node_size = unrolled_list_node_size<T, NodeSiz>::value;
+
+	// ָ
+	typedef unrolled_list_node_base*								base_ptr;
+	typedef unrolled_list_node<T, node_size>*						node_ptr;
+
+	// 
+	typedef Alloc													allocator_type;
+	typedef simple_alloc<unrolled_list_node<T, node_size>, Alloc>	node_allocator;
+
+	// 
+	typedef T														value_type;
+	typedef T*														pointer;
+	typedef const T*												const_pointer;
+	typedef T&														reference;
+	typedef const T&												const_reference;
+	typedef size_t													size_type;
+	typedef ptrdiff_t												difference_type;
+
+	// 
+	typedef unrolled_list_iterator<T, T&, T*, NodeSiz>				iterator;
+	typedef unrolled_list_iterator<T, const T&, const T*, NodeSiz>	const_iterator;
+	typedef mystl::reverse_iterator<iterator>						reverse_iterator;
+	typedef mystl::reverse_iterator<const_iterator>					const_reverse_iterator;
+
+	// õʹõķ
+	allocator_type get_allocator() const {
+		return node_allocator::resource();
+	}
+
+private:
+	unrolled_list_node_base head;	// ͷ, head.nextǵһ, head.prevһ
+	size_type len;					// Ԫظ
+
+public:
+	//-----------------------------------------------------졢ƺ---------------------------------------------------
+	unrolled_list() {
+		init();
+	}
+
+	explicit unrolled_list(const Alloc& a) : node_allocator(a) {
+		init();
+	}
+
+	explicit unrolled_list(size_type n) {
+		init();
+		resize(n);
+	}
+
+	unrolled_list(size_type n, const value_type& value, const Alloc& a = Alloc()) : node_allocator(a) {
+		init();
+		fill_assign(n, value);
+	}
+
+	template<class InputIterator>
+	unrolled_list(InputIterator first, InputIterator last, const Alloc& a = Alloc()) : node_allocator(a) {
+		init();
+		assign(first, last);
+	}
+
+	unrolled_list(std::initializer_list<value_type> ilist, const Alloc& a = Alloc()) : node_allocator(a) {
+		init();
+		assign(ilist.begin(), ilist.end());
+	}
+
+	// ķselect_on_container_copy_construction
+	unrolled_list(const unrolled_list& rhs)
+		: node_allocator(node_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())) {
+		init();
+		assign(rhs.begin(), rhs.end());
+	}
+
+	unrolled_list(const unrolled_list& rhs, const Alloc& a) : node_allocator(a) {
+		init();
+		assign(rhs.begin(), rhs.end());
+	}
+
+	// ƶ캯, ֱӽӹrhsĽ
+	unrolled_list(unrolled_list&& rhs) noexcept : node_allocator(rhs.get_allocator()) {
+		init();
+		take(rhs);
+	}
+
+	unrolled_list& operator=(const unrolled_list& rhs);
+
+	unrolled_list& operator=(unrolled_list&& rhs)
+		noexcept(node_allocator::traits::propagate_on_container_move_assignment::value ||
+			node_allocator::traits::is_always_equal::value);
+
+	unrolled_list& operator=(std::initializer_list<value_type> ilist) {
+		assign(ilist.begin(), ilist.end());
+		return *this;
+	}
+
+	~unrolled_list() {
+		clear();
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	iterator begin() {
+		return iterator(head.next, 0);
+	}
+
+	const_iterator begin() const {
+		return const_iterator(head.next, 0);
+	}
+
+	iterator end() {
+		return iterator(&head, 0);
+	}
+
+	const_iterator end() const {
+		return const_iterator(const_cast<base_ptr>(&head), 0);
+	}
+
+	reverse_iterator rbegin() {
+		return reverse_iterator(end());
+	}
+
+	const_reverse_iterator rbegin() const {
+		return const_reverse_iterator(end());
+	}
+
+	reverse_iterator rend() {
+		return reverse_iterator(begin());
+	}
+
+	const_reverse_iterator rend() const {
+		return const_reverse_iterator(begin());
+	}
+
+	const_iterator cbegin() const {
+		return begin();
+	}
+
+	const_iterator cend() const {
+		return end();
+	}
+
+	const_reverse_iterator crbegin() const {
+		return rbegin();
+	}
+
+	const_reverse_iterator crend() const {
+		return rend();
+	}
+
+	//-----------------------------------------------------غ---------------------------------------------------------
+	bool empty() const {
+		return 0 == len;
+	}
+
+	size_type size() const {
+		return len;
+	}
+
+	size_type max_size() const {
+		return static_cast<size_type>(-1) / sizeof(T);
+	}
+
+	void resize(size_type n, const value_type& value);
+
+	void resize(size_type n) {
+		resize(n, T());
+	}
+
+	//-----------------------------------------------------Ԫغ---------------------------------------------------------
+	reference front() {
+		assert(!empty());
+		return *elems(head.next);
+	}
+
+	const_reference front() const {
+		assert(!empty());
+		return *elems(head.next);
+	}
+
+	reference back() {
+		assert(!empty());
+		return elems(head.prev)[head.prev->count - 1];
+	}
+
+	const_reference back() const {
+		assert(!empty());
+		return elems(head.prev)[head.prev->count - 1];
+	}
+
+	//-------------------------------------------------޸ز----------------------------------------------------------
+	// 1. ֵ
+	void assign(size_type n, const value_type& value) {
+		fill_assign(n, value);
+	}
+
+	// 2. ֵ(ģʽ)
+	template<class InputIterator>
+	void assign(InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		assign_dispatch(first, last, Integer());
+	}
+
+	// 3. β˲Ԫ, һ˾ںһ½, push_backĽ㶼
+	void push_back(const value_type& value) {
+		emplace_back(value);
+	}
+
+	void push_back(value_type&& value) {
+		emplace_back(std::move(value));
+	}
+
+	template<class... Args>
+	reference emplace_back(Args&&... args) {
+		base_ptr n = head.prev;
+		if (n == &head || n->count == node_size)
+			n = link_new_node(head.prev);
+		T* p = elems(n) + n->count;
+		try {
+			mystl::construct(p, std::forward<Args>(args)...);
+		}
+		catch (...) {
+			if (0 == n->count)
+				free_node(n);
+			throw;
+		}
+		++n->count;
+		++len;
+		return *p;
+	}
+
+	// 4. ͷԪ
+	void push_front(const value_type& value) {
+		emplace_front(value);
+	}
+
+	void push_front(value_type&& value) {
+		emplace_front(std::move(value));
+	}
+
+	template<class... Args>
+	reference emplace_front(Args&&... args) {
+		return *emplace(begin(), std::forward<Args>(args)...);
+	}
+
+	// 5. һԪ
+	void pop_back() {
+		assert(!empty());
+		erase(--end());
+	}
+
+	// 6. һԪ
+	void pop_front() {
+		assert(!empty());
+		erase(begin());
+	}
+
+	// 7. position֮ǰԪ, ָԪصĵ
+	iterator insert(iterator position, const value_type& value) {
+		return emplace(position, value);
+	}
+
+	iterator insert(iterator position, value_type&& value) {
+		return emplace(position, std::move(value));
+	}
+
+	void insert(iterator position, size_type n, const value_type& value) {
+		fill_insert(position, n, value);
+	}
+
+	template<class InputIterator>
+	void insert(iterator position, InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		insert_dispatch(position, first, last, Integer());
+	}
+
+	// 8. position֮ǰֱӹԪ
+	template<class... Args>
+	iterator emplace(iterator position, Args&&... args);
+
+	// 9. ɾpositionϵԪ, ָһԪصĵ
+	iterator erase(iterator position);
+
+	// 10. ɾ[first, last)ϵԪ
+	iterator erase(iterator first, iterator last);
+
+	// 11. ɾԪ, ͷн
+	void clear();
+
+	// 12. 
+	void swap(unrolled_list& rhs) {
+		if (this == &rhs)
+			return;
+		node_allocator::propagate_swap(rhs);
+		unrolled_list_node_base temp = head;
+		head = rhs.head;
+		rhs.head = temp;
+		mystl::swap(len, rhs.len);
+		fix_head();
+		rhs.fix_head();
+	}
+
+	// 13. , ڹ۲
+	size_type node_count() const;
+
+private:
+	//-------------------------------------------------------------------------------------------------------------------
+	static T* elems(base_ptr n) {
+		return static_cast<node_ptr>(n)->elems();
+	}
+
+	void init() {
+		head.prev = head.next = &head;
+		head.count = 0;
+		len = 0;
+	}
+
+	// ͷ㱻帴֮, õһһָ
+	void fix_head() {
+		if (0 == len) {
+			head.prev = head.next = &head;
+			return;
+		}
+		head.next->prev = &head;
+		head.prev->next = &head;
+	}
+
+	// *thisΪʱӹotherн, 漰
+	void take(unrolled_list& other) {
+		assert(empty());
+		if (other.empty())
+			return;
+		head = other.head;
+		len = other.len;
+		fix_head();
+		other.init();
+	}
+
+	// һսpos֮
+	base_ptr link_new_node(base_ptr pos) {
+		node_ptr n = node_allocator::allocate(1);
+		n->count = 0;
+		n->prev = pos;
+		n->next = pos->next;
+		pos->next->prev = n;
+		pos->next = n;
+		return n;
+	}
+
+	// һѾûԪصĽȡ²ͷ
+	void free_node(base_ptr n) {
+		n->prev->next = n->next;
+		n->next->prev = n->prev;
+		node_allocator::deallocate(static_cast<node_ptr>(n), 1);
+	}
+
+	void place(base_ptr n, size_type i, value_type&& value);
+
+	base_ptr split(base_ptr n);
+
+	void merge_next(base_ptr n);
+
+	void fill_assign(size_type n, const value_type& value);
+
+	template<class Integer>
+	void assign_dispatch(Integer n, Integer value, true_type) {
+		fill_assign(static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	void assign_dispatch(InputIterator first, InputIterator last, false_type);
+
+	void fill_insert(iterator position, size_type n, const value_type& value);
+
+	template<class Integer>
+	void insert_dispatch(iterator position, Integer n, Integer value, true_type) {
+		fill_insert(position, static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	template<class InputIterator>
+	void insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type);
+};
+
+//--------------------------------------------------졢ƺ------------------------------------------------------
+template<class T, class Alloc, size_t NodeSiz>
+unrolled_list<T, Alloc, NodeSiz>& unrolled_list<T, Alloc, NodeSiz>::operator=(const unrolled_list& rhs) {
+	if (this != &rhs) {
+		// Ҫɲȵķ, þɵķͷн
+		if (node_allocator::replaced_on_copy(rhs))
+			clear();
+		node_allocator::propagate_copy(rhs);
+		assign(rhs.begin(), rhs.end());
+	}
+	return *this;
+}
+
+// ƶʱֱӽӹrhsĽ, ƶԪ
+template<class T, class Alloc, size_t NodeSiz>
+unrolled_list<T, Alloc, NodeSiz>& unrolled_list<T, Alloc, NodeSiz>::operator=(unrolled_list&& rhs)
+	noexcept(node_allocator::traits::propagate_on_container_move_assignment::value ||
+		node_allocator::traits::is_always_equal::value) {
+	if (this == &rhs)
+		return *this;
+	clear();
+	if (node_allocator::traits::propagate_on_container_move_assignment::value || node_allocator::same_resource(rhs)) {
+		node_allocator::propagate_move(rhs);
+		take(rhs);
+	}
+	else {
+		for (iterator it = rhs.begin(); it != rhs.end(); ++it)
+			emplace_back(std::move(*it));
+		rhs.clear();
+	}
+	return *this;
+}
+
+//--------------------------------------------------غ--------------------------------------------------------------
+template<class T, class Alloc, size_t NodeSiz>
+void unrolled_list<T, Alloc, NodeSiz>::resize(size_type n, const value_type& value) {
+	while (len > n)
+		pop_back();
+	while (len < n)
+		emplace_back(value);
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+typename unrolled_list<T, Alloc, NodeSiz>::size_type
+unrolled_list<T, Alloc, NodeSiz>::node_count() const {
+	size_type n = 0;
+	for (const unrolled_list_node_base* p = head.next; p != &head; p = p->next)
+		++n;
+	return n;
+}
+
+//-------------------------------------------------޸ز----------------------------------------------------------
+// λڵĽ㻹пռʱֻƶposition֮Ԫ
+// ȷֳ, ٲ뵽positionڵһ
+// 뵽һĿͷʱ, ǰһ㻹пռͷŵǰһĩβ, ҪƶԪ
+template<class T, class Alloc, size_t NodeSiz>
+template<class... Args>
+typename unrolled_list<T, Alloc, NodeSiz>::iterator
+unrolled_list<T, Alloc, NodeSiz>::emplace(iterator position, Args&&... args) {
+	base_ptr n = position.node;
+	size_type i = position.index();
+	if (0 == i && n->prev != &head && n->prev->count < node_size) {
+		n = n->prev;
+		i = n->count;
+	}
+	else if (n == &head) {
+		emplace_back(std::forward<Args>(args)...);
+		return iterator(head.prev, head.prev->count - 1);
+	}
+	value_type value(std::forward<Args>(args)...);
+	if (n->count == node_size) {
+		base_ptr upper = split(n);
+		if (i > n->count) {
+			i -= n->count;
+			n = upper;
+		}
+	}
+	place(n, i, std::move(value));
+	++len;
+	return iterator(n, i);
+}
+
+// ɾ֮Ϊվͷ; ڽԪغʱϲ
+template<class T, class Alloc, size_t NodeSiz>
+typename unrolled_list<T, Alloc, NodeSiz>::iterator
+unrolled_list<T, Alloc, NodeSiz>::erase(iterator position) {
+	base_ptr n = position.node;
+	size_type i = position.index();
+	T* p = elems(n);
+	mystl::move(p + i + 1, p + n->count, p + i);
+	mystl::destroy(p + n->count - 1);
+	--n->count;
+	--len;
+	if (0 == n->count) {
+		base_ptr next = n->next;
+		free_node(n);
+		return iterator(next, 0);
+	}
+	if (n->next != &head && n->count + n->next->count <= node_size / 2) {
+		merge_next(n);
+	}
+	else if (n->prev != &head && n->prev->count + n->count <= node_size / 2) {
+		base_ptr prev = n->prev;
+		i += prev->count;
+		merge_next(prev);
+		n = prev;
+	}
+	if (i == n->count)
+		return iterator(n->next, 0);
+	return iterator(n, i);
+}
+
+// ϲƶԪ, lastʧЧ, ҪɾԪظ
+template<class T, class Alloc, size_t NodeSiz>
+typename unrolled_list<T, Alloc, NodeSiz>::iterator
+unrolled_list<T, Alloc, NodeSiz>::erase(iterator first, iterator last) {
+	if (first == begin() && last == end()) {
+		clear();
+		return end();
+	}
+	for (difference_type n = mystl::distance(first, last); n > 0; --n)
+		first = erase(first);
+	return first;
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+void unrolled_list<T, Alloc, NodeSiz>::clear() {
+	base_ptr cur = head.next;
+	while (cur != &head) {
+		base_ptr next = cur->next;
+		mystl::destroy(elems(cur), elems(cur) + cur->count);
+		node_allocator::deallocate(static_cast<node_ptr>(cur), 1);
+		cur = next;
+	}
+	init();
+}
+
+//-------------------------------------------------------------------------------------------------------------------
+// ڽn±ivalue, ǰ֤㻹пռ
+template<class T, class Alloc, size_t NodeSiz>
+void unrolled_list<T, Alloc, NodeSiz>::place(base_ptr n, size_type i, value_type&& value) {
+	T* p = elems(n);
+	size_type count = n->count;
+	if (i == count) {
+		mystl::construct(p + count, std::move(value));
+	}
+	else {
+		mystl::construct(p + count, std::move(p[count - 1]));
+		mystl::move_backward(p + i, p + count - 1, p + count);
+		p[i] = std::move(value);
+	}
+	++n->count;
+}
+
+// ѽnĺһԪƶn½, ½
+template<class T, class Alloc, size_t NodeSiz>
+typename unrolled_list<T, Alloc, NodeSiz>::base_ptr
+unrolled_list<T, Alloc, NodeSiz>::split(base_ptr n) {
+	size_type keep = n->count / 2;
+	base_ptr upper = link_new_node(n);
+	T* p = elems(n);
+	try {
+		mystl::uninitialized_move_if_noexcept(p + keep, p + n->count, elems(upper));
+	}
+	catch (...) {
+		free_node(upper);
+		throw;
+	}
+	mystl::destroy(p + keep, p + n->count);
+	upper->count = n->count - keep;
+	n->count = keep;
+	return upper;
+}
+
+// nһеԪȫƶnĩβ, Ȼͷһ
+template<class T, class Alloc, size_t NodeSiz>
+void unrolled_list<T, Alloc, NodeSiz>::merge_next(base_ptr n) {
+	base_ptr next = n->next;
+	T* src = elems(next);
+	mystl::uninitialized_move_if_noexcept(src, src + next->count, elems(n) + n->count);
+	mystl::destroy(src, src + next->count);
+	n->count += next->count;
+	free_node(next);
+}
+
+// еԪֱӸֵ, ɾ, β
+template<class T, class Alloc, size_t NodeSiz>
+void unrolled_list<T, Alloc, NodeSiz>::fill_assign(size_type n, const value_type& value) {
+	iterator it = begin();
+	for (; it != end() && n > 0; ++it, --n)
+		*it = value;
+	if (it != end())
+		erase(it, end());
+	for (; n > 0; --n)
+		emplace_back(value);
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+template<class InputIterator>
+void unrolled_list<T, Alloc, NodeSiz>::assign_dispatch(InputIterator first, InputIterator last, false_type) {
+	iterator it = begin();
+	for (; it != end() && first != last; ++it, ++first)
+		*it = *first;
+	if (it != end())
+		erase(it, end());
+	for (; first != last; ++first)
+		emplace_back(*first);
+}
+
+// ÿβ֮positionʧЧ, insertصĵ
+template<class T, class Alloc, size_t NodeSiz>
+void unrolled_list<T, Alloc, NodeSiz>::fill_insert(iterator position, size_type n, const value_type& value) {
+	for (; n > 0; --n) {
+		position = emplace(position, value);
+		++position;
+	}
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+template<class InputIterator>
+void unrolled_list<T, Alloc, NodeSiz>::insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
+	for (; first != last; ++first) {
+		position = emplace(position, *first);
+		++position;
+	}
+}
+
+//-----------------------------------------------ú(unrolled_listԱ)----------------------------------------------------
+template<class T, class Alloc, size_t NodeSiz>
+bool operator==(const unrolled_list<T, Alloc, NodeSiz>& lhs, const unrolled_list<T, Alloc, NodeSiz>& rhs) {
+	return lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin());
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+bool operator!=(const unrolled_list<T, Alloc, NodeSiz>& lhs, const unrolled_list<T, Alloc, NodeSiz>& rhs) {
+	return !(lhs == rhs);
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+bool operator<(const unrolled_list<T, Alloc, NodeSiz>& lhs, const unrolled_list<T, Alloc, NodeSiz>& rhs) {
+	return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+bool operator>(const unrolled_list<T, Alloc, NodeSiz>& lhs, const unrolled_list<T, Alloc, NodeSiz>& rhs) {
+	return rhs < lhs;
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+bool operator<=(const unrolled_list<T, Alloc, NodeSiz>& lhs, const unrolled_list<T, Alloc, NodeSiz>& rhs) {
+	return !(rhs < lhs);
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+bool operator>=(const unrolled_list<T, Alloc, NodeSiz>& lhs, const unrolled_list<T, Alloc, NodeSiz>& rhs) {
+	return !(lhs < rhs);
+}
+
+template<class T, class Alloc, size_t NodeSiz>
+void swap(unrolled_list<T, Alloc, NodeSiz>& lhs, unrolled_list<T, Alloc, NodeSiz>& rhs) {
+	lhs.swap(rhs);
+}
+
+}	// mystl
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef MYSTL_UNROLLED_LIST_TEST_H
+#define MYSTL_UNROLLED_LIST_TEST_H
+
+#include "test.h"
+#include "../MySTL/unrolled_list.h"
+#include "../MySTL/list.h"
+#include "../MySTL/vector.h"
+#include <iostream>
+#include <string>
+
+namespace mystl {
+namespace unrolled_list_test {
+
+// βcountԪ, ٴͷβ5
+#define UNROLLED_TRAVEL_DO_TEST(con, len, count) do {						\
+	con c;																	\
+	for (size_t i = 0; i < count; i++)										\
+		c.push_back(static_cast<int>(i));									\
+	clock_t start, end;														\
+	long long sum = 0;														\
+	start = clock();														\
+	for (int r = 0; r < 5; r++)												\
+		for (auto it = c.begin(); it != c.end(); ++it)						\
+			sum += *it;														\
+	end = clock();															\
+	if (0 == sum)															\
+		std::cout << "wrong sum";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+// countԪصмlenԪ, ÿһβλø
+#define UNROLLED_MID_INSERT_DO_TEST(con, len, count) do {					\
+	con c;																	\
+	for (size_t i = 0; i < count; i++)										\
+		c.push_back(static_cast<int>(i));									\
+	auto it = c.begin();													\
+	for (size_t i = 0; i < count / 2; i++)									\
+		++it;																\
+	clock_t start, end;														\
+	start = clock();														\
+	for (size_t i = 0; i < len; i++) {										\
+		it = c.insert(it, static_cast<int>(i));								\
+		if (i & 1)															\
+			++it;															\
+	}																		\
+	end = clock();															\
+	if (c.size() != count + len)											\
+		std::cout << "wrong size";											\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define UNROLLED_TEST(TEST, len, len1, len2, len3) do {						\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|    mystl::vector    |";									\
+	TEST(mystl::vector<int>, len, len1);									\
+	TEST(mystl::vector<int>, len, len2);									\
+	TEST(mystl::vector<int>, len, len3);									\
+	std::cout << "\n|     mystl::list     |";								\
+	TEST(mystl::list<int>, len, len1);										\
+	TEST(mystl::list<int>, len, len2);										\
+	TEST(mystl::list<int>, len, len3);										\
+	std::cout << "\n| mystl::unrolled_list|";								\
+	TEST(mystl::unrolled_list<int>, len, len1);								\
+	TEST(mystl::unrolled_list<int>, len, len2);								\
+	TEST(mystl::unrolled_list<int>, len, len3);								\
+	std::cout << "\n";														\
+} while(0)
+
+void unrolled_list_test() {
+	std::cout << "[===============================================================]\n";
+	std::cout << "[------------- Run container test : unrolled_list --------------]\n";
+	std::cout << "[-------------------------- API test ---------------------------]\n";
+
+	int test[] = { 1, 2, 3, 4, 5 };
+	mystl::unrolled_list<int> u1;
+	mystl::unrolled_list<int> u2(5);
+	mystl::unrolled_list<int> u3(5, 1);
+	mystl::unrolled_list<int> u4(test, test + 5);
+	mystl::unrolled_list<int> u5(u2);
+	mystl::unrolled_list<int> u6(std::move(u2));
+	mystl::unrolled_list<int> u7{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+	mystl::unrolled_list<int> u8, u9, u10;
+	u8 = u3;
+	u9 = std::move(u3);
+	u10 = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
+
+	FUN_AFTER(u1, u1.assign(8, 8));
+	FUN_AFTER(u1, u1.assign(test, test + 5));
+	FUN_AFTER(u1, u1.push_back(6));
+	FUN_AFTER(u1, u1.push_front(0));
+	FUN_AFTER(u1, u1.emplace_back(7));
+	FUN_AFTER(u1, u1.emplace_front(-1));
+	FUN_AFTER(u1, u1.pop_front());
+	FUN_AFTER(u1, u1.pop_back());
+	FUN_AFTER(u1, u1.insert(++u1.begin(), 9));
+	FUN_AFTER(u1, u1.insert(u1.end(), 2, 7));
+	FUN_AFTER(u1, u1.insert(u1.begin(), test, test + 3));
+	FUN_AFTER(u1, u1.erase(++u1.begin()));
+	FUN_AFTER(u1, u1.erase(u1.begin(), ++++u1.begin()));
+	FUN_AFTER(u1, u1.resize(12, 3));
+	FUN_AFTER(u1, u1.resize(6));
+	FUN_AFTER(u1, u1.swap(u4));
+
+	FUN_VALUE(*u1.begin());
+	FUN_VALUE(*u1.rbegin());
+	FUN_VALUE(u1.front());
+	FUN_VALUE(u1.back());
+
+	std::cout << std::boolalpha;
+	FUN_VALUE(u1.empty());
+	FUN_VALUE((u7 == u10));
+	FUN_VALUE((u4 < u1));
+	std::cout << std::noboolalpha;
+
+	FUN_VALUE(u1.size());
+	FUN_VALUE(u1.max_size());
+
+	// ˷ֳ, ڽԪغʱϲ
+	mystl::unrolled_list<int, mystl::alloc, 4> u11;
+	for (int i = 0; i < 8; i++)
+		u11.push_back(i);
+	FUN_VALUE(u11.node_count());
+	FUN_AFTER(u11, u11.insert(++u11.begin(), 10));
+	FUN_VALUE(u11.node_count());
+	FUN_AFTER(u11, u11.erase(u11.begin(), ++++++u11.begin()));
+	FUN_VALUE(u11.node_count());
+
+	// ˫, ʹalgo.hе㷨
+	FUN_AFTER(u7, mystl::reverse(u7.begin(), u7.end()));
+	FUN_VALUE(*mystl::find(u7.begin(), u7.end(), 5));
+	FUN_VALUE(mystl::distance(u7.begin(), u7.end()));
+
+	mystl::unrolled_list<std::string> us;
+	us.push_back(std::string(32, 'a'));
+	FUN_AFTER(us, us.emplace_back(3, 'b'));
+	FUN_AFTER(us, us.emplace_front("c"));
+	FUN_AFTER(us, us.insert(++us.begin(), "d"));
+	mystl::unrolled_list<std::string> us2(us);
+	FUN_AFTER(us2, us2.erase(us2.begin()));
+	FUN_AFTER(us, us.swap(us2));
+	PASSED;
+
+#if PERFORMANCE_TEST_ON
+	std::cout << "[--------------------- Performance Testing ---------------------]\n";
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|      travel x5      |";
+	UNROLLED_TEST(UNROLLED_TRAVEL_DO_TEST, 0, M(LEN1), M(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "| 10000 middle insert |";
+	UNROLLED_TEST(UNROLLED_MID_INSERT_DO_TEST, 10000, S(LEN1), S(LEN2), S(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	PASSED;
+#endif
+	std::cout << "[------------- End container test : unrolled_list --------------]\n";
+	std::cout << std::endl;
+	std::cout << std::endl;
+}
+
+}	// unrolled_list_test
+}	// mystl
+
+#endif
@@ -3,18 +3,49 @@
 
 #include "memory.h"
 #include <cassert>
+#include <cstring>
 #include "iterator.h"
 #include "type_traits.h"
+#include <type_traits>
+#include <utility>
 #include "algobase.h"
 
 namespace mystl {
 
+// vector
+// next_capacity(size, n, elem_bytes)ٲnԪʱ¿ռԪظ, Ϊsize + n
+// Ϊvectorĵģ, ҲԼ
+
+// , ݴ, ˷һĿռ(Ĭ)
+struct growth_double {
+	static size_t next_capacity(size_t size, size_t n, size_t) {
+		return size + (size > n ? size : n);
+	}
+};
+
+// 1.5, ˷֮һĿռ
+// ֮ǰͷŵļռл¿ռ, ʺϺܴvector
+struct growth_one_half {
+	static size_t next_capacity(size_t size, size_t n, size_t) {
+		return size + (size / 2 > n ? size / 2 : n);
+	}
+};
+
+// 1.5֮ȡallocʵʷĴС(СҳСı)
+// ĩβԭòϵĿռҲԪ, һø
+struct growth_size_class {
+	static size_t next_capacity(size_t size, size_t n, size_t elem_bytes) {
+		size_t res = growth_one_half::next_capacity(size, n, elem_bytes);
+		return alloc::good_size(res * elem_bytes) / elem_bytes;
+	}
+};
+
 // vector
-template<class T, class Alloc = alloc>
-class vector {
+template<class T, class Alloc = alloc, class Growth = growth_double>
+class vector : private simple_alloc<T, Alloc> {
 public:
 	typedef simple_alloc<T, Alloc>						data_allocator;
-	typedef simple_alloc<T, Alloc>						allocator_type;
+	typedef Alloc										allocator_type;
 
 	// 
 	typedef T											value_type;
@@ -29,9 +60,9 @@ public:
 	typedef mystl::reverse_iterator<iterator>			reverse_iterator;
 	typedef mystl::reverse_iterator<const_iterator>		const_reverse_iterator;
 
-	// õһ
-	allocator_type get_allocator() {
-		return data_allocator();
+	// õʹõķ
+	allocator_type get_allocator() const {
+		return data_allocator::resource();
 	}
 
 private:
@@ -44,25 +75,37 @@ public:
 
 	vector();
 
+	explicit vector(const Alloc& a);
+
 	explicit vector(size_type n);
 
-	vector(size_type n, const T& value);
+	vector(size_type n, const T& value, const Alloc& a = Alloc());
+
+	vector(const vector<T, Alloc, Growth>& rhs);
+
+	vector(const vector<T, Alloc, Growth>& rhs, const Alloc& a);
 
-	vector(const vector<T, Alloc>& rhs);
+	vector(vector<T, Alloc, Growth>&& rhs) noexcept;
+
+	vector(vector<T, Alloc, Growth>&& rhs, const Alloc& a);
 
 	template<class InputIterator>
-	vector(InputIterator first, InputIterator last) {
+	vector(InputIterator first, InputIterator last, const Alloc& a = Alloc()) : data_allocator(a) {
 		typedef typename Is_integer<InputIterator>::value	Integer;
 		initialize_aux(first, last, Integer());
 	}
 
-	vector(std::initializer_list<value_type> ilist) {
+	vector(std::initializer_list<value_type> ilist, const Alloc& a = Alloc()) : data_allocator(a) {
 		range_initialize(ilist.begin(), ilist.end());
 	}
 
-	vector<T, Alloc>& operator=(const vector<T, Alloc>& rhs);
+	vector<T, Alloc, Growth>& operator=(const vector<T, Alloc, Growth>& rhs);
+
+	vector<T, Alloc, Growth>& operator=(vector<T, Alloc, Growth>&& rhs)
+		noexcept(data_allocator::traits::propagate_on_container_move_assignment::value ||
+			data_allocator::traits::is_always_equal::value);
 
-	vector<T, Alloc>& operator=(std::initializer_list<value_type>& ilist);
+	vector<T, Alloc, Growth>& operator=(std::initializer_list<value_type>& ilist);
 
 	~vector();
 
@@ -134,6 +177,9 @@ public:
 
 	void reserve(size_type n);
 
+	// СԪظͬ
+	void shrink_to_fit();
+
 	//-----------------------------------------------------Ԫغ---------------------------------------------------------
 	reference operator[](int n) {
 		assert(0 <= n && static_cast<size_type>(n) < size());
@@ -198,36 +244,65 @@ public:
 	// 3. β˲Ԫ
 	void push_back(const value_type& value);
 
-	// 4. һԪ
+	void push_back(value_type&& value);
+
+	// 4. βֱӹԪ
+	template<class... Args>
+	void emplace_back(Args&&... args);
+
+	// 5. һԪ
 	void pop_back();
 
-	// 5. 뵥Ԫ
+	// 6. 뵥Ԫ
 	iterator insert(iterator position, const value_type& value);
 
-	// 6. Ԫ
+	iterator insert(iterator position, value_type&& value);
+
+	// 7. ָλֱӹԪ
+	template<class... Args>
+	iterator emplace(iterator position, Args&&... args);
+
+	// 8. Ԫ
 	void insert(iterator position, size_type n, const value_type& value);
 
-	// 7. ģ, Ԫ
+	// 9. ģ, Ԫ
 	template<class InputIterator>
 	void insert(iterator position, InputIterator first, InputIterator last);
 
-	// 8. ɾԪ
+	// 10. ɾԪ
 	iterator erase(iterator position);
 
-	// 9. ɾԪ
+	// 11. ɾԪ
 	iterator erase(iterator first, iterator last);
 
-	// 10. ɾԪ
+	// 12. ɾԪ
 	void clear();
 
-	// 11. С, ֵ
+	// 13. С, ֵ
 	void resize(size_type n, const value_type& value);
 
-	// 12. С
+	// 14. С
 	void resize(size_type n);
 
-	// 13.  
-	void swap(vector<T, Alloc>& rhs);
+	// 15.  
+	void swap(vector<T, Alloc, Growth>& rhs);
+
+	// 16. С, ԪĬϳʼ(ƽͲκγʼ)
+	// ļ߽ʱҪȰҪǵĿռ
+	void resize_default_init(size_type n);
+
+	// 17. С, Ԫصֵȷ, ֻƽ
+	void resize_uninitialized(size_type n) {
+		static_assert(std::is_trivial<T>::value, "resize_uninitialized requires a trivial value_type");
+		resize_default_init(n);
+	}
+
+	// 18. β׷[first, last), forward iteratorֻһ鸴
+	template<class InputIterator>
+	void append(InputIterator first, InputIterator last) {
+		typedef typename Is_integer<InputIterator>::value Integer;
+		append_dispatch(first, last, Integer());
+	}
 
 private:
 	//-------------------------------------------------------------------------------------------------------------------
@@ -264,8 +339,9 @@ private:
 	template<class ForwardIterator>
 	void range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag);
 
-	// 4. 뵥ԪʱĲ
-	void insert_aux(iterator position, const value_type& value);
+	// 4. 뵥ԪʱĲ, Ԫargsֱӹ
+	template<class... Args>
+	void insert_aux(iterator position, Args&&... args);
 
 	// 5. ģ壬ģΪʱĲԪʱĲ
 	template<class Integer>
@@ -275,6 +351,26 @@ private:
 	template<class InputIterator>
 	void insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type);
 
+	// 7. ģ壬ģΪʱ׷Ӳ
+	template<class Integer>
+	void append_dispatch(Integer n, Integer value, true_type) {
+		fill_insert(finish, static_cast<size_type>(n), static_cast<value_type>(value));
+	}
+
+	// 8. ģ壬ģΪʱ׷Ӳ
+	template<class InputIterator>
+	void append_dispatch(InputIterator first, InputIterator last, false_type) {
+		append_aux(first, last, iterator_category(first));
+	}
+
+	// 9. 8ʵϵõĺ(input iterator汾)
+	template<class InputIterator>
+	void append_aux(InputIterator first, InputIterator last, input_iterator_tag);
+
+	// 10. 8ʵϵõĺ(forward iterator汾)
+	template<class ForwardIterator>
+	void append_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag);
+
 
 	//---------------------------------------------------ֵ----------------------------------------------------------
 		// 1. ṩnvalueʱĸֵ
@@ -297,6 +393,18 @@ private:
 	void assign_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag);
 
 
+	//---------------------------------------------------Ԫظ----------------------------------------------------------
+	// ԪǷ԰ֽڰ
+	typedef std::integral_constant<bool, is_trivially_relocatable<T>::value>	relocatable;
+
+	// 1. ʱԭԪذᵽ¿ռ, ¿ռѾõnԪغpositionӦ
+	void relocate_around(iterator position, iterator new_start, size_type n, size_type new_size);
+
+	// 2. ٲnԪʱ¿ռĴС, Ծ
+	size_type grow_size(size_type n) const {
+		return Growth::next_capacity(size(), n, sizeof(T));
+	}
+
 	//-------------------------------------------------------------------------------------------------------------
 	void clean() {
 		start = nullptr;
@@ -308,22 +416,22 @@ private:
 
 //--------------------------------------------------޸ز--------------------------------------------------------------
 // ¸ֵ, Ϊ
-template<class T, class Alloc>
-void vector<T, Alloc>::assign(size_type n, const value_type& value) {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::assign(size_type n, const value_type& value) {
 	fill_assign(n, value);
 }
 
 // ¸ֵ, ģ庯
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class InputIterator>
-void vector<T, Alloc>::assign(InputIterator first, InputIterator last) {
+void vector<T, Alloc, Growth>::assign(InputIterator first, InputIterator last) {
 	typedef typename Is_integer<InputIterator>::value Integer;
 	assign_dispatch(first, last, Integer());
 }
 
 // β˲뺯
-template<class T, class Alloc>
-void vector<T, Alloc>::push_back(const value_type& value) {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::push_back(const value_type& value) {
 	// пռ
 	if (finish != end_of_storage) {
 		mystl::construct(finish, value);
@@ -336,9 +444,27 @@ void vector<T, Alloc>::push_back(const value_type& value) {
 	}
 }
 
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::push_back(value_type&& value) {
+	emplace_back(std::move(value));
+}
+
+// βֱӹԪ
+template<class T, class Alloc, class Growth>
+template<class... Args>
+void vector<T, Alloc, Growth>::emplace_back(Args&&... args) {
+	if (finish != end_of_storage) {
+		mystl::construct(finish, std::forward<Args>(args)...);
+		++finish;
+	}
+	else {
+		insert_aux(finish, std::forward<Args>(args)...);
+	}
+}
+
 // β˵Ԫ
-template<class T, class Alloc>
-void vector<T, Alloc>::pop_back() {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::pop_back() {
 	if (finish != start) {
 		--finish;
 		mystl::destroy(finish);
@@ -346,8 +472,8 @@ void vector<T, Alloc>::pop_back() {
 }
 
 // 뵥Ԫ
-template<class T, class Alloc>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(iterator position, const value_type& value) {
+template<class T, class Alloc, class Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(iterator position, const value_type& value) {
 	size_type n = position - start;
 	if (finish != end_of_storage && position == finish) {
 		mystl::construct(finish, value);
@@ -359,48 +485,63 @@ typename vector<T, Alloc>::iterator vector<T, Alloc>::insert(iterator position,
 	return start + n;
 }
 
+template<class T, class Alloc, class Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::insert(iterator position, value_type&& value) {
+	return emplace(position, std::move(value));
+}
+
+// ָλֱӹԪ
+template<class T, class Alloc, class Growth>
+template<class... Args>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::emplace(iterator position, Args&&... args) {
+	size_type n = position - start;
+	if (finish != end_of_storage && position == finish) {
+		mystl::construct(finish, std::forward<Args>(args)...);
+		++finish;
+	}
+	else {
+		insert_aux(position, std::forward<Args>(args)...);
+	}
+	return start + n;
+}
+
 // Ԫ
-template<class T, class Alloc>
-void vector<T, Alloc>::insert(iterator position, size_type n, const value_type& value) {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::insert(iterator position, size_type n, const value_type& value) {
 	fill_insert(position, n, value);
 }
 
 // Ԫ, ģ
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class InputIterator>
-void vector<T, Alloc>::insert(iterator position, InputIterator first, InputIterator last) {
+void vector<T, Alloc, Growth>::insert(iterator position, InputIterator first, InputIterator last) {
 	typedef typename Is_integer<InputIterator>::value Integer;
 	insert_dispatch(position, first, last, Integer());
 }
 
 // ɾԪ
-template<class T, class Alloc>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(iterator position) {
-	if (position + 1 != finish)
-		mystl::copy(position + 1, finish, position);
-	--finish;
-	mystl::destroy(finish);
+template<class T, class Alloc, class Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::erase(iterator position) {
+	mystl::erase_in_place(position, position + 1, finish);
 	return position;
 }
 
 // ɾԪ
-template<class T, class Alloc>
-typename vector<T, Alloc>::iterator vector<T, Alloc>::erase(iterator first, iterator last) {
-	iterator temp = mystl::copy(last, finish, first);
-	mystl::destroy(temp, finish);
-	finish = finish - (last - first);
+template<class T, class Alloc, class Growth>
+typename vector<T, Alloc, Growth>::iterator vector<T, Alloc, Growth>::erase(iterator first, iterator last) {
+	mystl::erase_in_place(first, last, finish);
 	return first;
 }
 
 // ɾԪ
-template<class T, class Alloc>
-void vector<T, Alloc>::clear() {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::clear() {
 	erase(start, finish);
 }
 
 // µС
-template<class T, class Alloc>
-void vector<T, Alloc>::resize(size_type n, const value_type& value) {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::resize(size_type n, const value_type& value) {
 	if (n < size()) {
 		erase(start + n, finish);
 	}
@@ -410,17 +551,46 @@ void vector<T, Alloc>::resize(size_type n, const value_type& value) {
 }
 
 // µС
-template<class T, class Alloc>
-void vector<T, Alloc>::resize(size_type n) {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::resize(size_type n) {
 	resize(n, T());
 }
 
+// С, ԪĬϳʼ
+// ƽֻƶfinish, ĬϹ, ʱѾԪ
+// Ҫʱ, ʱpush_backһǾ̯ʱ
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::resize_default_init(size_type n) {
+	if (n <= size()) {
+		erase(start + n, finish);
+		return;
+	}
+	if (n > capacity())
+		reserve(grow_size(n - size()));
+	iterator new_finish = start + n;
+	if (std::is_trivially_default_constructible<T>::value) {
+		finish = new_finish;
+		return;
+	}
+	iterator cur = finish;
+	try {
+		for (; cur != new_finish; ++cur)
+			::new (static_cast<void*>(cur)) T;
+	}
+	catch (...) {
+		mystl::destroy(finish, cur);
+		throw;
+	}
+	finish = new_finish;
+}
+
 // vector
 // ú:
-// 1. vector<T, Alloc>& operator=(std::initialize_list<value_type>& ilist) -> swap
-template<class T, class Alloc>
-void vector<T, Alloc>::swap(vector<T, Alloc>& rhs) {
+// 1. vector<T, Alloc, Growth>& operator=(std::initialize_list<value_type>& ilist) -> swap
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::swap(vector<T, Alloc, Growth>& rhs) {
 	if (this != &rhs) {
+		data_allocator::propagate_swap(rhs);
 		mystl::swap(start, rhs.start);
 		mystl::swap(finish, rhs.finish);
 		mystl::swap(end_of_storage, rhs.end_of_storage);
@@ -430,33 +600,82 @@ void vector<T, Alloc>::swap(vector<T, Alloc>& rhs) {
 
 //--------------------------------------------------졢ƺ----------------------------------------------------------
 // ֹ캯
-template<class T, class Alloc>
-vector<T, Alloc>::vector() {
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>::vector() {
 	start = nullptr;
 	finish = nullptr;
 	end_of_storage = nullptr;
 }
 
-template<class T, class Alloc>
-vector<T, Alloc>::vector(size_type n) {
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>::vector(const Alloc& a) : data_allocator(a) {
+	clean();
+}
+
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>::vector(size_type n) {
 	allocate_and_fill_n(n, T());
 }
 
-template<class T, class Alloc>
-vector<T, Alloc>::vector(size_type n, const T& value) {
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>::vector(size_type n, const T& value, const Alloc& a) : data_allocator(a) {
 	allocate_and_fill_n(n, value);
 }
 
 // ƹ캯
-template<class T, class Alloc>
-vector<T, Alloc>::vector(const vector<T, Alloc>& rhs) {
+// ķselect_on_container_copy_construction
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>::vector(const vector<T, Alloc, Growth>& rhs)
+	: data_allocator(data_allocator::traits::select_on_container_copy_construction(rhs.get_allocator())) {
 	allocate_and_copy(rhs.size(), rhs.start, rhs.finish);
 }
 
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>::vector(const vector<T, Alloc, Growth>& rhs, const Alloc& a) : data_allocator(a) {
+	allocate_and_copy(rhs.size(), rhs.start, rhs.finish);
+}
+
+// ƶ캯, ֱӽӹrhsĿռ
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>::vector(vector<T, Alloc, Growth>&& rhs) noexcept
+	: data_allocator(rhs.get_allocator()), start(rhs.start), finish(rhs.finish), end_of_storage(rhs.end_of_storage) {
+	rhs.clean();
+}
+
+// ָķrhsĲʱ, ܽӹrhsĿռ, ֻƶԪ
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>::vector(vector<T, Alloc, Growth>&& rhs, const Alloc& a) : data_allocator(a) {
+	if (data_allocator::same_resource(rhs)) {
+		start = rhs.start;
+		finish = rhs.finish;
+		end_of_storage = rhs.end_of_storage;
+		rhs.clean();
+	}
+	else {
+		size_type n = rhs.size();
+		start = data_allocator::allocate(n);
+		try {
+			finish = mystl::uninitialized_move(rhs.start, rhs.finish, start);
+		}
+		catch (...) {
+			data_allocator::deallocate(start, n);
+			throw;
+		}
+		end_of_storage = start + n;
+	}
+}
+
 // ֵ
-template<class T, class Alloc>
-vector<T, Alloc>& vector<T, Alloc>::operator=(const vector<T, Alloc>& rhs) {
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>& vector<T, Alloc, Growth>::operator=(const vector<T, Alloc, Growth>& rhs) {
 	if (this != &rhs) {
+		// Ҫɲȵķ, þɵķͷſռ
+		if (data_allocator::replaced_on_copy(rhs)) {
+			mystl::destroy(start, finish);
+			data_allocator::deallocate(start, end_of_storage - start);
+			clean();
+		}
+		data_allocator::propagate_copy(rhs);
 		size_type len = rhs.size();
 		// ȵǰҪ
 		if (len > capacity()) {
@@ -481,18 +700,61 @@ vector<T, Alloc>& vector<T, Alloc>::operator=(const vector<T, Alloc>& rhs) {
 	return *this;
 }
 
+// ƶֵ
+// Ŵʱ, ͷԼĿռ֮ӹrhsĿռ
+// ͸Ƹֵһ, ֻǰѸƻƶ
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>& vector<T, Alloc, Growth>::operator=(vector<T, Alloc, Growth>&& rhs)
+	noexcept(data_allocator::traits::propagate_on_container_move_assignment::value ||
+		data_allocator::traits::is_always_equal::value) {
+	if (this == &rhs)
+		return *this;
+	if (data_allocator::traits::propagate_on_container_move_assignment::value || data_allocator::same_resource(rhs)) {
+		mystl::destroy(start, finish);
+		data_allocator::deallocate(start, end_of_storage - start);
+		data_allocator::propagate_move(rhs);
+		start = rhs.start;
+		finish = rhs.finish;
+		end_of_storage = rhs.end_of_storage;
+		rhs.clean();
+	}
+	else {
+		size_type len = rhs.size();
+		if (len > capacity()) {
+			mystl::destroy(start, finish);
+			data_allocator::deallocate(start, end_of_storage - start);
+			clean();
+			start = data_allocator::allocate(len);
+			end_of_storage = start + len;
+			finish = mystl::uninitialized_move(rhs.start, rhs.finish, start);
+		}
+		else if (len <= size()) {
+			iterator temp = mystl::move(rhs.start, rhs.finish, start);
+			mystl::destroy(temp, finish);
+			finish = temp;
+		}
+		else {
+			iterator temp = rhs.start + size();
+			mystl::move(rhs.start, temp, start);
+			finish = mystl::uninitialized_move(temp, rhs.finish, finish);
+		}
+		rhs.clear();
+	}
+	return *this;
+}
+
 // ֵ(initialize_list)
 // Ϊinitialize_listֻڳʼʱãֱӹһµvectorswap
-template<class T, class Alloc>
-vector<T, Alloc>& vector<T, Alloc>::operator=(std::initializer_list<value_type>& ilist) {
-	vector<T, Alloc> temp(ilist);
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>& vector<T, Alloc, Growth>::operator=(std::initializer_list<value_type>& ilist) {
+	vector<T, Alloc, Growth> temp(ilist, get_allocator());
 	swap(temp);
 	return *this;
 }
 
 // 
-template<class T, class Alloc>
-vector<T, Alloc>::~vector() {
+template<class T, class Alloc, class Growth>
+vector<T, Alloc, Growth>::~vector() {
 	mystl::destroy(start, finish);
 	data_allocator::deallocate(start, end_of_storage - start);
 	clean();
@@ -505,17 +767,17 @@ vector<T, Alloc>::~vector() {
 // InputIteratorʱô˺
 // ú:
 // vector(first, last) -> initialize_aux
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class Integer>
-void vector<T, Alloc>::initialize_aux(Integer n, Integer value, true_type) {
+void vector<T, Alloc, Growth>::initialize_aux(Integer n, Integer value, true_type) {
 	allocate_and_fill_n(n, value);
 }
 
 // InputIterator()ʱô˺
 // ΪĶҲõ˰ĶװΪһ
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class InputIterator>
-void vector<T, Alloc>::initialize_aux(InputIterator first, InputIterator last, false_type) {
+void vector<T, Alloc, Growth>::initialize_aux(InputIterator first, InputIterator last, false_type) {
 	range_initialize(first, last);
 }
 
@@ -523,9 +785,9 @@ void vector<T, Alloc>::initialize_aux(InputIterator first, InputIterator last, f
 // ú: 
 // 1. vector(first, last) -> initialize_aux -> range_initialize
 // 2. vector(std::initialize_list<value_type> ilist) -> range_initialize
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class InputIterator>
-void vector<T, Alloc>::range_initialize(InputIterator first, InputIterator last) {
+void vector<T, Alloc, Growth>::range_initialize(InputIterator first, InputIterator last) {
 	size_type n = mystl::distance(first, last);
 	allocate_and_copy(n, first, last);
 }
@@ -533,10 +795,10 @@ void vector<T, Alloc>::range_initialize(InputIterator first, InputIterator last)
 // ȷnСռ䣬ȻfirstlastֵƵµĿռ
 // ú:
 // 1. range_initialize -> allocate_and_copy
-// 2. vector(const vector<T, Alloc>& rhs) -> allocate_and_copy
-template<class T, class Alloc>
+// 2. vector(const vector<T, Alloc, Growth>& rhs) -> allocate_and_copy
+template<class T, class Alloc, class Growth>
 template<class InputIterator>
-void vector<T, Alloc>::allocate_and_copy(size_type n, InputIterator first, InputIterator last) {
+void vector<T, Alloc, Growth>::allocate_and_copy(size_type n, InputIterator first, InputIterator last) {
 	try {
 		start = data_allocator::allocate(n);
 		finish = mystl::uninitialized_copy(first, last, start);
@@ -553,8 +815,8 @@ void vector<T, Alloc>::allocate_and_copy(size_type n, InputIterator first, Input
 // ú:
 // 1. vector(size_type n, const T& value) -> allocate_and_fill_n
 // 2. vector(size_type n) -> allocate_and_fill_n
-template<class T, class Alloc>
-void vector<T, Alloc>::allocate_and_fill_n(size_type n, const T& value) {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::allocate_and_fill_n(size_type n, const T& value) {
 	try {
 		start = data_allocator::allocate(n);
 		finish = uninitialized_fill_n(start, n, value);
@@ -568,107 +830,83 @@ void vector<T, Alloc>::allocate_and_fill_n(size_type n, const T& value) {
 }
 
 // 뵥Ԫصĸ
+// argsvectorеԪ, ƶԪ֮ǰȹԪ
 // ú:
-// 1. 
-template<class T, class Alloc>
-void vector<T, Alloc>::insert_aux(iterator position, const value_type& value) {
-	// ǰпռ
+// 1. push_back, emplace_back, insert, emplace -> insert_aux
+template<class T, class Alloc, class Growth>
+template<class... Args>
+void vector<T, Alloc, Growth>::insert_aux(iterator position, Args&&... args) {
+	// ǰпռ, Ԫغһλ
 	if (finish != end_of_storage) {
-		mystl::construct(finish, *(finish - 1));
-		finish++;
-		mystl::copy_backward(position, finish - 2, finish - 1);
-		*position = value;
+		mystl::emplace_in_place(position, finish, std::forward<Args>(args)...);
 	}
-	// û
-	else {
+	// ûβ԰ֽڰ˵Ԫ
+	// ʹreallocateݣڴԭչҪ
+	else if (position == finish && relocatable::value) {
+		value_type x(std::forward<Args>(args)...);
 		size_type old_size = size();
-		size_type new_size = (old_size == 0 ? 1 : old_size * 2);
-		iterator new_start = nullptr;
-		iterator new_finish = nullptr;
+		size_type new_size = grow_size(1);
+		start = data_allocator::reallocate(start, old_size, new_size);
+		finish = start + old_size;
+		end_of_storage = start + new_size;
+		mystl::construct(finish, std::move(x));
+		++finish;
+	}
+	// û, ¿ռйԪٰԭԪذȥ
+	else {
+		size_type new_size = grow_size(1);
+		iterator new_start = data_allocator::allocate(new_size);
 		try {
-			new_start = data_allocator::allocate(new_size);
-			new_finish = mystl::uninitialized_copy(start, position, new_start);
-			mystl::construct(new_finish, value);
-			new_finish++;
-			new_finish = mystl::uninitialized_copy(position, finish, new_finish);
+			mystl::construct(new_start + (position - start), std::forward<Args>(args)...);
 		}
 		catch (...) {
-			mystl::destroy(new_start, new_finish);
 			data_allocator::deallocate(new_start, new_size);
+			throw;
 		}
-		mystl::destroy(start, finish);
-		data_allocator::deallocate(start, old_size);
-		start = new_start;
-		finish = new_finish;
-		end_of_storage = start + new_size;
+		relocate_around(position, new_start, 1, new_size);
 	}
 }
 
 // ָλònԪأģΪʱô˺
 // ú: 
 // 1. insert(position, start, last) -> insert_dispatch()
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class Integer>
-void vector<T, Alloc>::insert_dispatch(iterator position, Integer n, Integer value, true_type) {
+void vector<T, Alloc, Growth>::insert_dispatch(iterator position, Integer n, Integer value, true_type) {
 	fill_insert(position, static_cast<size_type>(n), static_cast<value_type>(value));
 }
 
 // ָλònԪأģΪʱô˺
 // ú: 
 // 1. insert(position, start, last) -> insert_dispatch()
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class InputIterator>
-void vector<T, Alloc>::insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
+void vector<T, Alloc, Growth>::insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
 	range_insert(position, first, last, iterator_category(first));
 }
 
 // ָλònԪأinsertʱô˺
 // ú:
 // 1. insert(position, start, last) -> insert_dispatch(position, n, value, true_type) -> fill_insert()
-template<class T, class Alloc>
-void vector<T, Alloc>::fill_insert(iterator position, size_type n, const T& value) {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::fill_insert(iterator position, size_type n, const T& value) {
 	if (n != 0) {
 		// ڵn
 		if (static_cast<size_type>(end_of_storage - finish) >= n) {
-			size_type elem_after = finish - position;
-			// position֮Ԫظn
-			// תƺ벿 -> תǰ벿 ->
-			if (elem_after > n) {
-				iterator new_finish = mystl::uninitialized_copy(finish - n, finish, finish);
-				mystl::copy_backward(position, finish - n, finish);
-				mystl::fill(position, position + n, value);
-				finish = new_finish;
-			}
-			// position֮Ԫظڵn
-			// һ -> ת -> ʣ²
-			else {
-				iterator new_finish = mystl::uninitialized_fill_n(finish, n - elem_after, value);
-				new_finish = mystl::uninitialized_copy(position, finish, new_finish);
-				mystl::fill(position, finish, value);
-				finish = new_finish;
-			}
+			mystl::fill_insert_in_place(position, finish, n, value);
 		}
 		// nС
 		else {
-			size_type old_size = size();
-			size_type new_size = old_size + mystl::max(old_size, n);
-			iterator new_start = nullptr;
-			iterator new_finish = nullptr;
+			size_type new_size = grow_size(n);
+			iterator new_start = data_allocator::allocate(new_size);
 			try {
-				new_start = data_allocator::allocate(new_size);
-				new_finish = mystl::uninitialized_copy(start, position, new_start);
-				new_finish = mystl::uninitialized_fill_n(new_finish, n, value);
-				new_finish = mystl::uninitialized_copy(position, finish, new_finish);
+				mystl::uninitialized_fill_n(new_start + (position - start), n, value);
 			}
 			catch (...) {
-				mystl::destroy(new_start, new_finish);
-				data_allocator::deallocate(new_start, n);
+				data_allocator::deallocate(new_start, new_size);
+				throw;
 			}
-			mystl::destroy(start, finish);
-			data_allocator::deallocate(start, old_size);
-			start = new_start;
-			finish = new_finish;
-			end_of_storage = start + new_size;
+			relocate_around(position, new_start, n, new_size);
 		}
 	}
 }
@@ -677,9 +915,9 @@ void vector<T, Alloc>::fill_insert(iterator position, size_type n, const T& valu
 // Եinput iteratorİ汾
 // ú:
 // 1. insert(position, start, last) -> insert_dispatch(position, first, last, false_type) -> range_insert()
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class InputIterator>
-void vector<T, Alloc>::range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag) {
+void vector<T, Alloc, Growth>::range_insert(iterator position, InputIterator first, InputIterator last, input_iterator_tag) {
 	for (; first != last; ++first) {
 		position = insert(position, *first);
 		++position;
@@ -690,54 +928,27 @@ void vector<T, Alloc>::range_insert(iterator position, InputIterator first, Inpu
 // Եforward iteratorİ汾
 // ú:
 // 1. insert(position, start, last) -> insert_dispatch(position, first, last, false_type) -> range_insert()
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class ForwardIterator>
-void vector<T, Alloc>::range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+void vector<T, Alloc, Growth>::range_insert(iterator position, ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
 	size_type n = mystl::distance(first, last);
 	if (n != 0) {
-		// ڵn
-		if (capacity() >= n) {
-			size_type elem_after = finish - position;
-			// position֮Ԫظn
-			// תƺ벿 -> תǰ벿 ->
-			if (elem_after > n) {
-				iterator new_finish = mystl::uninitialized_copy(finish - n, finish, finish);
-				mystl::copy_backward(position, finish - n, finish);
-				mystl::copy(first, last, position);
-				finish = new_finish;
-			}
-			// position֮Ԫظڵn
-			// һ -> ת -> ʣ²
-			else {
-				ForwardIterator mid = first;
-				mystl::advance(mid, elem_after);
-				iterator new_finish = mystl::uninitialized_copy(mid, last, finish);
-				new_finish = mystl::uninitialized_copy(position, finish, new_finish);
-				mystl::copy(first, mid, position);
-				finish = new_finish;
-			}
+		// ʣڵn
+		if (static_cast<size_type>(end_of_storage - finish) >= n) {
+			mystl::range_insert_in_place(position, finish, first, last, n);
 		}
 		// nС
 		else {
-			size_type old_size = size();
-			size_type new_size = old_size + mystl::max(old_size, n);
-			iterator new_start = nullptr;
-			iterator new_finish = nullptr;
+			size_type new_size = grow_size(n);
+			iterator new_start = data_allocator::allocate(new_size);
 			try {
-				new_start = data_allocator::allocate(new_size);
-				new_finish = mystl::uninitialized_copy(start, position, new_start);
-				new_finish = mystl::uninitialized_copy(first, last, new_finish);
-				new_finish = mystl::uninitialized_copy(position, finish, new_finish);
+				mystl::uninitialized_copy(first, last, new_start + (position - start));
 			}
 			catch (...) {
-				mystl::destroy(new_start, new_finish);
 				data_allocator::deallocate(new_start, new_size);
+				throw;
 			}
-			mystl::destroy(start, finish);
-			data_allocator::deallocate(start, old_size);
-			start = new_start;
-			finish = new_finish;
-			end_of_storage = start + new_size;
+			relocate_around(position, new_start, n, new_size);
 		}
 	}
 }
@@ -746,10 +957,10 @@ void vector<T, Alloc>::range_insert(iterator position, ForwardIterator first, Fo
 // ú:
 // 1. assign(n, value) -> fill_assign
 // 2. assign(first, last) -> assign_dispatch(first, last, true_type)(ģΪ) -> fill_assign
-template<class T, class Alloc>
-void vector<T, Alloc>::fill_assign(size_type n, const value_type& value) {
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::fill_assign(size_type n, const value_type& value) {
 	if (capacity() < n) {
-		vector temp(n, value);
+		vector temp(n, value, get_allocator());
 		swap(temp);
 	}
 	else if (size() < n) {
@@ -767,27 +978,27 @@ void vector<T, Alloc>::fill_assign(size_type n, const value_type& value) {
 // vector·ֵ, assignģΪʱô˺
 // ú:
 // 1. assign(first, assign) -> assign_dispatch
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class Integer>
-void vector<T, Alloc>::assign_dispatch(Integer n, Integer value, true_type) {
+void vector<T, Alloc, Growth>::assign_dispatch(Integer n, Integer value, true_type) {
 	fill_assign(static_cast<size_type>(n), static_cast<value_type>(value));
 }
 
 // vector·ֵ, assignģΪʱô˺, Ҫһֵ
 // ú:
 // 1. assign(first, last) -> assign_dispatch
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class InputIterator>
-void vector<T, Alloc>::assign_dispatch(InputIterator first, InputIterator last, false_type) {
+void vector<T, Alloc, Growth>::assign_dispatch(InputIterator first, InputIterator last, false_type) {
 	assign_aux(first, last, iterator_category(first));
 }
 
 // vector·ֵ, assignģΪʱô˺(input iterator汾)
 // ú:
 // 1. assign(first, last) -> assign_dispatch(first, last, false_type) -> assign_aux
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class InputIterator>
-void vector<T, Alloc>::assign_aux(InputIterator first, InputIterator last, input_iterator_tag) {
+void vector<T, Alloc, Growth>::assign_aux(InputIterator first, InputIterator last, input_iterator_tag) {
 	iterator cur = start;
 	for (; first != last && cur != finish; ++first, ++cur) {
 		*cur = *first;
@@ -803,9 +1014,9 @@ void vector<T, Alloc>::assign_aux(InputIterator first, InputIterator last, input
 // vector·ֵ, assignģΪʱô˺(forward iterator汾)
 // ú:
 // 1. assign(first, last) -> assign_dispatch(first, last, false_type) -> assign_aux
-template<class T, class Alloc>
+template<class T, class Alloc, class Growth>
 template<class ForwardIterator>
-void vector<T, Alloc>::assign_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+void vector<T, Alloc, Growth>::assign_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
 	size_type len = distance(first, last);
 	if (capacity() < len) {
 		mystl::destroy(start, finish);
@@ -826,53 +1037,117 @@ void vector<T, Alloc>::assign_aux(ForwardIterator first, ForwardIterator last, f
 }
 
 // Ԥռ亯, ֻеnڵǰʱŻ·
-template<class T, class Alloc>
-void vector<T, Alloc>::reserve(size_type n) {
-	if (n > capacity()) {
+// ԰ֽڰ˵Ԫʹreallocate, ڴԭչ
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::reserve(size_type n) {
+	if (n > capacity() && relocatable::value) {
 		size_type old_size = size();
-		iterator new_start = data_allocator::allocate(n);
-		iterator new_finish = mystl::uninitialized_copy(start, finish, new_start);
-		mystl::destroy(start, finish);
-		data_allocator::deallocate(start, n);
-		start = new_start;
-		finish = new_finish;
+		start = data_allocator::reallocate(start, capacity(), n);
+		finish = start + old_size;
 		end_of_storage = start + n;
 	}
+	else if (n > capacity()) {
+		relocate_around(finish, data_allocator::allocate(n), 0, n);
+	}
+}
+
+// Сsize(), ûԪʱͷпռ
+// ԰ֽڰ˵Ԫʹreallocate, ͬһСʱҪ
+// Ԫذᵽ¿ռ, ʱԭvectorֲ
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::shrink_to_fit() {
+	if (finish == end_of_storage)
+		return;
+	if (empty()) {
+		data_allocator::deallocate(start, capacity());
+		clean();
+	}
+	else if (relocatable::value) {
+		size_type old_size = size();
+		start = data_allocator::reallocate(start, capacity(), old_size);
+		finish = end_of_storage = start + old_size;
+	}
+	else {
+		relocate_around(finish, data_allocator::allocate(size()), 0, size());
+	}
+}
+
+// ʱԪ
+// new_startкpositionӦλѾnԪ, ԭԪذᵽ, ȻͷԭĿռ
+// ʱԪزͷ¿ռ, ԭvectorֲ
+// ú:
+// 1. insert_aux, fill_insert, range_insert, reserve -> relocate_around
+template<class T, class Alloc, class Growth>
+void vector<T, Alloc, Growth>::relocate_around(iterator position, iterator new_start, size_type n, size_type new_size) {
+	iterator new_finish;
+	try {
+		new_finish = mystl::relocate_around(start, position, finish, new_start, n);
+	}
+	catch (...) {
+		data_allocator::deallocate(new_start, new_size);
+		throw;
+	}
+	data_allocator::deallocate(start, end_of_storage - start);
+	start = new_start;
+	finish = new_finish;
+	end_of_storage = start + new_size;
+}
+
+// β׷[first, last), input iterator汾
+// ú:
+// 1. append(first, last) -> append_dispatch -> append_aux
+template<class T, class Alloc, class Growth>
+template<class InputIterator>
+void vector<T, Alloc, Growth>::append_aux(InputIterator first, InputIterator last, input_iterator_tag) {
+	for (; first != last; ++first)
+		emplace_back(*first);
+}
+
+// β׷[first, last), forward iterator汾
+// Ȱһ, ٰθƵβδʼĿռ, ҪᶯеԪ
+// ʱѾƵԪر, Ԫز
+template<class T, class Alloc, class Growth>
+template<class ForwardIterator>
+void vector<T, Alloc, Growth>::append_aux(ForwardIterator first, ForwardIterator last, forward_iterator_tag) {
+	size_type n = mystl::distance(first, last);
+	if (n > static_cast<size_type>(end_of_storage - finish))
+		reserve(grow_size(n));
+	finish = mystl::uninitialized_copy(first, last, finish);
 }
 
 //--------------------------------------------------ú(vector)----------------------------------------------------------
-template<class T, class Alloc>
-inline bool operator==(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template<class T, class Alloc, class Growth>
+inline bool operator==(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 	return (lhs.size() == rhs.size() && mystl::equal(lhs.begin(), lhs.end(), rhs.begin()));
 }
 
-template<class T, class Alloc>
-inline bool operator!=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template<class T, class Alloc, class Growth>
+inline bool operator!=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 	return !(lhs == rhs);
 }
 
-template<class T, class Alloc>
-inline bool operator<(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template<class T, class Alloc, class Growth>
+inline bool operator<(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 	return mystl::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 }
 
-template<class T, class Alloc>
-inline bool operator>=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template<class T, class Alloc, class Growth>
+inline bool operator>=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 	return !(lhs < rhs);
 }
 
-template<class T, class Alloc>
-inline bool operator>(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template<class T, class Alloc, class Growth>
+inline bool operator>(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 	return rhs < lhs;
 }
 
-template<class T, class Alloc>
-inline bool operator<=(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template<class T, class Alloc, class Growth>
+inline bool operator<=(const vector<T, Alloc, Growth>& lhs, const vector<T, Alloc, Growth>& rhs) {
 	return !(rhs < lhs);
 }
 
-template<class T, class Alloc>
-inline void swap(const vector<T, Alloc>& lhs, const vector<T, Alloc>& rhs) {
+template<class T, class Alloc, class Growth>
+inline void swap(vector<T, Alloc, Growth>& lhs, vector<T, Alloc, Growth>& rhs) {
 	lhs.swap(rhs);
 }
 
@@ -4,10 +4,232 @@
 #include "test.h"
 #include "../MySTL/vector.h"
 #include <iostream>
+#include <string>
+#include <memory>
 
 namespace mystl {
 namespace vector_test {
 
+// vector<int>countԪ
+// std::vectorÿݶҪ롢ơͷţmystl::vectorڴڴʹmremapԭչ
+#define VECTOR_GROW_DO_TEST(con, count) do {								\
+	clock_t start, end;														\
+	con<int> v;																\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++)										\
+		v.push_back(static_cast<int>(i));									\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define VECTOR_GROW_TEST(len1, len2, len3) do {								\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|         std         |";									\
+	VECTOR_GROW_DO_TEST(std::vector, len1);									\
+	VECTOR_GROW_DO_TEST(std::vector, len2);									\
+	VECTOR_GROW_DO_TEST(std::vector, len3);									\
+	std::cout << "\n|        mystl        |";								\
+	VECTOR_GROW_DO_TEST(mystl::vector, len1);								\
+	VECTOR_GROW_DO_TEST(mystl::vector, len2);								\
+	VECTOR_GROW_DO_TEST(mystl::vector, len3);								\
+	std::cout << "\n";														\
+} while(0)
+
+// push_back countstd::string
+// ַַŻĳ, ʱԪҪռ, ƶֻҪָ
+#define VECTOR_STRING_DO_TEST(con, count) do {								\
+	clock_t start, end;														\
+	std::string s(32, 'a');													\
+	con<std::string> v;														\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++)										\
+		v.push_back(s);														\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define VECTOR_STRING_TEST(len1, len2, len3) do {							\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|         std         |";									\
+	VECTOR_STRING_DO_TEST(std::vector, len1);								\
+	VECTOR_STRING_DO_TEST(std::vector, len2);								\
+	VECTOR_STRING_DO_TEST(std::vector, len3);								\
+	std::cout << "\n|        mystl        |";								\
+	VECTOR_STRING_DO_TEST(mystl::vector, len1);								\
+	VECTOR_STRING_DO_TEST(mystl::vector, len2);								\
+	VECTOR_STRING_DO_TEST(mystl::vector, len3);								\
+	std::cout << "\n";														\
+} while(0)
+
+// unique_ptr԰ֽڰ
+// ݺͷʱstd::vectorƶ, mystl::vector
+#define VECTOR_RELOCATE_DO_TEST(con, fun, count) do {						\
+	clock_t start, end;														\
+	con<std::unique_ptr<int>> v;											\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++)										\
+		fun;																\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define VECTOR_RELOCATE_TEST(fun, len1, len2, len3) do {					\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|         std         |";									\
+	VECTOR_RELOCATE_DO_TEST(std::vector, fun, len1);						\
+	VECTOR_RELOCATE_DO_TEST(std::vector, fun, len2);						\
+	VECTOR_RELOCATE_DO_TEST(std::vector, fun, len3);						\
+	std::cout << "\n|        mystl        |";								\
+	VECTOR_RELOCATE_DO_TEST(mystl::vector, fun, len1);						\
+	VECTOR_RELOCATE_DO_TEST(mystl::vector, fun, len2);						\
+	VECTOR_RELOCATE_DO_TEST(mystl::vector, fun, len3);						\
+	std::cout << "\n";														\
+} while(0)
+
+// ¼ֵֽķ, ռalloc
+// ʵʷĴС(good_size), reallocateԭչ
+class peak_alloc {
+public:
+	static void* allocate(size_t n) {
+		add(alloc::good_size(n));
+		return alloc::allocate(n);
+	}
+
+	static void deallocate(void* p, size_t n) {
+		alloc::deallocate(p, n);
+		bytes() -= alloc::good_size(n);
+	}
+
+	static void* reallocate(void* p, size_t old_size, size_t new_size) {
+		void* res = alloc::reallocate(p, old_size, new_size);
+		bytes() -= alloc::good_size(old_size);
+		add(alloc::good_size(new_size));
+		return res;
+	}
+
+	static size_t& bytes() {
+		static size_t n = 0;
+		return n;
+	}
+
+	static size_t& peak() {
+		static size_t n = 0;
+		return n;
+	}
+
+private:
+	static void add(size_t n) {
+		bytes() += n;
+		if (bytes() > peak())
+			peak() = bytes();
+	}
+};
+
+// ʹòͬpush_back countint
+#define VECTOR_POLICY_DO_TEST(policy, count) do {							\
+	clock_t start, end;														\
+	mystl::vector<int, mystl::alloc, policy> v;								\
+	start = clock();														\
+	for (size_t i = 0; i < count; i++)										\
+		v.push_back(static_cast<int>(i));									\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+// зֽķֵ(MB)
+#define VECTOR_PEAK_DO_TEST(policy, count) do {								\
+	peak_alloc::peak() = 0;													\
+	{																		\
+		mystl::vector<int, peak_alloc, policy> v;							\
+		for (size_t i = 0; i < count; i++)									\
+			v.push_back(static_cast<int>(i));								\
+	}																		\
+	char buf[16];															\
+	std::snprintf(buf, sizeof(buf), "%d", static_cast<int>(peak_alloc::peak() >> 20));	\
+	std::string t = buf;													\
+	t += "MB    |";															\
+	std::cout << std::setw(WIDE) << t;										\
+} while(0)
+
+#define VECTOR_POLICY_TEST(TEST, len1, len2, len3) do {						\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|        double       |";								\
+	TEST(mystl::growth_double, len1);										\
+	TEST(mystl::growth_double, len2);										\
+	TEST(mystl::growth_double, len3);										\
+	std::cout << "\n|       one_half      |";								\
+	TEST(mystl::growth_one_half, len1);										\
+	TEST(mystl::growth_one_half, len2);										\
+	TEST(mystl::growth_one_half, len3);										\
+	std::cout << "\n|      size_class     |";								\
+	TEST(mystl::growth_size_class, len1);									\
+	TEST(mystl::growth_size_class, len2);									\
+	TEST(mystl::growth_size_class, len3);									\
+	std::cout << "\n";														\
+} while(0)
+
+// ģ: һ64KBԴչout, ÿֽڶᱻдһ
+inline void decode_block(char* out, size_t n, size_t offset) {
+	static char src[65536];
+	static bool init = false;
+	if (!init) {
+		for (size_t i = 0; i < sizeof(src); i++)
+			src[i] = static_cast<char>(i * 131 + 7);
+		init = true;
+	}
+	for (size_t i = 0; i < n; i++)
+		out[i] = src[(offset + i) & (sizeof(src) - 1)] ^ static_cast<char>(offset >> 16);
+}
+
+// countֽڽ뵽vector<char>, ÿν64KB
+// resize: Ȱοռٽ, resize_default_init: ֱӽ
+// append: 뵽һ64KBĻ, ׷ӵvectorβ
+#define VECTOR_DECODE_DO_TEST(con, resize_fun, count) do {					\
+	clock_t start, end;														\
+	start = clock();														\
+	con<char> v;															\
+	v.resize_fun(count);													\
+	for (size_t i = 0; i < count; i += 65536)								\
+		decode_block(&v[0] + i, count - i < 65536 ? count - i : 65536, i);	\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define VECTOR_APPEND_DO_TEST(count) do {									\
+	clock_t start, end;														\
+	static char buf[65536];													\
+	start = clock();														\
+	mystl::vector<char> v;													\
+	for (size_t i = 0; i < count; i += 65536) {								\
+		size_t n = count - i < 65536 ? count - i : 65536;					\
+		decode_block(buf, n, i);											\
+		v.append(buf, buf + n);												\
+	}																		\
+	end = clock();															\
+	PRINT_TIME(start, end);													\
+} while(0)
+
+#define VECTOR_DECODE_TEST(len1, len2, len3) do {							\
+	PRINT_LEN(len1, len2, len3, WIDE);										\
+	std::cout << "|      std resize     |";								\
+	VECTOR_DECODE_DO_TEST(std::vector, resize, len1);						\
+	VECTOR_DECODE_DO_TEST(std::vector, resize, len2);						\
+	VECTOR_DECODE_DO_TEST(std::vector, resize, len3);						\
+	std::cout << "\n|     mystl resize    |";								\
+	VECTOR_DECODE_DO_TEST(mystl::vector, resize, len1);						\
+	VECTOR_DECODE_DO_TEST(mystl::vector, resize, len2);						\
+	VECTOR_DECODE_DO_TEST(mystl::vector, resize, len3);						\
+	std::cout << "\n| resize_default_init |";								\
+	VECTOR_DECODE_DO_TEST(mystl::vector, resize_default_init, len1);		\
+	VECTOR_DECODE_DO_TEST(mystl::vector, resize_default_init, len2);		\
+	VECTOR_DECODE_DO_TEST(mystl::vector, resize_default_init, len3);		\
+	std::cout << "\n|        append       |";								\
+	VECTOR_APPEND_DO_TEST(len1);											\
+	VECTOR_APPEND_DO_TEST(len2);											\
+	VECTOR_APPEND_DO_TEST(len3);											\
+	std::cout << "\n";														\
+} while(0)
+
 void vector_test() {
 	std::cout << "[===============================================================]\n";
 	std::cout << "[----------------- Run container test : vector -----------------]\n";
@@ -19,17 +241,17 @@ void vector_test() {
 	vector<int> v3(10, 1);
 	vector<int> v4(test, test + 5);
 	vector<int> v5(v2);
-//	vector<int> v6(std::move(v2));
+	vector<int> v6(std::move(v2));
 	vector<int> v7{ 1, 2, 3, 4, 5, 6, 7, 8, 9 };
 	vector<int> v8, v9, v10;
 	v8 = v3;
-//	v9 = std::move(v3);
+	v9 = std::move(v3);
 	v10 = { 1, 2, 3, 4, 5, 6, 7, 8, 9 };
 
 	FUN_AFTER(v1, v1.assign(8, 8));
 	FUN_AFTER(v1, v1.assign(test, test + 5));
-//	FUN_AFTER(v1, v1.emplace(v1.begin(), 0));
-//	FUN_AFTER(v1, v1.emplace_back(6));
+	FUN_AFTER(v1, v1.emplace(v1.begin(), 0));
+	FUN_AFTER(v1, v1.emplace_back(6));
 	FUN_AFTER(v1, v1.push_back(6));
 	FUN_AFTER(v1, v1.insert(v1.end(), 7));
 	FUN_AFTER(v1, v1.insert(v1.begin() + 3, 2, 3));
@@ -88,6 +310,62 @@ void vector_test() {
 	FUN_VALUE(v1.size());
 	FUN_VALUE(v1.capacity());
 
+	FUN_AFTER(v1, v1.shrink_to_fit());
+	FUN_VALUE(v1.size());
+	FUN_VALUE(v1.capacity());
+
+	// Ԫزʼresize, Լһݵappend
+	vector<char> vc;
+	vc.resize_uninitialized(4);
+	vc[0] = 'a', vc[1] = 'b', vc[2] = 'c', vc[3] = 'd';
+	const char* chars = "efgh";
+	FUN_AFTER(vc, vc.append(chars, chars + 4));
+	FUN_AFTER(vc, vc.resize_default_init(3));
+	FUN_AFTER(v1, v1.append(test, test + 5));
+	FUN_AFTER(v1, v1.append(2, 8));
+	FUN_VALUE(v1.capacity());
+
+	// ͬ: , 1.5, 1.5allocĴС
+	vector<int, alloc, growth_one_half> g1;
+	vector<int, alloc, growth_size_class> g2;
+	for (int i = 0; i < 20; i++) {
+		g1.push_back(i);
+		g2.push_back(i);
+	}
+	FUN_VALUE(g1.capacity());
+	FUN_VALUE(g2.capacity());
+	FUN_AFTER(g2, g2.shrink_to_fit());
+	FUN_VALUE(g2.capacity());
+
+	// ֵʱӹܲĿռ, ʱƶеԪ
+	vector<std::string> vs;
+	std::string str(32, 'a');
+	vs.push_back(std::move(str));
+	FUN_VALUE(str.size());
+	FUN_AFTER(vs, vs.emplace_back(3, 'b'));
+	FUN_AFTER(vs, vs.emplace(vs.begin(), "c"));
+	FUN_AFTER(vs, vs.insert(vs.begin() + 1, std::string("d")));
+	vector<std::string> vs2(std::move(vs));
+	FUN_VALUE(vs.size());
+	FUN_VALUE(vs2.size());
+
+	// ԰ֽڰ˵Ԫ: ʹreallocate, ɾʱ
+	std::cout << std::boolalpha;
+	FUN_VALUE(mystl::is_trivially_relocatable<std::unique_ptr<int>>::value);
+	FUN_VALUE((mystl::is_trivially_relocatable<mystl::pair<int, std::unique_ptr<int>>>::value));
+	FUN_VALUE(mystl::is_trivially_relocatable<std::string>::value);
+	std::cout << std::noboolalpha;
+	vector<std::unique_ptr<int>> vp;
+	for (int i = 0; i < 5; i++)
+		vp.emplace_back(new int(i));
+	vp.emplace(vp.begin() + 2, new int(10));
+	vp.erase(vp.begin());
+	vp.reserve(100);
+	std::cout << " vp :";
+	for (auto& p : vp)
+		std::cout << " " << *p;
+	std::cout << "\n";
+
 	PASSED;
 
 #if PERFORMANCE_TEST_ON
@@ -99,6 +377,31 @@ void vector_test() {
 #else
 	CON_TEST_P1(vector<int>, push_back, rand(), L(LEN1), XL(LEN2), XXL(LEN3));
 #endif
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|   grow vector<int>  |";
+#if LARGE_DATA_TEST_ON
+	VECTOR_GROW_TEST(XL(LEN3), XL(L(LEN3)), XL(XL(LEN3)));
+#else
+	VECTOR_GROW_TEST(M(LEN3), L(LEN3), XL(LEN3));
+#endif
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "| push_back by growth |";
+	VECTOR_POLICY_TEST(VECTOR_POLICY_DO_TEST, M(LEN3), L(LEN3), XL(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|   peak by growth    |";
+	VECTOR_POLICY_TEST(VECTOR_PEAK_DO_TEST, M(LEN3), L(LEN3), XL(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|   decode to vector  |";
+	VECTOR_DECODE_TEST(XL(LEN3), L(XL(LEN3)), XL(XL(LEN3)));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|   push_back string  |";
+	VECTOR_STRING_TEST(M(LEN2), L(LEN2), M(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|   grow unique_ptr   |";
+	VECTOR_RELOCATE_TEST(v.emplace_back(nullptr), M(LEN2), M(LEN3), L(LEN3));
+	std::cout << "|---------------------|-------------|-------------|-------------|\n";
+	std::cout << "|  insert unique_ptr  |";
+	VECTOR_RELOCATE_TEST(v.emplace(v.begin(), nullptr), XS(LEN1), S(LEN1), M(LEN1));
 	std::cout << "|---------------------|-------------|-------------|-------------|\n";
 	PASSED;
 #endif